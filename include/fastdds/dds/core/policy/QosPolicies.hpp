@@ -2582,6 +2582,7 @@ public:
                (this->builtin == b.builtin) &&
                (this->port == b.port) &&
                (this->throughput_controller == b.throughput_controller) &&
+               (this->destination_throughput_controller == b.destination_throughput_controller) &&
                (this->default_unicast_locator_list == b.default_unicast_locator_list) &&
                (this->default_multicast_locator_list == b.default_multicast_locator_list) &&
                QosPolicy::operator ==(b);
@@ -2608,6 +2609,12 @@ public:
     //!Throughput controller parameters. Leave default for uncontrolled flow.
     fastrtps::rtps::ThroughputControllerDescriptor throughput_controller;
 
+    /**
+     * Throughput controller parameters applied to each remote participant independently.
+     * Leave default for uncontrolled flow.
+     */
+    fastrtps::rtps::ThroughputControllerDescriptor destination_throughput_controller;
+
     /**
      * Default list of Unicast Locators to be used for any Endpoint defined inside this RTPSParticipant in the case
      * that it was defined with NO UnicastLocators. At least ONE locator should be included in this list.
@@ -2649,6 +2656,7 @@ public:
                (this->use_builtin_transports == b.use_builtin_transports) &&
                (this->send_socket_buffer_size == b.send_socket_buffer_size) &&
                (this->listen_socket_buffer_size == b.listen_socket_buffer_size) &&
+               (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads) &&
                QosPolicy::operator ==(b);
     }
 
@@ -2674,6 +2682,9 @@ public:
      * By default, 0.
      */
     uint32_t listen_socket_buffer_size;
+
+    //! Settings of the reception threads of the builtin transports.
+    fastdds::rtps::ThreadSettings builtin_transports_reception_threads;
 };
 
 //!Qos Policy to configure the endpoint
@@ -22,6 +22,7 @@
 
 #include <fastrtps/fastrtps_dll.h>
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -59,7 +60,10 @@ public:
                (this->properties_ == b.properties()) &&
                (this->wire_protocol_ == b.wire_protocol()) &&
                (this->transport_ == b.transport()) &&
-               (this->name_ == b.name());
+               (this->name_ == b.name()) &&
+               (this->timed_events_thread_ == b.timed_events_thread()) &&
+               (this->async_writers_thread_ == b.async_writers_thread()) &&
+               (this->discovery_server_matching_threads_ == b.discovery_server_matching_threads());
     }
 
     /**
@@ -258,6 +262,90 @@ public:
         name_ = value;
     }
 
+    /**
+     * Getter for the settings of the threads processing the timed events
+     * @return ThreadSettings reference
+     */
+    const fastdds::rtps::ThreadSettings& timed_events_thread() const
+    {
+        return timed_events_thread_;
+    }
+
+    /**
+     * Getter for the settings of the threads processing the timed events
+     * @return ThreadSettings reference
+     */
+    fastdds::rtps::ThreadSettings& timed_events_thread()
+    {
+        return timed_events_thread_;
+    }
+
+    /**
+     * Setter for the settings of the threads processing the timed events
+     * @param value New ThreadSettings to be set
+     */
+    void timed_events_thread(
+            const fastdds::rtps::ThreadSettings& value)
+    {
+        timed_events_thread_ = value;
+    }
+
+    /**
+     * Getter for the settings of the thread sending the data of asynchronous writers
+     * @return ThreadSettings reference
+     */
+    const fastdds::rtps::ThreadSettings& async_writers_thread() const
+    {
+        return async_writers_thread_;
+    }
+
+    /**
+     * Getter for the settings of the thread sending the data of asynchronous writers
+     * @return ThreadSettings reference
+     */
+    fastdds::rtps::ThreadSettings& async_writers_thread()
+    {
+        return async_writers_thread_;
+    }
+
+    /**
+     * Setter for the settings of the thread sending the data of asynchronous writers
+     * @param value New ThreadSettings to be set
+     */
+    void async_writers_thread(
+            const fastdds::rtps::ThreadSettings& value)
+    {
+        async_writers_thread_ = value;
+    }
+
+    /**
+     * Getter for the settings of the threads helping a discovery server to match endpoints
+     * @return ThreadSettings reference
+     */
+    const fastdds::rtps::ThreadSettings& discovery_server_matching_threads() const
+    {
+        return discovery_server_matching_threads_;
+    }
+
+    /**
+     * Getter for the settings of the threads helping a discovery server to match endpoints
+     * @return ThreadSettings reference
+     */
+    fastdds::rtps::ThreadSettings& discovery_server_matching_threads()
+    {
+        return discovery_server_matching_threads_;
+    }
+
+    /**
+     * Setter for the settings of the threads helping a discovery server to match endpoints
+     * @param value New ThreadSettings to be set
+     */
+    void discovery_server_matching_threads(
+            const fastdds::rtps::ThreadSettings& value)
+    {
+        discovery_server_matching_threads_ = value;
+    }
+
 private:
 
     //!UserData Qos, implemented in the library.
@@ -281,6 +369,15 @@ private:
     //!Name of the participant.
     fastrtps::string_255 name_ = "RTPSParticipant";
 
+    //!Settings of the threads processing the timed events.
+    fastdds::rtps::ThreadSettings timed_events_thread_;
+
+    //!Settings of the thread sending the data of asynchronous writers.
+    fastdds::rtps::ThreadSettings async_writers_thread_;
+
+    //!Settings of the threads helping a discovery server to match endpoints.
+    fastdds::rtps::ThreadSettings discovery_server_matching_threads_;
+
 };
 
 RTPS_DllAPI extern const DomainParticipantQos PARTICIPANT_QOS_DEFAULT;
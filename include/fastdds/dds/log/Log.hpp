@@ -17,6 +17,7 @@
 
 #include <fastrtps/utils/DBQueue.h>
 #include <fastrtps/fastrtps_dll.h>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <thread>
 #include <sstream>
 #include <atomic>
@@ -121,6 +122,14 @@ public:
     //! Stops the logging thread. It will re-launch on the next call to a successful log macro.
     RTPS_DllAPI static void KillThread();
 
+    /**
+     * Sets the OS settings of the logging thread.
+     * They are applied when the logging thread is launched, so they do not affect a thread already running
+     * until KillThread is called.
+     */
+    RTPS_DllAPI static void SetThreadConfig(
+            const fastdds::rtps::ThreadSettings&);
+
     // Note: In VS2013, if you're linking this class statically, you will have to call KillThread before leaving
     // main, due to an unsolved MSVC bug.
 
@@ -173,6 +182,7 @@ private:
         std::unique_ptr<std::regex> category_filter;
         std::unique_ptr<std::regex> filename_filter;
         std::unique_ptr<std::regex> error_string_filter;
+        fastdds::rtps::ThreadSettings thread_settings;
 
         std::atomic<Log::Kind> verbosity;
 
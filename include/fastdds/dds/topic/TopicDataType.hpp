@@ -108,6 +108,21 @@ public:
     RTPS_DllAPI virtual void deleteData(
             void* data) = 0;
 
+    /**
+     * Copy a sample of this type into another one.
+     * Readers on the same process sharing this type receive such copies instead of a serialized payload when the
+     * writer enables it. Types not overriding this method are always serialized.
+     * @param[out] dst Pointer to the destination data, created with createData.
+     * @param[in] src Pointer to the source data.
+     * @return True if the data was copied.
+     */
+    RTPS_DllAPI virtual bool copyData(
+            void* /*dst*/,
+            const void* /*src*/)
+    {
+        return false;
+    }
+
     /**
      * Get the key associated with the data.
      * @param[in] data Pointer to the data.
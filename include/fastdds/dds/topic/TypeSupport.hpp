@@ -180,6 +180,19 @@ public:
         return get()->deleteData(data);
     }
 
+    /**
+     * @brief Copies data
+     * @param dst Pointer to the destination data
+     * @param src Pointer to the source data
+     * @return true if the data is copied, false if the type does not support it
+     */
+    RTPS_DllAPI virtual bool copy_data(
+            void* dst,
+            const void* src)
+    {
+        return get()->copyData(dst, src);
+    }
+
     /**
      * @brief Getter for the data key
      * @param data Pointer to data
@@ -107,6 +107,63 @@ struct VariableLengthDataLimits
     size_t max_partitions = 0;
 };
 
+/**
+ * @brief Holds limits for the threads processing the timed events of a participant.
+ */
+struct EventThreadsAllocationAttributes
+{
+    bool operator ==(
+            const EventThreadsAllocationAttributes& b) const
+    {
+        return (this->count == b.count) &&
+               (this->isolate_builtin_endpoints == b.isolate_builtin_endpoints);
+    }
+
+    /** Number of threads processing timed events.
+     *
+     * Events not related to an endpoint (i.e. discovery announcements, liveliness assertion) are processed on
+     * the first thread. Events of each endpoint (i.e. heartbeats, ACKNACK responses, deadline, lifespan) are
+     * processed on the same thread, the one with fewest endpoints when the endpoint got it, so a slow callback on
+     * an endpoint only delays the events of the endpoints sharing its thread.
+     */
+    size_t count = 1u;
+
+    /** Whether builtin endpoints have a thread not shared with user endpoints.
+     *
+     * When true, events of builtin endpoints are processed on the first thread, and events of user endpoints
+     * are distributed among the rest of threads. Only used when count is greater than 1.
+     */
+    bool isolate_builtin_endpoints = false;
+};
+
+/**
+ * @brief Holds limits for the threads sending the data of asynchronous writers of a participant.
+ */
+struct AsyncWriterThreadsAllocationAttributes
+{
+    bool operator ==(
+            const AsyncWriterThreadsAllocationAttributes& b) const
+    {
+        return (this->count == b.count) &&
+               (this->isolate_builtin_endpoints == b.isolate_builtin_endpoints);
+    }
+
+    /** Number of threads sending the data of asynchronous writers.
+     *
+     * Each writer is always processed on the same thread, the one with fewest writers when the writer first needs
+     * to send data, so a writer blocked on a slow transport only delays the writers sharing its thread. Threads are
+     * created the first time a writer assigned to them needs to send data.
+     */
+    size_t count = 1u;
+
+    /** Whether builtin writers have a thread not shared with user writers.
+     *
+     * When true, builtin writers are processed on the first thread, and user writers are distributed among the
+     * rest of threads. Only used when count is greater than 1.
+     */
+    bool isolate_builtin_endpoints = false;
+};
+
 /**
  * @brief Holds allocation limits affecting collections managed by a participant.
  */
@@ -124,6 +181,10 @@ struct RTPSParticipantAllocationAttributes
     SendBuffersAllocationAttributes send_buffers;
     //! Holds limits for variable-length data
     VariableLengthDataLimits data_limits;
+    //! Holds limits for the threads processing timed events.
+    EventThreadsAllocationAttributes event_threads;
+    //! Holds limits for the threads sending the data of asynchronous writers.
+    AsyncWriterThreadsAllocationAttributes async_writer_threads;
 
     //! @return the allocation config for the total of readers in the system (participants * readers)
     ResourceLimitedContainerConfig total_readers() const
@@ -145,7 +206,9 @@ struct RTPSParticipantAllocationAttributes
                (this->readers == b.readers) &&
                (this->writers == b.writers) &&
                (this->send_buffers == b.send_buffers) &&
-               (this->data_limits == b.data_limits);
+               (this->data_limits == b.data_limits) &&
+               (this->event_threads == b.event_threads) &&
+               (this->async_writer_threads == b.async_writer_threads);
     }
 
 private:
@@ -29,6 +29,7 @@
 #include <fastrtps/utils/fixed_size_string.hpp>
 #include <fastdds/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
 #include <fastdds/rtps/attributes/ServerAttributes.h>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 
 #include <memory>
 #include <sstream>
@@ -382,7 +383,11 @@ public:
                (this->userData == b.userData) &&
                (this->participantID == b.participantID) &&
                (this->throughputController == b.throughputController) &&
+               (this->destination_throughput_controller == b.destination_throughput_controller) &&
                (this->useBuiltinTransports == b.useBuiltinTransports) &&
+               (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads) &&
+               (this->timed_events_thread == b.timed_events_thread) &&
+               (this->async_writers_thread == b.async_writers_thread) &&
                (this->properties == b.properties &&
                (this->prefix == b.prefix));
     }
@@ -434,11 +439,30 @@ public:
     //!Throughput controller parameters. Leave default for uncontrolled flow.
     ThroughputControllerDescriptor throughputController;
 
+    /**
+     * Throughput controller parameters applied to each remote participant independently.
+     * Leave default for uncontrolled flow.
+     */
+    ThroughputControllerDescriptor destination_throughput_controller;
+
     //!User defined transports to use alongside or in place of builtins.
     std::vector<std::shared_ptr<fastdds::rtps::TransportDescriptorInterface>> userTransports;
 
     //!Set as false to disable the default UDPv4 implementation.
     bool useBuiltinTransports;
+
+    //! Settings of the reception threads of the builtin transports.
+    fastdds::rtps::ThreadSettings builtin_transports_reception_threads;
+
+    //! Settings of the threads processing the timed events of the participant.
+    fastdds::rtps::ThreadSettings timed_events_thread;
+
+    //! Settings of the thread sending the data of the asynchronous writers of the participant.
+    fastdds::rtps::ThreadSettings async_writers_thread;
+
+    //! Settings of the threads helping a discovery server to match the endpoints of its topics.
+    fastdds::rtps::ThreadSettings discovery_server_matching_threads;
+
     //!Holds allocation limits affecting collections managed by a participant.
     RTPSParticipantAllocationAttributes allocation;
 
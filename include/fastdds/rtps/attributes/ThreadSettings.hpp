@@ -0,0 +1,96 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadSettings.hpp
+ */
+
+#ifndef _FASTDDS_RTPS_ATTRIBUTES_THREADSETTINGS_HPP_
+#define _FASTDDS_RTPS_ATTRIBUTES_THREADSETTINGS_HPP_
+
+#include <cstdint>
+#include <limits>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * @brief Holds the OS settings applied to a thread created by the library.
+ *
+ * The default values leave the thread as created by the OS, inheriting the settings of the thread creating it.
+ */
+struct ThreadSettings
+{
+    //! Value of @ref priority meaning the priority of the thread will not be changed.
+    static constexpr int32_t default_priority = std::numeric_limits<int32_t>::min();
+
+    bool operator ==(
+            const ThreadSettings& b) const
+    {
+        return (this->scheduling_policy == b.scheduling_policy) &&
+               (this->priority == b.priority) &&
+               (this->affinity == b.affinity) &&
+               (this->stack_size == b.stack_size);
+    }
+
+    bool operator !=(
+            const ThreadSettings& b) const
+    {
+        return !(*this == b);
+    }
+
+    /**
+     * Scheduling policy of the thread.
+     *
+     * On POSIX systems, this is the value passed to pthread_setschedparam (i.e. SCHED_OTHER, SCHED_FIFO, SCHED_RR).
+     * It is ignored on Windows.
+     * A value of -1 means the scheduling policy will not be changed.
+     */
+    int32_t scheduling_policy = -1;
+
+    /**
+     * Priority of the thread.
+     *
+     * On POSIX systems, this is the priority passed to pthread_setschedparam, and its valid values depend on the
+     * scheduling policy. On Windows, this is the value passed to SetThreadPriority.
+     * A value of @ref default_priority means the priority will not be changed.
+     */
+    int32_t priority = default_priority;
+
+    /**
+     * Mask of the CPU cores the thread is allowed to run on.
+     *
+     * Bit N of the mask enables core N. It is applied on Linux and Windows.
+     * A value of 0 means the affinity will not be changed.
+     */
+    uint64_t affinity = 0;
+
+    /**
+     * Size of the stack of the thread in bytes.
+     *
+     * It is set when the thread is created. When the OS rejects the value (e.g. it is lower than PTHREAD_STACK_MIN),
+     * the default stack size is used.
+     * Only the asynchronous writers threads honor it. The rest of threads are std::thread objects on the public API,
+     * whose stack size cannot be chosen, so they use the default one and report a warning.
+     * A value of 0 means the default stack size of the OS.
+     */
+    uint32_t stack_size = 0;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_ATTRIBUTES_THREADSETTINGS_HPP_
@@ -96,6 +96,7 @@ public:
         , disable_heartbeat_piggyback(false)
         , disable_positive_acks(false)
         , keep_duration(TIME_T_INFINITE_SECONDS, TIME_T_INFINITE_NANOSECONDS)
+        , send_deadline(TIME_T_INFINITE_SECONDS, TIME_T_INFINITE_NANOSECONDS)
     {
         endpoint.endpointKind = WRITER;
         endpoint.durabilityKind = TRANSIENT_LOCAL;
@@ -138,6 +139,10 @@ public:
 
     //! Keep duration to keep a sample before considering it has been acked
     Duration_t keep_duration;
+
+    //! Maximum time since a sample is written until it should be sent. Used by flow controllers scheduling the
+    //! earliest deadline first.
+    Duration_t send_deadline;
 };
 
 } /* namespace rtps */
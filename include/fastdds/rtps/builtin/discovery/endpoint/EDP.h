@@ -28,10 +28,21 @@
 #include <fastdds/dds/core/status/PublicationMatchedStatus.hpp>
 #include <fastdds/dds/core/status/SubscriptionMatchedStatus.hpp>
 #include <fastdds/dds/core/status/IncompatibleQosStatus.hpp>
+#include <fastrtps/types/TypeObjectHashId.h>
 
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
 
+#include <array>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #define MATCH_FAILURE_REASON_COUNT size_t(16)
 
 namespace eprosima {
@@ -51,6 +62,7 @@ class RTPSWriter;
 class RTPSReader;
 class WriterProxyData;
 class RTPSParticipantImpl;
+class PartitionMatcher;
 
 /**
  * Class EDP, base class for Endpoint Discovery Protocols. It contains generic methods used by the two EDP implemented (EDPSimple and EDPStatic), as well as abstract methods
@@ -136,6 +148,21 @@ public:
     virtual bool removeLocalWriter(
             RTPSWriter* W) = 0;
 
+    /**
+     * Stop considering a local Reader when matching the endpoints discovered from now on.
+     * Should be called before the Reader is destroyed.
+     * @param R Pointer to the Reader being removed.
+     */
+    void unregister_local_reader(
+            RTPSReader* R);
+    /**
+     * Stop considering a local Writer when matching the endpoints discovered from now on.
+     * Should be called before the Writer is destroyed.
+     * @param W Pointer to the Writer being removed.
+     */
+    void unregister_local_writer(
+            RTPSWriter* W);
+
     /**
      * After a new local ReaderProxyData has been created some processing is needed (depends on the implementation).
      * @param reader Pointer to the Reader object.
@@ -391,6 +418,112 @@ private:
             const WriterProxyData* wdata,
             const ReaderProxyData* rdata) const;
 
+    /**
+     * Check whether the type of a writer is consistent with the type of a reader.
+     * Types identified by the same hash are the same type, so their type objects are not compared. The result of
+     * comparing types with different hashes is remembered once the type objects of both are known, dropping the
+     * least recently used results when too many are kept.
+     * @param wtype Identifier of the type of the writer.
+     * @param rtype Identifier of the type of the reader.
+     * @return True when the types are consistent.
+     */
+    bool consistent_types(
+            const types::TypeIdentifier& wtype,
+            const types::TypeIdentifier& rtype) const;
+
+    //! Topic of a discovered endpoint, and the data of its QoS used when matching it
+    struct DiscoveredEndpoint
+    {
+        std::string topic;
+        //! Matching relevant QoS of the endpoint, serialized
+        std::string qos_fingerprint;
+        //! Compiled list of partitions of the endpoint
+        std::shared_ptr<const PartitionMatcher> partitions;
+    };
+
+    /**
+     * Compute the data of the QoS of an endpoint used when matching it.
+     * @param data Proxy of the endpoint.
+     * @param [out] endpoint Where the fingerprint and the partition matcher are stored.
+     */
+    template<typename ProxyData>
+    void fill_matching_data(
+            const ProxyData& data,
+            DiscoveredEndpoint& endpoint) const;
+
+    /**
+     * Get the data of the QoS of an endpoint used when matching it.
+     * It is the one stored when the endpoint was last indexed, or computed on the spot for endpoints not indexed.
+     * Should be called with the PDP mutex taken.
+     * @param data Proxy of the endpoint.
+     * @param [out] computed Storage for the data computed on the spot.
+     * @return Reference to the data of the endpoint.
+     */
+    template<typename ProxyData>
+    const DiscoveredEndpoint& matching_data(
+            const ProxyData& data,
+            DiscoveredEndpoint& computed) const;
+
+    /**
+     * Look for the result of a previous QoS compatibility check between endpoints with the same QoS.
+     * @param writer_fingerprint Fingerprint of the QoS of the writer.
+     * @param reader_fingerprint Fingerprint of the QoS of the reader.
+     * @param reason[out] On return will specify the reason of failed matching (if any).
+     * @param incompatible_qos[out] On return will specify all the QoS values that were incompatible (if any).
+     * @return True when the result was found.
+     */
+    bool cached_qos_compatibility(
+            const std::string& writer_fingerprint,
+            const std::string& reader_fingerprint,
+            MatchingFailureMask& reason,
+            fastdds::dds::PolicyMask& incompatible_qos) const;
+
+    /**
+     * Remember the result of a QoS compatibility check.
+     * @param writer_fingerprint Fingerprint of the QoS of the writer.
+     * @param reader_fingerprint Fingerprint of the QoS of the reader.
+     * @param reason Reason of failed matching (if any).
+     * @param incompatible_qos QoS values that were incompatible (if any).
+     */
+    void cache_qos_compatibility(
+            const std::string& writer_fingerprint,
+            const std::string& reader_fingerprint,
+            const MatchingFailureMask& reason,
+            const fastdds::dds::PolicyMask& incompatible_qos) const;
+
+    /**
+     * Get the matcher of a list of partitions, compiled the first time it is needed.
+     * @param partitions List of partitions.
+     * @return Matcher of the list of partitions.
+     */
+    std::shared_ptr<const PartitionMatcher> partition_matcher(
+            const fastdds::dds::PartitionQosPolicy& partitions) const;
+
+    /**
+     * Add a discovered endpoint, local or remote, to the index of its topic.
+     * Should be called with the PDP mutex taken.
+     */
+    void index_discovered_reader(
+            const ReaderProxyData& rdata);
+
+    void index_discovered_writer(
+            const WriterProxyData& wdata);
+
+    /**
+     * Find the proxy of a discovered endpoint.
+     * Should be called with the PDP mutex taken.
+     * @param guid GUID of the endpoint.
+     * @param [out] participant Proxy of the participant the endpoint belongs to.
+     * @return Pointer to the proxy of the endpoint, nullptr if it is no longer known.
+     */
+    ReaderProxyData* find_discovered_reader(
+            const GUID_t& guid,
+            ParticipantProxyData*& participant) const;
+
+    WriterProxyData* find_discovered_writer(
+            const GUID_t& guid,
+            ParticipantProxyData*& participant) const;
+
     ReaderProxyData temp_reader_proxy_data_;
     WriterProxyData temp_writer_proxy_data_;
 
@@ -402,6 +535,94 @@ private:
 
     foonathan::memory::map<GUID_t, fastdds::dds::SubscriptionMatchedStatus, pool_allocator_t> reader_status_;
     foonathan::memory::map<GUID_t, fastdds::dds::PublicationMatchedStatus, pool_allocator_t> writer_status_;
+
+    /*
+     * Endpoints by topic name, so each endpoint is only checked against the ones on its topic. Type names are not
+     * part of the key, as the type consistency rules may match endpoints with different type names.
+     * Protected by the PDP mutex.
+     */
+
+    //! Local user readers
+    std::map<std::string, std::vector<RTPSReader*>> local_readers_by_topic_;
+    //! Local user writers
+    std::map<std::string, std::vector<RTPSWriter*>> local_writers_by_topic_;
+    //! Discovered readers, including the local ones
+    std::map<std::string, std::vector<GUID_t>> discovered_readers_by_topic_;
+    //! Discovered writers, including the local ones
+    std::map<std::string, std::vector<GUID_t>> discovered_writers_by_topic_;
+    //! Topic of each local user endpoint
+    std::map<GUID_t, std::string> local_endpoint_topics_;
+    //! Topic and matching data of each discovered endpoint
+    std::map<GUID_t, DiscoveredEndpoint> discovered_endpoints_;
+
+    //! Kind of the type identifiers, followed by the hashes of the writer and reader types
+    using TypeHashPair = std::array<octet, 1 + 2 * sizeof(types::EquivalenceHash)>;
+
+    struct TypeConsistency
+    {
+        TypeHashPair types;
+        bool consistent;
+    };
+
+    using TypeConsistencyList = std::list<TypeConsistency>;
+
+    //! Results of the consistency checks between types with different hashes. Most recently used first
+    mutable TypeConsistencyList type_consistency_cache_;
+    //! Entries of type_consistency_cache_, by their types
+    mutable std::map<TypeHashPair, TypeConsistencyList::iterator> type_consistency_index_;
+    //! Protects type_consistency_cache_
+    mutable std::mutex type_consistency_mutex_;
+
+    struct QosCompatibility
+    {
+        //! Fingerprints of the QoS of the writer and the reader
+        std::pair<std::string, std::string> fingerprints;
+        MatchingFailureMask reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+    };
+
+    struct PartitionMatcherEntry
+    {
+        //! Fingerprint of the list of partitions
+        std::string fingerprint;
+        std::shared_ptr<const PartitionMatcher> matcher;
+    };
+
+    //! Fingerprints of a writer and a reader, pointed to so they can be looked for without copying them
+    using QosFingerprintRefs = std::pair<const std::string*, const std::string*>;
+
+    //! Orders fingerprints pointed to by their contents
+    struct FingerprintLess
+    {
+        bool operator ()(
+                const std::string* lhs,
+                const std::string* rhs) const
+        {
+            return *lhs < *rhs;
+        }
+
+        bool operator ()(
+                const QosFingerprintRefs& lhs,
+                const QosFingerprintRefs& rhs) const
+        {
+            return std::tie(*lhs.first, *lhs.second) < std::tie(*rhs.first, *rhs.second);
+        }
+
+    };
+
+    using QosCompatibilityList = std::list<QosCompatibility>;
+    using PartitionMatcherList = std::list<PartitionMatcherEntry>;
+
+    //! Results of the QoS compatibility checks, as many endpoints share the same QoS. Most recently used first
+    mutable QosCompatibilityList qos_compatibility_cache_;
+    //! Entries of qos_compatibility_cache_, by the fingerprints stored on them
+    mutable std::map<QosFingerprintRefs, QosCompatibilityList::iterator, FingerprintLess> qos_compatibility_index_;
+    //! Compiled lists of partitions. Most recently used first
+    mutable PartitionMatcherList partition_matchers_;
+    //! Entries of partition_matchers_, by the fingerprints stored on them
+    mutable std::map<const std::string*, PartitionMatcherList::iterator, FingerprintLess> partition_matcher_index_;
+    //! Protects the QoS compatibility cache and the partition matchers
+    mutable std::mutex qos_compatibility_mutex_;
 };
 
 } /* namespace rtps */
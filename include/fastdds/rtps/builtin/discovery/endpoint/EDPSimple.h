@@ -252,6 +252,15 @@ private:
             bool remove_same_instance,
             CacheChange_t** created_change);
 
+    /**
+     * Make a builtin writer share the flow controller of the discovery writers, when there is one.
+     * @param [in] writer The writer,history pair of the builtin writer.
+     * @param [in] attributes Attributes the writer was created with.
+     */
+    void add_discovery_flow_controller(
+            const t_p_StatefulWriter& writer,
+            const WriterAttributes& attributes);
+
 #if HAVE_SECURITY
     bool create_sedp_secure_endpoints();
 
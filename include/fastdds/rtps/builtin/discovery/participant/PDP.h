@@ -23,6 +23,9 @@
 
 #include <mutex>
 #include <functional>
+#include <memory>
+#include <random>
+#include <unordered_map>
 
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
@@ -66,6 +69,7 @@ class RTPSParticipantListener;
 class BuiltinProtocols;
 class EDP;
 class TimedEvent;
+class FlowController;
 class ReaderProxyData;
 class WriterProxyData;
 class ParticipantProxyData;
@@ -167,6 +171,24 @@ public:
             GUID_t& participant_guid,
             std::function<bool(WriterProxyData*, bool, const ParticipantProxyData&)> initializer_func);
 
+    /**
+     * Find a registered RTPSParticipant (including the local RTPSParticipant) by its GUID prefix.
+     * Should be called with the PDP mutex taken.
+     * @param guid_prefix GuidPrefix_t of the RTPSParticipant we are looking for.
+     * @return Pointer to its ParticipantProxyData, nullptr if not found.
+     */
+    ParticipantProxyData* find_participant_proxy(
+            const GuidPrefix_t& guid_prefix) const;
+
+    /**
+     * Get the flow controller shared by the discovery writers of the participant.
+     * @return Pointer to the controller, nullptr when discovery traffic is not rate limited.
+     */
+    std::shared_ptr<FlowController> discovery_flow_controller() const
+    {
+        return discovery_flow_controller_;
+    }
+
     /**
      * This method returns whether a ReaderProxyDataObject exists among the registered RTPSParticipants
      * (including the local RTPSParticipant).
@@ -367,6 +389,8 @@ protected:
     size_t participant_proxies_number_;
     //!Registered RTPSParticipants (including the local one, that is the first one.)
     ResourceLimitedVector<ParticipantProxyData*> participant_proxies_;
+    //!Registered RTPSParticipants indexed by GUID prefix. Kept in sync with participant_proxies_.
+    std::unordered_map<GuidPrefix_t, ParticipantProxyData*> participant_proxies_by_prefix_;
     //!Pool of participant proxy data objects ready for reuse
     ResourceLimitedVector<ParticipantProxyData*> participant_proxies_pool_;
     //!Number of reader proxy data objects created
@@ -425,6 +449,37 @@ protected:
             const GUID_t& participant_guid,
             InstanceHandle_t& key);
 
+    /**
+     * Announces the local participant when the periodic announcement timer expires.
+     * By default, the whole DATA(p) is sent again.
+     */
+    virtual void announce_participant_periodically()
+    {
+        announceParticipantState(false);
+    }
+
+    /**
+     * Checks whether the initial announcements, sent with their own period, are still ongoing.
+     *
+     * @return true when there are initial announcements left to send.
+     */
+    bool initial_announcements_pending() const
+    {
+        return initial_announcements_.count > 0;
+    }
+
+    /**
+     * Brings forward the next announcement, so it is sent in at most the given time.
+     * Does nothing when it is already due before.
+     *
+     * @param max_delay_ms Maximum time, in milliseconds, until the next announcement.
+     */
+    void bring_forward_announcement(
+            double max_delay_ms);
+
+    //!Flow controller shared by the discovery writers. nullptr when discovery traffic is not rate limited.
+    std::shared_ptr<FlowController> discovery_flow_controller_;
+
 private:
 
     //!TimedEvent to periodically resend the local RTPSParticipant information.
@@ -433,6 +488,15 @@ private:
     //!Participant's initial announcements config
     InitialAnnouncementConfig initial_announcements_;
 
+    //!Maximum fraction of the announcement period by which each announcement is randomly advanced or delayed
+    double announcement_jitter_ = 0.0;
+
+    //!Random generator for the announcement jitter
+    std::mt19937 announcement_jitter_generator_;
+
+    void update_announcement_interval(
+            const Duration_t& period);
+
     void check_remote_participant_liveliness(
             ParticipantProxyData* remote_participant);
 
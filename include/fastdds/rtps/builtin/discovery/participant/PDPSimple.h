@@ -23,6 +23,8 @@
 
 #include <fastdds/rtps/builtin/discovery/participant/PDP.h>
 
+#include <atomic>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -124,6 +126,35 @@ private:
      */
     bool createPDPEndpoints() override;
 
+    /**
+     * Sends most of the periodic announcements as a HEARTBEAT of the SPDP writer when compact announcements are
+     * enabled. The DATA(p) is still sent on every announcement requested through announceParticipantState.
+     */
+    void announce_participant_periodically() override;
+
+    /**
+     * Send a HEARTBEAT of the SPDP writer to all its destinations, so remote participants assert the liveliness of
+     * this one without receiving its whole DATA(p) again.
+     * @param writer Pointer to the SPDP writer.
+     */
+    void send_compact_announcement(
+            StatelessWriter* writer);
+
+    //!Number of compact announcements sent between two full ones. Zero when they are disabled.
+    uint32_t compact_announcements_ = 0;
+
+    //!Compact announcements left before the next full one.
+    uint32_t compact_announcements_left_ = 0;
+
+    //!Count of the HEARTBEATs sent as compact announcements.
+    Count_t compact_announcement_count_ = 0;
+
+    //!Maximum time, in milliseconds, a newly discovered participant waits for the DATA(p). Zero answers right away.
+    double response_suppression_ms_ = 0.0;
+
+    //!Whether some discovered participant is waiting for the DATA(p).
+    std::atomic_bool response_pending_{false};
+
 };
 
 } /* namespace rtps */
@@ -27,6 +27,7 @@
 #include <fastdds/rtps/common/FragmentNumber.h>
 
 #include <cassert>
+#include <vector>
 
 #include <fastdds/rtps/history/IPayloadPool.h>
 
@@ -115,6 +116,8 @@ struct RTPS_DllAPI CacheChange_t
         fragment_size_ = ch_ptr->fragment_size_;
         fragment_count_ = ch_ptr->fragment_count_;
         first_missing_fragment_ = ch_ptr->first_missing_fragment_;
+        missing_fragments_count_ = ch_ptr->missing_fragments_count_;
+        missing_fragments_ = ch_ptr->missing_fragments_;
 
         return serializedPayload.copy(&ch_ptr->serializedPayload, !ch_ptr->is_untyped_);
     }
@@ -175,7 +178,7 @@ struct RTPS_DllAPI CacheChange_t
      */
     bool is_fully_assembled()
     {
-        return first_missing_fragment_ >= fragment_count_;
+        return missing_fragments_count_ == 0;
     }
 
     /*!
@@ -188,12 +191,15 @@ struct RTPS_DllAPI CacheChange_t
         // Note: Fragment numbers are 1-based but we keep them 0 based.
         frag_sns.base(first_missing_fragment_ + 1);
 
-        // Traverse list of missing fragments, adding them to frag_sns
+        // Traverse bitmap of missing fragments, adding them to frag_sns until it is full
         uint32_t current_frag = first_missing_fragment_;
         while (current_frag < fragment_count_)
         {
-            frag_sns.add(current_frag + 1);
-            current_frag = get_next_missing_fragment(current_frag);
+            if (!frag_sns.add(current_frag + 1))
+            {
+                break;
+            }
+            current_frag = find_missing_fragment(current_frag + 1);
         }
     }
 
@@ -213,6 +219,10 @@ struct RTPS_DllAPI CacheChange_t
         fragment_size_ = fragment_size;
         fragment_count_ = 0;
         first_missing_fragment_ = 0;
+        missing_fragments_count_ = 0;
+
+        // Capacity is kept, so a pooled change does not allocate again when reused for a similar sample
+        missing_fragments_.clear();
 
         if (fragment_size > 0)
         {
@@ -221,13 +231,14 @@ struct RTPS_DllAPI CacheChange_t
 
             if (create_fragment_list)
             {
-                // Keep index of next fragment on the payload portion at the beginning of each fragment. Last
-                // fragment will have fragment_count_ as 'next fragment index'
-                size_t offset = 0;
-                for (uint32_t i = 1; i <= fragment_count_; i++, offset += fragment_size_)
+                // Mark every fragment as missing. Bits beyond fragment_count_ on the last word are kept clear.
+                missing_fragments_.assign((fragment_count_ + 31u) / 32u, ~0u);
+                uint32_t remaining_bits = fragment_count_ & 31u;
+                if (remaining_bits != 0)
                 {
-                    set_next_missing_fragment(i - 1, i);  // index to next fragment in missing list
+                    missing_fragments_.back() = (1u << remaining_bits) - 1u;
                 }
+                missing_fragments_count_ = fragment_count_;
             }
             else
             {
@@ -308,37 +319,55 @@ private:
     // First fragment in missing list
     uint32_t first_missing_fragment_ = 0;
 
+    // Number of fragments still missing
+    uint32_t missing_fragments_count_ = 0;
+
+    // Bitmap of missing fragments (bit i of word i / 32 set means fragment i has not been received)
+    std::vector<uint32_t> missing_fragments_;
+
     // Pool that created the payload of this cache change
     IPayloadPool* payload_owner_ = nullptr;
 
-    uint32_t get_next_missing_fragment(
-            uint32_t fragment_index)
+    /*!
+     * Find the first missing fragment with an index not lower than the given one.
+     *
+     * @param fragment_index Index (0-based) where the search starts.
+     * @return index of the first missing fragment found, or fragment_count_ if there is none.
+     */
+    uint32_t find_missing_fragment(
+            uint32_t fragment_index) const
     {
-        uint32_t* ptr = next_fragment_pointer(fragment_index);
-        return *ptr;
-    }
+        uint32_t word = fragment_index >> 5;
+        uint32_t num_words = static_cast<uint32_t>(missing_fragments_.size());
+        if (word < num_words)
+        {
+            // Ignore bits below fragment_index on the first word
+            uint32_t bits = missing_fragments_[word] & (~0u << (fragment_index & 31u));
+            while (bits == 0)
+            {
+                if (++word >= num_words)
+                {
+                    return fragment_count_;
+                }
+                bits = missing_fragments_[word];
+            }
 
-    void set_next_missing_fragment(
-            uint32_t fragment_index,
-            uint32_t next_fragment_index)
-    {
-        uint32_t* ptr = next_fragment_pointer(fragment_index);
-        *ptr = next_fragment_index;
-    }
+            uint32_t bit = 0;
+            while ((bits & (1u << bit)) == 0)
+            {
+                ++bit;
+            }
+            return (word << 5) + bit;
+        }
 
-    uint32_t* next_fragment_pointer(
-            uint32_t fragment_index)
-    {
-        size_t offset = fragment_size_;
-        offset *= fragment_index;
-        offset = (offset + 3u) & ~3u;
-        return reinterpret_cast<uint32_t*>(&serializedPayload.data[offset]);
+        return fragment_count_;
     }
 
     /*!
      * Mark a set of consecutive fragments as received.
-     * This will remove a set of consecutive fragments from the missing list.
-     * Should be called BEFORE copying the received data into the serialized payload.
+     * This will clear the bits of a set of consecutive fragments on the missing fragments bitmap.
+     * As the bitmap is not kept inside the serialized payload, received data is only written once, directly
+     * at its final offset.
      *
      * @param initial_fragment Index (0-based) of first received fragment.
      * @param num_of_fragments Number of received fragments. Should be strictly positive.
@@ -350,7 +379,8 @@ private:
     {
         bool at_least_one_changed = false;
 
-        if ((fragment_size_ > 0) && (initial_fragment < fragment_count_))
+        // Changes fragmented to be sent have no bitmap, as nothing is missing on them
+        if ((fragment_size_ > 0) && (initial_fragment < fragment_count_) && !missing_fragments_.empty())
         {
             uint32_t last_fragment = initial_fragment + num_of_fragments;
             if (last_fragment > fragment_count_)
@@ -358,42 +388,23 @@ private:
                 last_fragment = fragment_count_;
             }
 
-            if (initial_fragment <= first_missing_fragment_)
+            for (uint32_t i = initial_fragment; i < last_fragment; ++i)
             {
-                // Perform first = *first until first >= last_received
-                while (first_missing_fragment_ < last_fragment)
+                uint32_t& word = missing_fragments_[i >> 5];
+                uint32_t mask = 1u << (i & 31u);
+                if ((word & mask) != 0)
                 {
-                    first_missing_fragment_ = get_next_missing_fragment(first_missing_fragment_);
+                    word &= ~mask;
+                    --missing_fragments_count_;
                     at_least_one_changed = true;
                 }
             }
-            else
+
+            // Advance first missing fragment when it has just been received
+            if (at_least_one_changed && (initial_fragment <= first_missing_fragment_) &&
+                    (first_missing_fragment_ < last_fragment))
             {
-                // Find prev in missing list
-                uint32_t current_frag = first_missing_fragment_;
-                while (current_frag < initial_fragment)
-                {
-                    uint32_t next_frag = get_next_missing_fragment(current_frag);
-                    if (next_frag >= initial_fragment)
-                    {
-                        // This is the fragment previous to initial_fragment.
-                        // Find future value for next by repeating next = *next until next >= last_fragment.
-                        uint32_t next_missing_fragment = next_frag;
-                        while (next_missing_fragment < last_fragment)
-                        {
-                            next_missing_fragment = get_next_missing_fragment(next_missing_fragment);
-                            at_least_one_changed = true;
-                        }
-
-                        // Update next and finish loop
-                        if (at_least_one_changed)
-                        {
-                            set_next_missing_fragment(current_frag, next_missing_fragment);
-                        }
-                        break;
-                    }
-                    current_frag = next_frag;
-                }
+                first_missing_fragment_ = find_missing_fragment(last_fragment);
             }
         }
 
@@ -24,6 +24,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <functional>
 #include <sstream>
 
 namespace eprosima {
@@ -151,4 +152,25 @@ inline std::istream& operator >>(
 } // namespace fastrtps
 } // namespace eprosima
 
+namespace std {
+template <>
+struct hash<eprosima::fastrtps::rtps::GuidPrefix_t>
+{
+    std::size_t operator ()(
+            const eprosima::fastrtps::rtps::GuidPrefix_t& k) const
+    {
+        // Participants on the same host share most of the prefix, so every octet is mixed in (FNV-1a)
+        uint64_t ret = 14695981039346656037ull;
+        for (eprosima::fastrtps::rtps::octet o : k.value)
+        {
+            ret ^= o;
+            ret *= 1099511628211ull;
+        }
+        return static_cast<std::size_t>(ret);
+    }
+
+};
+
+} // namespace std
+
 #endif /* _FASTDDS_RTPS_COMMON_GUIDPREFIX_T_HPP_ */
@@ -26,6 +26,7 @@
 #include <fastrtps/utils/IPLocator.h>
 
 #include <algorithm>
+#include <limits>
 
 namespace eprosima {
 namespace fastrtps {
@@ -64,6 +65,7 @@ public:
         : entries_(entries_allocation)
         , selections_(entries_allocation)
         , last_state_(entries_allocation)
+        , selected_state_(entries_allocation)
     {
     }
 
@@ -75,6 +77,7 @@ public:
         entries_.clear();
         selections_.clear();
         last_state_.clear();
+        entries_changed();
     }
 
     /**
@@ -85,6 +88,7 @@ public:
     bool add_entry(
             LocatorSelectorEntry* entry)
     {
+        entries_changed();
         return entries_.push_back(entry) != nullptr;
     }
 
@@ -95,6 +99,7 @@ public:
     bool remove_entry(
             const GUID_t& guid)
     {
+        entries_changed();
         return entries_.remove_if(
             [&guid](LocatorSelectorEntry* entry)
             {
@@ -113,7 +118,7 @@ public:
         last_state_.clear();
         for (LocatorSelectorEntry* entry : entries_)
         {
-            last_state_.push_back(entry->enabled ? 1 : 0);
+            last_state_.push_back(entry_state(entry));
             entry->enable(enable_all);
         }
     }
@@ -150,7 +155,7 @@ public:
 
         for (size_t i = 0; i < entries_.size(); ++i)
         {
-            if (last_state_.at(i) != (entries_.at(i)->enabled ? 1 : 0))
+            if (last_state_.at(i) != entry_state(entries_.at(i)))
             {
                 return true;
             }
@@ -159,16 +164,54 @@ public:
         return false;
     }
 
+    /**
+     * Inform the selector that the locators of its entries have changed.
+     * This invalidates the current selection.
+     */
+    void entries_changed()
+    {
+        ++entries_epoch_;
+    }
+
+    /**
+     * Check if the current selection is still valid for the current enabling state.
+     *
+     * The selection is valid when it was computed with the same entries enabled, and no entries have been
+     * added, removed or changed since then. In that case the selection algorithm can be skipped.
+     *
+     * @return true if the selection is valid, false otherwise.
+     */
+    bool selection_is_valid() const
+    {
+        if (selected_epoch_ != entries_epoch_ || entries_.size() != selected_state_.size())
+        {
+            return false;
+        }
+
+        for (size_t i = 0; i < entries_.size(); ++i)
+        {
+            if (selected_state_.at(i) != entry_state(entries_.at(i)))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
     /**
      * Reset the selection state of the selector.
      */
     void selection_start()
     {
         selections_.clear();
+        selected_state_.clear();
         for (LocatorSelectorEntry* entry : entries_)
         {
             entry->reset();
+            selected_state_.push_back(entry_state(entry));
         }
+        selected_epoch_ = entries_epoch_;
     }
 
     /**
@@ -463,12 +506,25 @@ public:
 
 private:
 
+    //! Enabling state of an entry, taking into account whether it may use multicast.
+    static int entry_state(
+            const LocatorSelectorEntry* entry)
+    {
+        return entry->enabled ? (entry->allow_multicast ? 1 : 2) : 0;
+    }
+
     //! Entries collection.
     ResourceLimitedVector<LocatorSelectorEntry*> entries_;
     //! List of selected indexes.
     ResourceLimitedVector<size_t> selections_;
     //! Enabling state when reset was called.
     ResourceLimitedVector<int> last_state_;
+    //! Enabling state when selection was started.
+    ResourceLimitedVector<int> selected_state_;
+    //! Incremented each time entries are added, removed or changed.
+    uint32_t entries_epoch_ = 0;
+    //! Value of entries_epoch_ when selection was started.
+    uint32_t selected_epoch_ = std::numeric_limits<uint32_t>::max();
 };
 
 } /* namespace rtps */
@@ -76,18 +76,21 @@ struct LocatorSelectorEntry
         , multicast(ResourceLimitedContainerConfig::fixed_size_configuration(max_multicast_locators))
         , state(max_unicast_locators, max_multicast_locators)
         , enabled(false)
+        , allow_multicast(true)
         , transport_should_process(false)
     {
     }
 
     /**
      * Set the enabled value.
+     * Multicast locators are allowed again.
      *
      * @param should_enable Whether this entry should be enabled.
      */
     void enable(bool should_enable)
     {
         enabled = should_enable && remote_guid != c_Guid_Unknown;
+        allow_multicast = true;
     }
 
     /**
@@ -109,6 +112,8 @@ struct LocatorSelectorEntry
     EntryState state;
     //! Indicates whether this entry should be taken into consideration.
     bool enabled;
+    //! Indicates whether multicast locators may be selected when unicast locators are available.
+    bool allow_multicast;
     //! A temporary value for each transport to help optimizing some use cases.
     bool transport_should_process;
 };
@@ -22,6 +22,24 @@ namespace eprosima{
 namespace fastrtps{
 namespace rtps{
 
+/**
+ * Order in which a throughput controller shared by the writers of a participant lets them use its bandwidth,
+ * when several writers are waiting for it.
+ * @ingroup NETWORK_MODULE
+ */
+enum class FlowControllerSchedulerPolicy : int32_t
+{
+    //! Writers use the bandwidth in the order they request it.
+    FIFO,
+    //! Writers waiting for bandwidth share it equally.
+    ROUND_ROBIN,
+    //! Writers with a higher priority (lower value of property fastdds.sfc.priority) are served first.
+    HIGH_PRIORITY,
+    //! Writers whose next sample has the earliest deadline (source timestamp plus WriterAttributes::send_deadline)
+    //! are served first.
+    EARLIEST_DEADLINE_FIRST
+};
+
 /**
  * Descriptor for a Throughput Controller, containing all constructor information
  * for it.
@@ -33,6 +51,8 @@ struct ThroughputControllerDescriptor
     uint32_t bytesPerPeriod;
     //! Window of time in which no more than 'bytesPerPeriod' bytes are allowed.
     uint32_t periodMillisecs;
+    //! Order in which writers sharing this controller use its bandwidth. Only used by participant controllers.
+    FlowControllerSchedulerPolicy scheduler;
 
     RTPS_DllAPI ThroughputControllerDescriptor();
     RTPS_DllAPI ThroughputControllerDescriptor(uint32_t size, uint32_t time);
@@ -40,7 +60,8 @@ struct ThroughputControllerDescriptor
     bool operator==(const ThroughputControllerDescriptor& b) const
     {
         return (this->bytesPerPeriod == b.bytesPerPeriod) &&
-               (this->periodMillisecs == b.periodMillisecs);
+               (this->periodMillisecs == b.periodMillisecs) &&
+               (this->scheduler == b.scheduler);
     }
 };
 
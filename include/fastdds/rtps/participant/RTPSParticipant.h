@@ -194,6 +194,14 @@ public:
 
     ResourceEvent& get_resource_event() const;
 
+    /**
+     * Retrieves the event resource processing the timed events of an endpoint.
+     * @param endpoint_guid GUID of the endpoint.
+     * @return Reference to the event resource assigned to the endpoint.
+     */
+    ResourceEvent& get_resource_event(
+            const GUID_t& endpoint_guid) const;
+
     /**
      * @brief A method to retrieve the built-in writer liveliness protocol
      * @return Writer liveliness protocol
@@ -28,6 +28,8 @@
 #include <fastrtps/utils/TimedConditionVariable.hpp>
 #include "../history/ReaderHistory.h"
 
+#include <memory>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -39,6 +41,7 @@ class WriterProxy;
 struct CacheChange_t;
 struct ReaderHistoryState;
 class WriterProxyData;
+class IntraprocessDeliveryQueue;
 
 /**
  * Class RTPSReader, manages the reception of data from its matched writers.
@@ -162,6 +165,25 @@ public:
             const SequenceNumber_t& gapStart,
             const SequenceNumberSet_t& gapList) = 0;
 
+    /**
+     * Queue used by writers on the same process to deliver their messages to this reader.
+     * @return nullptr when writers on the same process should call the process methods directly.
+     */
+    IntraprocessDeliveryQueue* intraprocess_queue() const
+    {
+        return intraprocess_queue_.get();
+    }
+
+    /**
+     * Called by the intraprocess delivery queue after processing the messages of a writer on the same process,
+     * so the reader reports to the writer which changes it has received.
+     * @param writer_guid GUID of the writer whose messages were processed.
+     */
+    RTPS_DllAPI virtual void intraprocess_messages_processed(
+            const GUID_t& /*writer_guid*/)
+    {
+    }
+
     /**
      * Method to indicate the reader that some change has been removed due to HistoryQos requirements.
      * @param change Pointer to the CacheChange_t.
@@ -323,6 +345,12 @@ protected:
             const GUID_t& persistence_guid,
             const SequenceNumber_t& seq);
 
+    /*!
+     * @brief Stop processing the messages queued by writers on the same process.
+     * Should be called at the beginning of the destructor of the final reader classes.
+     */
+    void stop_intraprocess_delivery();
+
     /*!
      * @brief Search if there is a CacheChange_t, giving SequenceNumber_t and writer GUID_t,
      * waiting to be completed because it is fragmented.
@@ -366,6 +394,9 @@ protected:
     //! The liveliness lease duration of this reader
     Duration_t liveliness_lease_duration_;
 
+    //! Queue of messages from writers on the same process, when they are processed on a thread of their own
+    std::unique_ptr<IntraprocessDeliveryQueue> intraprocess_queue_;
+
 private:
 
     RTPSReader& operator =(
@@ -373,7 +404,8 @@ private:
 
     void init(
             const std::shared_ptr<IPayloadPool>& payload_pool,
-            const std::shared_ptr<IChangePool>& change_pool);
+            const std::shared_ptr<IChangePool>& change_pool,
+            const ReaderAttributes& att);
 
 };
 
@@ -151,6 +151,14 @@ public:
             const SequenceNumber_t& gapStart,
             const SequenceNumberSet_t& gapList) override;
 
+    /**
+     * Sends an ACKNACK to a writer on the same process, reporting the changes received through the intraprocess
+     * delivery queue and the ones still missing.
+     * @param writer_guid GUID of the writer whose messages were processed.
+     */
+    void intraprocess_messages_processed(
+            const GUID_t& writer_guid) override;
+
     /**
      * Method to indicate the reader that some change has been removed due to HistoryQos requirements.
      * @param change Pointer to the CacheChange_t.
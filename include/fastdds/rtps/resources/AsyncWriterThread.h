@@ -19,31 +19,50 @@
 #ifndef _FASTDDS_RTPS_RESOURCES_ASYNCWRITERTHREAD_H_
 #define _FASTDDS_RTPS_RESOURCES_ASYNCWRITERTHREAD_H_
 
-#include <thread>
-#include <atomic>
-#include <list>
+#include <memory>
+#include <vector>
 
+#include <fastdds/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/resources/AsyncInterestTree.h>
-#include <fastrtps/utils/TimedMutex.hpp>
-#include <fastrtps/utils/TimedConditionVariable.hpp>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class EndpointThreadMapping;
 class RTPSWriter;
 
 /**
- * @brief This static class owns a thread that manages asynchronous writes.
+ * @brief This class owns the threads that manage asynchronous writes.
  * Asynchronous writes happen directly (when using an async writer) and
  * indirectly (when responding to a NACK).
+ *
+ * Each writer is always processed on the same thread, the one with fewest writers when the writer first used it.
  * @ingroup COMMON_MODULE
  */
 class AsyncWriterThread
 {
 public:
 
-    AsyncWriterThread() = default;
+    //! Statistics about the writers processed by one of the threads.
+    struct ThreadStatistics
+    {
+        //! Number of writers processed on the last time the thread was woken up.
+        uint32_t last_queue_depth = 0;
+        //! Maximum number of writers processed on a single time the thread was woken up.
+        uint32_t max_queue_depth = 0;
+        //! Number of writers processed since the thread was created.
+        uint64_t processed_writers = 0;
+    };
+
+    /*!
+     * @param allocation Number of threads, and how writers are assigned to them.
+     * @param thread_settings OS settings applied to the threads processing the asynchronous writers.
+     */
+    explicit AsyncWriterThread(
+            const AsyncWriterThreadsAllocationAttributes& allocation = AsyncWriterThreadsAllocationAttributes(),
+            const fastdds::rtps::ThreadSettings& thread_settings = fastdds::rtps::ThreadSettings());
 
     ~AsyncWriterThread();
 
@@ -73,23 +92,54 @@ public:
         RTPSWriter* interested_writer,
         const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
 
+    /*!
+     * @return Number of threads processing asynchronous writers.
+     */
+    size_t thread_count() const
+    {
+        return workers_.size();
+    }
+
+    /*!
+     * @param thread_index Index of the thread, lower than thread_count().
+     * @return Statistics about the writers processed by the thread.
+     */
+    ThreadStatistics get_statistics(
+        size_t thread_index) const;
+
+    /*!
+     * @param writer Asynchronous writer.
+     * @return Index of the thread processing the writer, lower than thread_count().
+     */
+    size_t thread_of(
+        const RTPSWriter* writer);
+
 private:
 
     AsyncWriterThread(const AsyncWriterThread&) = delete;
     const AsyncWriterThread& operator=(const AsyncWriterThread&) = delete;
 
+    //! State of each thread
+    struct Worker;
+
+    //! @brief Selects the thread processing a writer
+    Worker& worker_for(
+        const RTPSWriter* writer);
+
+    //! @brief Signals a thread that it has writers to process, creating it if necessary
+    void wake_up(
+        Worker& worker);
+
     //! @brief runs main method
-    void run();
+    void run(
+        Worker& worker);
 
-    std::thread* thread_ = nullptr;
-    RecursiveTimedMutex condition_variable_mutex_;
+    fastdds::rtps::ThreadSettings thread_settings_;
 
-    //! List of asynchronous writers.
-    AsyncInterestTree interestTree_;
+    std::vector<std::unique_ptr<Worker>> workers_;
 
-    bool running_ = false;
-    bool run_scheduled_ = false;
-    TimedConditionVariable cv_;
+    //! Thread of each writer
+    std::unique_ptr<EndpointThreadMapping> mapping_;
 };
 
 } // namespace rtps
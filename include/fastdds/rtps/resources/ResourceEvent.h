@@ -22,6 +22,7 @@
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastrtps/utils/TimedMutex.hpp>
 #include <fastrtps/utils/TimedConditionVariable.hpp>
 
@@ -49,8 +50,10 @@ public:
 
     /*!
      * @brief Method to initialize the internal thread.
+     * @param thread_settings OS settings applied to the internal thread.
      */
-    void init_thread();
+    void init_thread(
+            const fastdds::rtps::ThreadSettings& thread_settings = fastdds::rtps::ThreadSettings());
 
     /*!
      * @brief This method informs that a TimedEventImpl has been created.
@@ -117,15 +120,21 @@ private:
     //! Collection of events pending update action.
     std::vector<TimedEventImpl*> pending_timers_;
 
-    //! Collection of registered events waiting completion.
+    //! Binary min-heap of registered events waiting completion, ordered by trigger time.
     std::vector<TimedEventImpl*> active_timers_;
 
+    //! Collection of events being triggered by the execution thread.
+    std::vector<TimedEventImpl*> due_timers_;
+
     //! Current time as seen by the execution thread.
     std::chrono::steady_clock::time_point current_time_;
 
     //! Execution thread.
     std::thread thread_;
 
+    //! OS settings of the execution thread.
+    fastdds::rtps::ThreadSettings thread_settings_;
+
     /*!
      * @brief Registers a new TimedEventImpl object in the internal queue to be processed.
      * Non thread safe.
@@ -138,8 +147,30 @@ private:
     //! Method called by the internal thread.
     void event_service();
 
-    //! Sorts waiting timers in ascending order of trigger time.
-    void sort_timers();
+    //! Compares the trigger time of two events on the active timers heap.
+    static bool event_compare(
+            const TimedEventImpl* lhs,
+            const TimedEventImpl* rhs);
+
+    //! Adds an event to the active timers heap.
+    void heap_push(
+            TimedEventImpl* event);
+
+    //! Removes an event from the active timers heap.
+    void heap_remove(
+            TimedEventImpl* event);
+
+    //! Restores the heap order after the trigger time of an event on the active timers heap has changed.
+    void heap_update(
+            TimedEventImpl* event);
+
+    //! Moves up the event at a position of the active timers heap. Returns whether the event was moved.
+    bool heap_sift_up(
+            size_t index);
+
+    //! Moves down the event at a position of the active timers heap.
+    void heap_sift_down(
+            size_t index);
 
     //! Updates internal register of current time.
     void update_current_time();
@@ -152,6 +183,7 @@ private:
     {
         pending_timers_.reserve(timers_count_);
         active_timers_.reserve(timers_count_);
+        due_timers_.reserve(timers_count_);
     }
 
 };
@@ -23,6 +23,8 @@
 #include <fastdds/rtps/common/FragmentNumber.h>
 #include <fastdds/rtps/common/SequenceNumber.h>
 
+#include <tuple>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -66,6 +68,7 @@ public:
         , seq_num_(ch.seq_num_)
         , change_(ch.change_)
         , unsent_fragments_(ch.unsent_fragments_)
+        , next_fragment_to_include_(ch.next_fragment_to_include_)
     {
     }
 
@@ -78,11 +81,7 @@ public:
         , seq_num_(change->sequenceNumber)
         , change_(change)
     {
-        if (change->getFragmentSize() != 0)
-        {
-            unsent_fragments_.base(1u);
-            unsent_fragments_.add_range(1u, change->getFragmentCount() + 1u);
-        }
+        markAllFragmentsAsUnsent();
     }
 
     ChangeForReader_t(
@@ -106,6 +105,7 @@ public:
         seq_num_ = ch.seq_num_;
         change_ = ch.change_;
         unsent_fragments_ = ch.unsent_fragments_;
+        next_fragment_to_include_ = ch.next_fragment_to_include_;
         return *this;
     }
 
@@ -170,7 +170,7 @@ public:
         if (change_ != nullptr && change_->getFragmentSize() != 0)
         {
             unsent_fragments_.base(1u);
-            unsent_fragments_.add_range(1u, change_->getFragmentCount() + 1u);
+            include_fragments(1u);
         }
     }
 
@@ -179,18 +179,19 @@ public:
     {
         unsent_fragments_.remove(sentFragment);
 
-        if (!unsent_fragments_.empty() && unsent_fragments_.max() < change_->getFragmentCount())
+        // Slide the window to include the fragments that did not fit on it yet
+        if (change_ != nullptr && next_fragment_to_include_ <= change_->getFragmentCount())
         {
-            FragmentNumber_t base = unsent_fragments_.base();
-            FragmentNumber_t max = unsent_fragments_.max();
-            assert(!unsent_fragments_.is_set(base));
-
-            // Update base to first bit set
-            base = unsent_fragments_.min();
-            unsent_fragments_.base_update(base);
+            if (unsent_fragments_.empty())
+            {
+                unsent_fragments_.base(next_fragment_to_include_);
+            }
+            else
+            {
+                unsent_fragments_.base_update(unsent_fragments_.min());
+            }
 
-            // Add all possible fragments
-            unsent_fragments_.add_range(max + 1u, change_->getFragmentCount() + 1u);
+            include_fragments(next_fragment_to_include_);
         }
     }
 
@@ -200,13 +201,31 @@ public:
         FragmentNumber_t other_base = unsentFragments.base();
         if (other_base < unsent_fragments_.base())
         {
-            unsent_fragments_.base_update(other_base);
+            if (unsent_fragments_.empty())
+            {
+                unsent_fragments_.base(other_base);
+            }
+            else
+            {
+                // Fragments moved out of the window will be included again when it slides
+                FragmentNumber_t window_end = other_base + fragment_window_size;
+                if (unsent_fragments_.max() >= window_end && next_fragment_to_include_ > window_end)
+                {
+                    next_fragment_to_include_ = window_end;
+                }
+                unsent_fragments_.base_update(other_base);
+            }
         }
+
+        // Only fragments already sent are added. The ones above the window are still pending.
         unsentFragments.for_each(
             [this](
                 FragmentNumber_t element)
             {
-                unsent_fragments_.add(element);
+                if (element < next_fragment_to_include_)
+                {
+                    unsent_fragments_.add(element);
+                }
             });
     }
 
@@ -225,7 +244,27 @@ private:
     //const CacheChange_t* change_;
     CacheChange_t* change_;
 
+    //! Window of fragments pending to be sent
     FragmentNumberSet_t unsent_fragments_;
+
+    //! First fragment not yet included on the window. This and the following ones are pending to be sent.
+    FragmentNumber_t next_fragment_to_include_ = 1u;
+
+    //! Number of fragments that fit on the window
+    static constexpr uint32_t fragment_window_size = 32u * std::tuple_size<FragmentNumberSet_t::bitmap_type>::value;
+
+    /**
+     * Add to the window the fragments from a given one up to the last fragment of the change, as many as
+     * they fit, and keep track of the first one that did not fit.
+     */
+    void include_fragments(
+            FragmentNumber_t first_fragment)
+    {
+        FragmentNumber_t end_fragment = change_->getFragmentCount() + 1u;
+        FragmentNumber_t window_end = unsent_fragments_.base() + fragment_window_size;
+        unsent_fragments_.add_range(first_fragment, end_fragment);
+        next_fragment_to_include_ = (end_fragment < window_end) ? end_fragment : window_end;
+    }
 };
 
 struct ChangeForReaderCmp
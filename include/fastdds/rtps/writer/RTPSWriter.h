@@ -169,6 +169,15 @@ public:
         return true;
     }
 
+    /**
+     * Tells us if some of the destinations of this writer are outside this process.
+     * @return True when a matched reader or a fixed locator is not on this process.
+     */
+    RTPS_DllAPI virtual bool has_remote_destinations() const
+    {
+        return true;
+    }
+
     /**
      * Update the Attributes of the Writer.
      * @param att New attributes
@@ -429,6 +438,14 @@ protected:
 
     void update_cached_info_nts();
 
+    /**
+     * Enable all matched readers on the locator selector, and select their locators.
+     * Selection is skipped when the locators selected for all readers are still valid, i.e. no reader has been
+     * matched, unmatched or updated since they were selected.
+     * @return true when locators have been selected again, false when the previous selection is kept.
+     */
+    bool select_all_readers_nts();
+
     /**
      * Add a change to the unsent list.
      * @param change Pointer to the change to add.
@@ -128,6 +128,16 @@ public:
             const SequenceNumber_t& seq_num,
             bool& is_irrelevant) const;
 
+    /**
+     * Get the fragments of a specific change that are pending to be sent to this reader.
+     * @param[in]  seq_num Sequence number of the change to be checked.
+     * @param[out] unsent_fragments Window with the fragments pending to be sent.
+     * @return true when the change is marked to be sent, false otherwise.
+     */
+    bool unsent_fragments_for_change(
+            const SequenceNumber_t& seq_num,
+            FragmentNumberSet_t& unsent_fragments) const;
+
     /**
      * Mark all changes up to the one indicated by seq_num as Acknowledged.
      * For instance, when seq_num is 30, changes 1-29 are marked as acknowledged.
@@ -28,13 +28,16 @@
 #include <fastrtps/utils/collections/ResourceLimitedVector.hpp>
 #include <condition_variable>
 #include <mutex>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
+class HeartbeatBackoff;
 class ReaderProxy;
 class TimedEvent;
+class TokenBucket;
 
 /**
  * Class StatefulWriter, specialization of RTPSWriter that maintains information of each matched Reader.
@@ -152,11 +155,17 @@ public:
 
     /**
      * Sends a change directly to a intraprocess reader.
+     * @return true when the reader has already processed the change. Changes pushed to the intraprocess queue of
+     * the reader return false, and are acknowledged by the reader once processed.
      */
     bool intraprocess_delivery(
             CacheChange_t* change,
             ReaderProxy* reader_proxy);
 
+    /**
+     * Sends a GAP for a sequence number directly to a intraprocess reader.
+     * @return true when the reader has already processed the GAP, as with intraprocess_delivery.
+     */
     bool intraprocess_gap(
             ReaderProxy* reader_proxy,
             const SequenceNumber_t& seq_num);
@@ -198,6 +207,11 @@ public:
     bool is_acked_by_all(
             const CacheChange_t* a_change) const override;
 
+    bool has_remote_destinations() const override
+    {
+        return there_are_remote_readers_;
+    }
+
     template <typename Function>
     Function for_each_reader_proxy(
             Function f) const
@@ -250,6 +264,19 @@ public:
         return this->m_heartbeatCount;
     }
 
+    /**
+     * Get the number of periodic heartbeats sent
+     * @return Number of periodic heartbeats sent
+     */
+    uint64_t get_periodic_heartbeats_sent() const;
+
+    /**
+     * Get the number of periodic heartbeats saved by the adaptive heartbeat period, with respect to sending them
+     * with the configured heartbeat period.
+     * @return Number of periodic heartbeats saved
+     */
+    uint64_t get_periodic_heartbeats_saved() const;
+
     /**
      * Get the RTPS participant
      * @return RTPS participant
@@ -405,13 +432,64 @@ private:
             SequenceNumber_t max_sequence,
             bool& activateHeartbeatPeriod);
 
+    /**
+     * Send the fragments of a change that are pending for any of the remote readers it should be sent to.
+     * @param[in]     group Message group where fragments are added.
+     * @param[in]     change Fragmented change to send.
+     * @param[in]     inline_qos Whether inline QoS should be added.
+     * @param[in,out] last_bytes_processed Bytes processed since last heartbeat piggyback.
+     * @param[in,out] sent_size Accumulated size of the fragments sent.
+     * @param[out]    activateHeartbeatPeriod Set to true when the change was fully sent to a reliable reader.
+     * @param[out]    fragments_pending Set to true when there are fragments still pending after this call, also
+     *                when a fragment could not be added to the group.
+     * @return false when sending was stopped by the fragment pacing, true otherwise.
+     */
+    bool send_unsent_fragments_nts_(
+            RTPSMessageGroup& group,
+            CacheChange_t* change,
+            bool inline_qos,
+            uint32_t& last_bytes_processed,
+            uint32_t& sent_size,
+            bool& activateHeartbeatPeriod,
+            bool& fragments_pending);
+
+    //! Schedule the asynchronous sending to be resumed when the fragment pacing allows it.
+    void schedule_fragment_pacing_nts_(
+            uint32_t fragment_size);
+
     bool send_hole_gaps_to_group(
             RTPSMessageGroup& group);
 
+    /**
+     * Send a heartbeat to the local readers with an intraprocess queue which have not acknowledged all their
+     * changes, so they request the missing ones.
+     * @return true when some heartbeat was sent.
+     */
+    bool send_intraprocess_periodic_heartbeats_nts();
+
+    //! Adapt the heartbeat period after a periodic heartbeat has been sent.
+    void periodic_heartbeat_sent_nts();
+
+    //! Go back to the configured heartbeat period, rescheduling the periodic heartbeat if it was backed off.
+    void reset_heartbeat_period_nts();
+
+    //! Reschedule the periodic heartbeat with the configured period, once the backoff has been reset.
+    void restart_heartbeat_period_nts();
+
     void select_all_readers_with_lowmark_below(
             SequenceNumber_t seq,
             RTPSMessageGroup& group);
 
+    //! Recompute the groups of remote readers sharing a multicast locator.
+    void update_multicast_groups_nts();
+
+    /**
+     * Restrict to unicast the readers enabled on the locator selector that are only a small fraction of the readers
+     * on their multicast group.
+     * This way, repairs requested by a few readers of a group are not sent to the whole group.
+     */
+    void apply_multicast_threshold_nts();
+
     //! True to disable piggyback heartbeats
     bool disable_heartbeat_piggyback_;
     //! True to disable positive ACKs
@@ -429,6 +507,26 @@ private:
 
     std::vector<std::unique_ptr<FlowController>> m_controllers;
 
+    //! Adaptation of the heartbeat period to the answers of the readers
+    std::unique_ptr<HeartbeatBackoff> heartbeat_backoff_;
+
+    //! Pacing applied to the fragments of large changes (only set when configured)
+    std::unique_ptr<TokenBucket> fragment_pacing_;
+    //! Event used to resume sending fragments when the pacing allows it
+    TimedEvent* fragment_pacing_event_ = nullptr;
+
+    //! Remote readers sharing a multicast locator
+    struct MulticastGroup
+    {
+        Locator_t locator;
+        std::vector<LocatorSelectorEntry*> entries;
+    };
+
+    //! Groups of remote readers sharing a multicast locator (only computed when a threshold is configured)
+    std::vector<MulticastGroup> multicast_groups_;
+    //! Minimum fraction of the readers of a multicast group a change should be sent to for multicast to be used
+    double multicast_threshold_ = 0.0;
+
     bool there_are_remote_readers_ = false;
     bool there_are_local_readers_ = false;
 
@@ -144,6 +144,11 @@ public:
     bool is_acked_by_all(
             const CacheChange_t* change) const override;
 
+    bool has_remote_destinations() const override
+    {
+        return there_are_remote_readers_ || !fixed_locators_.empty();
+    }
+
     bool try_remove_change(
             const std::chrono::steady_clock::time_point&,
             std::unique_lock<RecursiveTimedMutex>&) override;
@@ -109,6 +109,17 @@ public:
     virtual bool remove_change_g(
             rtps::CacheChange_t* a_change);
 
+    /**
+     * Remove a specific change from the history, together with the typed sample it shared.
+     * No Thread Safe
+     * @param removal iterator to the change for removal
+     * @param release specifies if the change should be return to the pool
+     * @return iterator to the next change if any
+     */
+    iterator remove_change_nts(
+            const_iterator removal,
+            bool release = true) override;
+
     bool remove_instance_changes(
             const rtps::InstanceHandle_t& handle,
             const rtps::SequenceNumber_t& seq_up_to);
@@ -32,6 +32,8 @@
 
 #include <chrono>
 #include <functional>
+#include <map>
+#include <memory>
 
 namespace eprosima {
 namespace fastrtps {
@@ -127,8 +129,26 @@ public:
             rtps::InstanceHandle_t& handle,
             std::chrono::steady_clock::time_point& next_deadline_us);
 
+    /**
+     * Remove a specific change from the history, together with its typed sample.
+     * No Thread Safe
+     * @param removal iterator to the change for removal
+     * @param release specifies if the change should be return to the pool
+     * @return iterator to the next change if any
+     */
+    iterator remove_change_nts(
+            const_iterator removal,
+            bool release = true) override;
+
 private:
 
+    //! Sample shared in its typed form by a writer on the same process
+    struct TypedSample
+    {
+        std::shared_ptr<void> sample;
+        fastdds::dds::TopicDataType* type = nullptr;
+    };
+
     using t_m_Inst_Caches = std::map<rtps::InstanceHandle_t, KeyedChanges>;
 
     //!Map where keys are instance handles and values vectors of cache changes
@@ -152,6 +172,9 @@ private:
     /// Function processing a received change
     std::function<bool(rtps::CacheChange_t*, size_t)> receive_fn_;
 
+    //!Typed samples of the changes whose writer skipped the serialization
+    std::map<rtps::CacheChange_t*, TypedSample> typed_samples_;
+
     /**
      * @brief Method that finds a key in m_keyedChanges or tries to add it if not found
      * @param a_change The change to get the key from
@@ -209,6 +232,25 @@ private:
             uint32_t ownership_strength,
             void* data,
             SampleInfo_t* info);
+
+    /**
+     * Take the typed sample of a received change, when its writer skipped the serialization.
+     * @param change Pointer to the change.
+     * @return false if the writer skipped the serialization but no longer has the sample.
+     */
+    bool take_typed_sample(
+            rtps::CacheChange_t* change);
+
+    /**
+     * Fill the data of a change shared in its typed form by a writer on the same process.
+     * The sample is copied when the writer uses the same type support, and converted through serialization otherwise.
+     * @param typed_sample Typed sample of the change.
+     * @param data Pointer to the data to fill.
+     * @return true if the data was filled.
+     */
+    bool read_typed_sample(
+            const TypedSample& typed_sample,
+            void* data);
 };
 
 } // namespace fastrtps
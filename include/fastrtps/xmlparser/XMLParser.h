@@ -508,6 +508,21 @@ protected:
             rtps::SendBuffersAllocationAttributes& allocation,
             uint8_t ident);
 
+    RTPS_DllAPI static XMLP_ret getXMLEventThreadsAllocationAttributes(
+            tinyxml2::XMLElement* elem,
+            rtps::EventThreadsAllocationAttributes& allocation,
+            uint8_t ident);
+
+    RTPS_DllAPI static XMLP_ret getXMLAsyncWriterThreadsAllocationAttributes(
+            tinyxml2::XMLElement* elem,
+            rtps::AsyncWriterThreadsAllocationAttributes& allocation,
+            uint8_t ident);
+
+    RTPS_DllAPI static XMLP_ret getXMLThreadSettings(
+            tinyxml2::XMLElement* elem,
+            fastdds::rtps::ThreadSettings& thread_settings,
+            uint8_t ident);
+
     RTPS_DllAPI static XMLP_ret getXMLDiscoverySettings(
             tinyxml2::XMLElement* elem,
             rtps::DiscoverySettings& settings,
@@ -114,6 +114,7 @@ extern const char* PART_ID;
 extern const char* IP4_TO_SEND;
 extern const char* IP6_TO_SEND;
 extern const char* THROUGHPUT_CONT;
+extern const char* DESTINATION_THROUGHPUT_CONT;
 extern const char* USER_TRANS;
 extern const char* USE_BUILTIN_TRANS;
 extern const char* PROPERTIES_POLICY;
@@ -130,6 +131,19 @@ extern const char* DYNAMIC_LC;
 extern const char* MAX_PROPERTIES;
 extern const char* MAX_USER_DATA;
 extern const char* MAX_PARTITIONS;
+extern const char* EVENT_THREADS;
+extern const char* ISOLATE_BUILTIN_ENDPOINTS;
+extern const char* ASYNC_WRITER_THREADS;
+extern const char* SCHEDULING_POLICY;
+extern const char* PRIORITY;
+extern const char* AFFINITY;
+extern const char* STACK_SIZE;
+extern const char* TIMED_EVENTS_THREAD;
+extern const char* ASYNC_WRITERS_THREAD;
+extern const char* DISCOVERY_SERVER_MATCHING_THREADS;
+extern const char* BUILTIN_TRANSPORTS_RECEPTION_THREADS;
+extern const char* DEFAULT_RECEPTION_THREADS;
+extern const char* THREAD_SETTINGS;
 
 /// Publisher-subscriber attributes
 extern const char* TOPIC;
@@ -249,6 +263,11 @@ extern const char* DEPTH;
 extern const char* ALLOCATED_SAMPLES;
 extern const char* BYTES_PER_SECOND;
 extern const char* PERIOD_MILLISECS;
+extern const char* SCHEDULER;
+extern const char* FIFO;
+extern const char* ROUND_ROBIN;
+extern const char* HIGH_PRIORITY;
+extern const char* EARLIEST_DEADLINE_FIRST;
 extern const char* PORT_BASE;
 extern const char* DOMAIN_ID_GAIN;
 extern const char* PARTICIPANT_ID_GAIN;
@@ -56,13 +56,18 @@ static void set_qos_from_attributes(
     qos.wire_protocol().builtin = attr.builtin;
     qos.wire_protocol().port = attr.port;
     qos.wire_protocol().throughput_controller = attr.throughputController;
+    qos.wire_protocol().destination_throughput_controller = attr.destination_throughput_controller;
     qos.wire_protocol().default_unicast_locator_list = attr.defaultUnicastLocatorList;
     qos.wire_protocol().default_multicast_locator_list = attr.defaultMulticastLocatorList;
     qos.transport().user_transports = attr.userTransports;
     qos.transport().use_builtin_transports = attr.useBuiltinTransports;
     qos.transport().send_socket_buffer_size = attr.sendSocketBufferSize;
     qos.transport().listen_socket_buffer_size = attr.listenSocketBufferSize;
+    qos.transport().builtin_transports_reception_threads = attr.builtin_transports_reception_threads;
     qos.name() = attr.getName();
+    qos.timed_events_thread() = attr.timed_events_thread;
+    qos.async_writers_thread() = attr.async_writers_thread;
+    qos.discovery_server_matching_threads() = attr.discovery_server_matching_threads;
 }
 
 DomainParticipantFactory::DomainParticipantFactory()
@@ -93,12 +93,17 @@ static void set_attributes_from_qos(
     attr.builtin = qos.wire_protocol().builtin;
     attr.port = qos.wire_protocol().port;
     attr.throughputController = qos.wire_protocol().throughput_controller;
+    attr.destination_throughput_controller = qos.wire_protocol().destination_throughput_controller;
     attr.defaultUnicastLocatorList = qos.wire_protocol().default_unicast_locator_list;
     attr.defaultMulticastLocatorList = qos.wire_protocol().default_multicast_locator_list;
     attr.userTransports = qos.transport().user_transports;
     attr.useBuiltinTransports = qos.transport().use_builtin_transports;
     attr.sendSocketBufferSize = qos.transport().send_socket_buffer_size;
     attr.listenSocketBufferSize = qos.transport().listen_socket_buffer_size;
+    attr.builtin_transports_reception_threads = qos.transport().builtin_transports_reception_threads;
+    attr.timed_events_thread = qos.timed_events_thread();
+    attr.async_writers_thread = qos.async_writers_thread();
+    attr.discovery_server_matching_threads = qos.discovery_server_matching_threads();
     attr.userData = qos.user_data().data_vec();
 }
 
@@ -1754,6 +1759,18 @@ void DomainParticipantImpl::set_qos(
     {
         to.name() = from.name();
     }
+    if (first_time && to.timed_events_thread() != from.timed_events_thread())
+    {
+        to.timed_events_thread() = from.timed_events_thread();
+    }
+    if (first_time && to.async_writers_thread() != from.async_writers_thread())
+    {
+        to.async_writers_thread() = from.async_writers_thread();
+    }
+    if (first_time && to.discovery_server_matching_threads() != from.discovery_server_matching_threads())
+    {
+        to.discovery_server_matching_threads() = from.discovery_server_matching_threads();
+    }
 }
 
 fastrtps::types::ReturnCode_t DomainParticipantImpl::check_qos(
@@ -1797,6 +1814,23 @@ bool DomainParticipantImpl::can_qos_be_updated(
         updatable = false;
         logWarning(RTPS_QOS_CHECK, "Participant name cannot be changed after the participant is enabled");
     }
+    if (!(to.timed_events_thread() == from.timed_events_thread()))
+    {
+        updatable = false;
+        logWarning(RTPS_QOS_CHECK, "Timed events thread settings cannot be changed after the participant is enabled");
+    }
+    if (!(to.async_writers_thread() == from.async_writers_thread()))
+    {
+        updatable = false;
+        logWarning(RTPS_QOS_CHECK,
+                "Asynchronous writers thread settings cannot be changed after the participant is enabled");
+    }
+    if (!(to.discovery_server_matching_threads() == from.discovery_server_matching_threads()))
+    {
+        updatable = false;
+        logWarning(RTPS_QOS_CHECK,
+                "Discovery server matching threads settings cannot be changed after the participant is enabled");
+    }
     return updatable;
 }
 
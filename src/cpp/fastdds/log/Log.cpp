@@ -21,6 +21,7 @@
 #include <fastdds/dds/log/StdoutConsumer.hpp>
 #include <fastdds/dds/log/StdoutErrConsumer.hpp>
 #include <fastdds/dds/log/Colors.hpp>
+#include <utils/threading.hpp>
 #include <iostream>
 
 using namespace std;
@@ -78,6 +79,7 @@ void Log::Reset()
     resources_.filenames = false;
     resources_.functions = true;
     resources_.verbosity = Log::Error;
+    resources_.thread_settings = fastdds::rtps::ThreadSettings();
     resources_.consumers.clear();
 #if STDOUTERR_LOG_CONSUMER
     resources_.consumers.emplace_back(new StdoutErrConsumer);
@@ -127,6 +129,17 @@ void Log::Flush()
 
 void Log::run()
 {
+    fastdds::rtps::ThreadSettings thread_settings;
+    {
+        std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
+        thread_settings = resources_.thread_settings;
+    }
+    apply_thread_settings_to_current_thread("log", thread_settings);
+    if (0 != thread_settings.stack_size)
+    {
+        logWarning(SYSTEM, "Stack size cannot be set on thread 'log', using the default one");
+    }
+
     std::unique_lock<std::mutex> guard(resources_.cv_mutex);
 
     while (resources_.logging)
@@ -230,6 +243,13 @@ void Log::KillThread()
     }
 }
 
+void Log::SetThreadConfig(
+        const fastdds::rtps::ThreadSettings& settings)
+{
+    std::unique_lock<std::mutex> configGuard(resources_.config_mutex);
+    resources_.thread_settings = settings;
+}
+
 void Log::QueueLog(
         const std::string& message,
         const Log::Context& context,
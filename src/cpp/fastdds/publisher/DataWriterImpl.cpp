@@ -26,6 +26,7 @@
 #include <fastdds/dds/publisher/Publisher.hpp>
 #include <fastdds/dds/publisher/PublisherListener.hpp>
 
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <fastdds/rtps/writer/StatefulWriter.h>
 
@@ -39,9 +40,12 @@
 #include <fastdds/rtps/resources/TimedEvent.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
 #include <fastdds/core/policy/ParameterSerializer.hpp>
+#include <fastdds/topic/TypedSampleRegistry.hpp>
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
+#include <utils/numa.hpp>
 
+#include <algorithm>
 #include <functional>
 #include <iostream>
 
@@ -110,6 +114,8 @@ ReturnCode_t DataWriterImpl::enable()
     w_att.liveliness_lease_duration = qos_.liveliness().lease_duration;
     w_att.liveliness_announcement_period = qos_.liveliness().announcement_period;
     w_att.matched_readers_allocation = qos_.writer_resource_limits().matched_subscriber_allocation;
+    // Samples are useless after their lifespan expires, and late after the deadline period
+    w_att.send_deadline = std::min(qos_.lifespan().duration, qos_.deadline().period);
 
     // TODO(Ricardo) Remove in future
     // Insert topic_name and partitions
@@ -158,6 +164,23 @@ ReturnCode_t DataWriterImpl::enable()
     // In case it has been loaded from the persistence DB, rebuild instances on history
     history_.rebuild_instances();
 
+    // Samples can only skip serialization when they are not resent to readers matched after writing them
+    const std::string* typed_samples = PropertyPolicyHelper::find_property(qos_.properties(),
+                    "fastdds.intraprocess_typed_samples");
+    if (typed_samples != nullptr && *typed_samples == "true")
+    {
+        share_typed_samples_ = qos_.durability().kind == VOLATILE_DURABILITY_QOS &&
+                qos_.publish_mode().kind == SYNCHRONOUS_PUBLISH_MODE;
+        if (share_typed_samples_)
+        {
+            TypedSampleRegistry::instance().register_writer(writer_->getGuid());
+        }
+        else
+        {
+            logWarning(DATA_WRITER, "Typed samples are only shared by volatile synchronous writers");
+        }
+    }
+
     //TODO(Ricardo) This logic in a class. Then a user of rtps layer can use it.
     if (high_mark_for_frag_ == 0)
     {
@@ -184,14 +207,14 @@ ReturnCode_t DataWriterImpl::enable()
         set_fragment_size_on_change(wparams, *it, high_mark_for_frag_);
     }
 
-    deadline_timer_ = new TimedEvent(publisher_->get_participant()->get_resource_event(),
+    deadline_timer_ = new TimedEvent(publisher_->rtps_participant()->get_resource_event(writer_->getGuid()),
                     [&]() -> bool
                     {
                         return deadline_missed();
                     },
                     qos_.deadline().period.to_ns() * 1e-6);
 
-    lifespan_timer_ = new TimedEvent(publisher_->get_participant()->get_resource_event(),
+    lifespan_timer_ = new TimedEvent(publisher_->rtps_participant()->get_resource_event(writer_->getGuid()),
                     [&]() -> bool
                     {
                         return lifespan_expired();
@@ -222,6 +245,10 @@ DataWriterImpl::~DataWriterImpl()
     if (writer_ != nullptr)
     {
         logInfo(PUBLISHER, guid().entityId << " in topic: " << type_->getName());
+        if (share_typed_samples_)
+        {
+            TypedSampleRegistry::instance().unregister_writer(writer_->getGuid());
+        }
         RTPSDomain::removeRTPSWriter(writer_);
         release_payload_pool();
     }
@@ -455,10 +482,25 @@ bool DataWriterImpl::perform_create_new_change(
     std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
 #endif // if HAVE_STRICT_REALTIME
     {
-        CacheChange_t* ch = writer_->new_change(type_->getSerializedSizeProvider(data), change_kind, handle);
+        std::shared_ptr<void> typed_sample;
+        bool skip_serialization = change_kind == ALIVE && share_typed_sample(data, typed_sample);
+        const std::function<uint32_t()> size_provider = skip_serialization ?
+                []() -> uint32_t
+                {
+                    return 0;
+                } : type_->getSerializedSizeProvider(data);
+
+        CacheChange_t* ch = writer_->new_change(size_provider, change_kind, handle);
         if (ch != nullptr)
         {
-            if (change_kind == ALIVE)
+            if (skip_serialization)
+            {
+                // Readers find the sample by the sequence number the history is about to give to the change
+                ch->serializedPayload.length = 0;
+                TypedSampleRegistry::instance().add(writer_->getGuid(), history_.next_sequence_number(),
+                        std::move(typed_sample), type_.get());
+            }
+            else if (change_kind == ALIVE)
             {
                 //If these two checks are correct, we asume the cachechange is valid and thwn we can write to it.
                 if (!type_->serialize(data, &ch->serializedPayload))
@@ -473,6 +515,10 @@ bool DataWriterImpl::perform_create_new_change(
 
             if (!this->history_.add_pub_change(ch, wparams, lock, max_blocking_time))
             {
+                if (skip_serialization)
+                {
+                    TypedSampleRegistry::instance().remove(writer_->getGuid(), history_.next_sequence_number());
+                }
                 writer_->release_change(ch);
                 return false;
             }
@@ -513,6 +559,31 @@ bool DataWriterImpl::perform_create_new_change(
     return false;
 }
 
+bool DataWriterImpl::share_typed_sample(
+        void* data,
+        std::shared_ptr<void>& sample)
+{
+    // Readers on other processes need the serialized payload
+    if (!share_typed_samples_ || writer_->has_remote_destinations())
+    {
+        return false;
+    }
+
+    // The copy keeps the type alive, as readers may hold it after this writer is deleted
+    TypeSupport type = type_;
+    sample.reset(type->createData(), [type](void* p)
+            {
+                type->deleteData(p);
+            });
+    if (!sample || !type->copyData(sample.get(), data))
+    {
+        sample.reset();
+        return false;
+    }
+
+    return true;
+}
+
 bool DataWriterImpl::create_new_change_with_params(
         ChangeKind_t changeKind,
         void* data,
@@ -1182,7 +1253,15 @@ std::shared_ptr<IPayloadPool> DataWriterImpl::get_payload_pool()
 
     if (!payload_pool_)
     {
-        payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config);
+        // Endpoints on a NUMA node can use payloads allocated on it, instead of sharing them with the whole process
+        int32_t numa_node = unknown_numa_node;
+        const std::string* numa_property = PropertyPolicyHelper::find_property(qos_.properties(), "fastdds.numa_node");
+        if (numa_property != nullptr)
+        {
+            numa_node = parse_numa_node(*numa_property);
+        }
+
+        payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config, numa_node);
     }
 
     payload_pool_->reserve_history(config, false);
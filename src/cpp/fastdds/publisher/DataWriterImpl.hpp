@@ -284,6 +284,9 @@ protected:
 
     uint32_t high_mark_for_frag_;
 
+    //! Whether samples may be handed to readers on the same process without serializing them
+    bool share_typed_samples_ = false;
+
     //! A timer used to check for deadlines
     fastrtps::rtps::TimedEvent* deadline_timer_ = nullptr;
 
@@ -370,6 +373,16 @@ protected:
             fastrtps::rtps::ChangeKind_t change_kind,
             void* data);
 
+    /**
+     * @brief Copy a sample to be shared with the readers on the same process instead of serializing it
+     * @param data Pointer to the data written by the user
+     * @param sample Shared copy of the data
+     * @return true when all the destinations are on this process and the type supports copying the data
+     */
+    bool share_typed_sample(
+            void* data,
+            std::shared_ptr<void>& sample);
+
     bool perform_create_new_change(
             fastrtps::rtps::ChangeKind_t change_kind,
             void* data,
@@ -26,6 +26,7 @@
 #include <fastdds/subscriber/SubscriberImpl.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/reader/StatefulReader.h>
 #include <fastdds/rtps/RTPSDomain.h>
@@ -39,6 +40,7 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
+#include <utils/numa.hpp>
 
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
@@ -173,14 +175,14 @@ ReturnCode_t DataReaderImpl::enable()
 
     reader_ = reader;
 
-    deadline_timer_ = new TimedEvent(subscriber_->get_participant()->get_resource_event(),
+    deadline_timer_ = new TimedEvent(subscriber_->rtps_participant()->get_resource_event(reader_->getGuid()),
                     [&]() -> bool
                     {
                         return deadline_missed();
                     },
                     qos_.deadline().period.to_ns() * 1e-6);
 
-    lifespan_timer_ = new TimedEvent(subscriber_->get_participant()->get_resource_event(),
+    lifespan_timer_ = new TimedEvent(subscriber_->rtps_participant()->get_resource_event(reader_->getGuid()),
                     [&]() -> bool
                     {
                         return lifespan_expired();
@@ -995,7 +997,15 @@ std::shared_ptr<IPayloadPool> DataReaderImpl::get_payload_pool()
 
     if (!payload_pool_)
     {
-        payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config);
+        // Endpoints on a NUMA node can use payloads allocated on it, instead of sharing them with the whole process
+        int32_t numa_node = unknown_numa_node;
+        const std::string* numa_property = PropertyPolicyHelper::find_property(qos_.properties(), "fastdds.numa_node");
+        if (numa_property != nullptr)
+        {
+            numa_node = parse_numa_node(*numa_property);
+        }
+
+        payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config, numa_node);
     }
 
     payload_pool_->reserve_history(config, true);
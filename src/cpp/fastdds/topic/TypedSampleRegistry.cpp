@@ -0,0 +1,126 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * TypedSampleRegistry.cpp
+ *
+ */
+
+#include <fastdds/topic/TypedSampleRegistry.hpp>
+
+#include <utility>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+using fastrtps::rtps::GUID_t;
+using fastrtps::rtps::SequenceNumber_t;
+
+TypedSampleRegistry& TypedSampleRegistry::instance()
+{
+    static TypedSampleRegistry registry;
+    return registry;
+}
+
+void TypedSampleRegistry::register_writer(
+        const GUID_t& writer_guid)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    writers_[writer_guid];
+}
+
+void TypedSampleRegistry::unregister_writer(
+        const GUID_t& writer_guid)
+{
+    // Samples are destroyed out of the lock, as they call the type support
+    WriterSamples samples;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = writers_.find(writer_guid);
+        if (it == writers_.end())
+        {
+            return;
+        }
+        samples.swap(it->second);
+        writers_.erase(it);
+    }
+}
+
+bool TypedSampleRegistry::add(
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& sequence_number,
+        std::shared_ptr<void> sample,
+        TopicDataType* type)
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = writers_.find(writer_guid);
+    if (it == writers_.end())
+    {
+        return false;
+    }
+    it->second[sequence_number] = TypedSample{std::move(sample), type};
+    return true;
+}
+
+void TypedSampleRegistry::remove(
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& sequence_number)
+{
+    std::shared_ptr<void> sample;
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = writers_.find(writer_guid);
+        if (it == writers_.end())
+        {
+            return;
+        }
+        auto sample_it = it->second.find(sequence_number);
+        if (sample_it != it->second.end())
+        {
+            sample.swap(sample_it->second.sample);
+            it->second.erase(sample_it);
+        }
+    }
+}
+
+bool TypedSampleRegistry::find(
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& sequence_number,
+        std::shared_ptr<void>& sample,
+        TopicDataType*& type) const
+{
+    std::lock_guard<std::mutex> guard(mutex_);
+    auto it = writers_.find(writer_guid);
+    if (it == writers_.end())
+    {
+        return false;
+    }
+    auto sample_it = it->second.find(sequence_number);
+    if (sample_it != it->second.end())
+    {
+        sample = sample_it->second.sample;
+        type = sample_it->second.type;
+    }
+    else
+    {
+        sample.reset();
+        type = nullptr;
+    }
+    return true;
+}
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
@@ -0,0 +1,121 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * TypedSampleRegistry.hpp
+ *
+ */
+
+#ifndef _FASTDDS_TYPEDSAMPLEREGISTRY_HPP_
+#define _FASTDDS_TYPEDSAMPLEREGISTRY_HPP_
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+class TopicDataType;
+
+/**
+ * Samples that writers hand in their typed form to the readers on the same process, instead of serializing them.
+ *
+ * The changes of those samples have no payload. A writer adds the sample of each change before adding the change
+ * to its history, and removes it when the change leaves the history. Readers take their own reference to the
+ * sample when they receive the change, so it lives as long as any of them keeps the change.
+ */
+class TypedSampleRegistry
+{
+public:
+
+    //! @return The registry of the process.
+    static TypedSampleRegistry& instance();
+
+    /**
+     * Start sharing the samples of a writer.
+     * @param writer_guid GUID of the writer.
+     */
+    void register_writer(
+            const fastrtps::rtps::GUID_t& writer_guid);
+
+    /**
+     * Stop sharing the samples of a writer, removing the ones it still had.
+     * @param writer_guid GUID of the writer.
+     */
+    void unregister_writer(
+            const fastrtps::rtps::GUID_t& writer_guid);
+
+    /**
+     * Add the sample of a change.
+     * @param writer_guid GUID of the writer of the change.
+     * @param sequence_number Sequence number of the change.
+     * @param sample Copy of the sample.
+     * @param type Type support of the writer, which created the sample.
+     * @return false when the writer is not registered.
+     */
+    bool add(
+            const fastrtps::rtps::GUID_t& writer_guid,
+            const fastrtps::rtps::SequenceNumber_t& sequence_number,
+            std::shared_ptr<void> sample,
+            TopicDataType* type);
+
+    /**
+     * Remove the sample of a change. Readers which already took it keep their reference.
+     * @param writer_guid GUID of the writer of the change.
+     * @param sequence_number Sequence number of the change.
+     */
+    void remove(
+            const fastrtps::rtps::GUID_t& writer_guid,
+            const fastrtps::rtps::SequenceNumber_t& sequence_number);
+
+    /**
+     * Take a reference to the sample of a change.
+     * @param writer_guid GUID of the writer of the change.
+     * @param sequence_number Sequence number of the change.
+     * @param [out] sample Copy of the sample, empty when the writer already removed it.
+     * @param [out] type Type support which created the sample.
+     * @return false when the writer is not registered, so its changes carry a serialized payload.
+     */
+    bool find(
+            const fastrtps::rtps::GUID_t& writer_guid,
+            const fastrtps::rtps::SequenceNumber_t& sequence_number,
+            std::shared_ptr<void>& sample,
+            TopicDataType*& type) const;
+
+private:
+
+    struct TypedSample
+    {
+        std::shared_ptr<void> sample;
+        TopicDataType* type;
+    };
+
+    using WriterSamples = std::map<fastrtps::rtps::SequenceNumber_t, TypedSample>;
+
+    //! Samples of each registered writer
+    std::map<fastrtps::rtps::GUID_t, WriterSamples> writers_;
+
+    mutable std::mutex mutex_;
+};
+
+} // namespace dds
+} // namespace fastdds
+} // namespace eprosima
+
+#endif /* _FASTDDS_TYPEDSAMPLEREGISTRY_HPP_ */
@@ -45,6 +45,8 @@
 
 #include <fastdds/dds/log/Log.hpp>
 
+#include <algorithm>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 
@@ -183,6 +185,7 @@ Publisher* ParticipantImpl::createPublisher(
     watt.endpoint.reliabilityKind = att.qos.m_reliability.kind == RELIABLE_RELIABILITY_QOS ? RELIABLE : BEST_EFFORT;
     watt.endpoint.topicKind = att.topic.topicKind;
     watt.endpoint.unicastLocatorList = att.unicastLocatorList;
+    watt.send_deadline = std::min(att.qos.m_lifespan.duration, att.qos.m_deadline.period);
     watt.endpoint.remoteLocatorList = att.remoteLocatorList;
     watt.mode = att.qos.m_publishMode.kind ==
             eprosima::fastrtps::SYNCHRONOUS_PUBLISH_MODE ? SYNCHRONOUS_WRITER : ASYNCHRONOUS_WRITER;
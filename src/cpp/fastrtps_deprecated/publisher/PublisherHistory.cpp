@@ -25,6 +25,7 @@
 #include <fastrtps_deprecated/publisher/PublisherImpl.h>
 
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <fastdds/topic/TypedSampleRegistry.hpp>
 
 #include <fastdds/dds/log/Log.hpp>
 
@@ -320,6 +321,20 @@ bool PublisherHistory::remove_change_g(
     return remove_change_pub(a_change);
 }
 
+PublisherHistory::iterator PublisherHistory::remove_change_nts(
+        const_iterator removal,
+        bool release)
+{
+    // Changes without payload had their sample shared with the readers on this process
+    if (mp_writer != nullptr && removal != changesEnd() &&
+            (*removal)->kind == ALIVE && (*removal)->serializedPayload.length == 0)
+    {
+        fastdds::dds::TypedSampleRegistry::instance().remove((*removal)->writerGUID, (*removal)->sequenceNumber);
+    }
+
+    return WriterHistory::remove_change_nts(removal, release);
+}
+
 bool PublisherHistory::remove_instance_changes(
         const rtps::InstanceHandle_t& handle,
         const rtps::SequenceNumber_t& seq_up_to)
@@ -22,6 +22,7 @@
 
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <rtps/reader/WriterProxy.h>
+#include <fastdds/topic/TypedSampleRegistry.hpp>
 
 #include <fastdds/dds/topic/TopicDataType.hpp>
 #include <fastdds/dds/log/Log.hpp>
@@ -34,6 +35,7 @@ namespace fastrtps {
 using namespace rtps;
 
 using eprosima::fastdds::dds::TopicDataType;
+using eprosima::fastdds::dds::TypedSampleRegistry;
 
 static void get_sample_info(
         SampleInfo_t* info,
@@ -127,7 +129,47 @@ bool SubscriberHistory::received_change(
     }
 
     std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
-    return receive_fn_(a_change, unknown_missing_changes_up_to);
+    if (!take_typed_sample(a_change))
+    {
+        return false;
+    }
+
+    if (!receive_fn_(a_change, unknown_missing_changes_up_to))
+    {
+        typed_samples_.erase(a_change);
+        return false;
+    }
+
+    return true;
+}
+
+bool SubscriberHistory::take_typed_sample(
+        CacheChange_t* a_change)
+{
+    // Changes removed by the reader without going through this history may be reused with a stale entry
+    typed_samples_.erase(a_change);
+
+    if (a_change->kind != ALIVE || a_change->serializedPayload.length != 0)
+    {
+        return true;
+    }
+
+    TypedSample typed_sample;
+    if (!TypedSampleRegistry::instance().find(a_change->writerGUID, a_change->sequenceNumber,
+            typed_sample.sample, typed_sample.type))
+    {
+        return true;
+    }
+
+    if (!typed_sample.sample)
+    {
+        logWarning(SUBSCRIBER, "Typed sample " << a_change->sequenceNumber << " of writer " << a_change->writerGUID
+                                               << " removed before reception, discarding it");
+        return false;
+    }
+
+    typed_samples_.emplace(a_change, std::move(typed_sample));
+    return true;
 }
 
 bool SubscriberHistory::received_change_keep_all_no_key(
@@ -315,7 +357,11 @@ bool SubscriberHistory::deserialize_change(
 {
     if (change->kind == ALIVE)
     {
-        if (!type_->deserialize(&change->serializedPayload, data))
+        auto typed_sample = typed_samples_.find(change);
+        bool filled = typed_sample != typed_samples_.end() ?
+                read_typed_sample(typed_sample->second, data) :
+                type_->deserialize(&change->serializedPayload, data);
+        if (!filled)
         {
             logError(SUBSCRIBER, "Deserialization of data failed");
             return false;
@@ -341,6 +387,33 @@ bool SubscriberHistory::deserialize_change(
     return true;
 }
 
+bool SubscriberHistory::read_typed_sample(
+        const TypedSample& typed_sample,
+        void* data)
+{
+    if (typed_sample.type == type_)
+    {
+        return type_->copyData(data, typed_sample.sample.get());
+    }
+
+    // Different type support instances may not share the representation of the data
+    SerializedPayload_t payload(typed_sample.type->getSerializedSizeProvider(typed_sample.sample.get())());
+    return typed_sample.type->serialize(typed_sample.sample.get(), &payload) &&
+           type_->deserialize(&payload, data);
+}
+
+SubscriberHistory::iterator SubscriberHistory::remove_change_nts(
+        const_iterator removal,
+        bool release)
+{
+    if (removal != changesEnd() && !typed_samples_.empty())
+    {
+        typed_samples_.erase(*removal);
+    }
+
+    return ReaderHistory::remove_change_nts(removal, release);
+}
+
 bool SubscriberHistory::readNextData(
         void* data,
         SampleInfo_t* info,
@@ -254,6 +254,7 @@ bool BuiltinProtocols::removeLocalWriter(
     }
     if (mp_PDP != nullptr && mp_PDP->getEDP() != nullptr)
     {
+        mp_PDP->getEDP()->unregister_local_writer(W);
         ok |= mp_PDP->getEDP()->removeLocalWriter(W);
     }
     return ok;
@@ -269,6 +270,7 @@ bool BuiltinProtocols::removeLocalReader(
     }
     if (mp_PDP != nullptr && mp_PDP->getEDP() != nullptr)
     {
+        mp_PDP->getEDP()->unregister_local_reader(R);
         ok |= mp_PDP->getEDP()->removeLocalReader(R);
     }
     return ok;
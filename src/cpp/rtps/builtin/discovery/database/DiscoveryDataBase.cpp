@@ -91,14 +91,18 @@ std::vector<fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::clear()
 
     /* Clear list of dirty topics */
     dirty_topics_.clear();
+    dirty_topics_index_.clear();
 
     /* Clear disposals list */
     disposals_.clear();
 
     /* Clear to_send collections */
     pdp_to_send_.clear();
+    pdp_to_send_index_.clear();
     edp_publications_to_send_.clear();
+    edp_publications_to_send_index_.clear();
     edp_subscriptions_to_send_.clear();
+    edp_subscriptions_to_send_index_.clear();
 
     /* Clear writers_ */
     for (auto writers_it = writers_.begin(); writers_it != writers_.end();)
@@ -125,6 +129,7 @@ std::vector<fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::clear()
     std::vector<fastrtps::rtps::CacheChange_t*> leftover_changes = changes_to_release_;
     changes_to_release_.clear();
     servers_.clear();
+    server_interests_.clear();
 
     /* Return the collection of changes that are no longer owned by the database */
     return leftover_changes;
@@ -307,10 +312,7 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been processed
         std::unique_lock<std::recursive_mutex> lock(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        write_backup_record_(*change);
     }
 
     if (!enabled_)
@@ -339,10 +341,7 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been process
         std::unique_lock<std::recursive_mutex> lock(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        write_backup_record_(*change);
     }
 
     if (!enabled_)
@@ -391,6 +390,7 @@ void DiscoveryDataBase::clear_pdp_to_send()
     // lock(exclusive mode) mutex locally
     std::unique_lock<std::recursive_mutex> lock(mutex_);
     pdp_to_send_.clear();
+    pdp_to_send_index_.clear();
 }
 
 const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::edp_publications_to_send()
@@ -405,6 +405,7 @@ void DiscoveryDataBase::clear_edp_publications_to_send()
     // lock(exclusive mode) mutex locally
     std::unique_lock<std::recursive_mutex> lock(mutex_);
     edp_publications_to_send_.clear();
+    edp_publications_to_send_index_.clear();
 }
 
 const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::edp_subscriptions_to_send()
@@ -419,6 +420,7 @@ void DiscoveryDataBase::clear_edp_subscriptions_to_send()
     // lock(exclusive mode) mutex locally
     std::unique_lock<std::recursive_mutex> lock(mutex_);
     edp_subscriptions_to_send_.clear();
+    edp_subscriptions_to_send_index_.clear();
 }
 
 const std::vector<eprosima::fastrtps::rtps::CacheChange_t*> DiscoveryDataBase::changes_to_release()
@@ -596,7 +598,7 @@ void DiscoveryDataBase::create_participant_from_change_(
     else
     {
         DiscoveryParticipantInfo part(ch, server_guid_prefix_, change_data);
-        std::pair<std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator, bool> ret =
+        std::pair<ParticipantMap::iterator, bool> ret =
                 participants_.insert(std::make_pair(change_guid.guidPrefix, part));
         // If insert was successful
         if (ret.second)
@@ -728,8 +730,7 @@ void DiscoveryDataBase::create_writers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
-                writers_.insert(std::make_pair(writer_guid, tmp_writer));
+        std::pair<EndpointMap::iterator, bool> ret = writers_.insert(std::make_pair(writer_guid, tmp_writer));
         if (!ret.second)
         {
             logError(DISCOVERY_DATABASE, "Error inserting writer " << writer_guid);
@@ -738,8 +739,7 @@ void DiscoveryDataBase::create_writers_from_change_(
         writer_it = ret.first;
 
         // Add entry to participants_[guid_prefix]::writers
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
-                participants_.find(writer_guid.guidPrefix);
+        ParticipantMap::iterator writer_part_it = participants_.find(writer_guid.guidPrefix);
         if (writer_part_it != participants_.end())
         {
             writer_part_it->second.add_writer(writer_guid);
@@ -760,7 +760,7 @@ void DiscoveryDataBase::create_writers_from_change_(
         // if topic is virtual, it must iterate over all readers
         if (topic_name == virtual_topic_)
         {
-            for (auto reader_it : readers_)
+            for (const auto& reader_it : readers_)
             {
                 match_writer_reader_(writer_guid, reader_it.first);
             }
@@ -818,6 +818,10 @@ void DiscoveryDataBase::create_readers_from_change_(
                     reader_it->second.change()->write_params.sample_identity().sequence_number())
             {
                 reader_it->second.add_or_update_ack_participant(ch->writerGUID.guidPrefix, true);
+                if (!reader_it->second.is_virtual() && ch->writerGUID.guidPrefix != reader_guid.guidPrefix)
+                {
+                    add_server_interest_(ch->writerGUID.guidPrefix, topic_name, reader_guid);
+                }
             }
 
             // we release it if it's the same or if it is lower
@@ -834,8 +838,7 @@ void DiscoveryDataBase::create_readers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
-                readers_.insert(std::make_pair(reader_guid, tmp_reader));
+        std::pair<EndpointMap::iterator, bool> ret = readers_.insert(std::make_pair(reader_guid, tmp_reader));
         if (!ret.second)
         {
             logError(DISCOVERY_DATABASE, "Error inserting reader " << reader_guid);
@@ -844,8 +847,7 @@ void DiscoveryDataBase::create_readers_from_change_(
         reader_it = ret.first;
 
         // Add entry to participants_[guid_prefix]::readers
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
-                participants_.find(reader_guid.guidPrefix);
+        ParticipantMap::iterator reader_part_it = participants_.find(reader_guid.guidPrefix);
         if (reader_part_it != participants_.end())
         {
             reader_part_it->second.add_reader(reader_guid);
@@ -866,7 +868,7 @@ void DiscoveryDataBase::create_readers_from_change_(
         // if topic is virtual, it must iterate over all readers
         if (topic_name == virtual_topic_)
         {
-            for (auto writer_it : writers_)
+            for (const auto& writer_it : writers_)
             {
                 match_writer_reader_(writer_it.first, reader_guid);
             }
@@ -883,6 +885,12 @@ void DiscoveryDataBase::create_readers_from_change_(
             {
                 match_writer_reader_(writer, reader_guid);
             }
+
+            // A reader relayed by a server shows that the server is interested in the topic
+            if (ch->writerGUID.guidPrefix != reader_guid.guidPrefix)
+            {
+                add_server_interest_(ch->writerGUID.guidPrefix, topic_name, reader_guid);
+            }
         }
         // Update set of dirty_topics
         set_dirty_topic_(topic_name);
@@ -931,6 +939,13 @@ void DiscoveryDataBase::match_writer_reader_(
     }
     DiscoveryParticipantInfo& reader_participant_info = p_rit->second;
 
+    // With topic routing, a server only gets the writers on the topics it has shown interest in
+    if (topic_routing_ && reader_info.is_virtual() && !writer_info.is_virtual() &&
+            !server_interested_in_topic_(reader_guid.guidPrefix, writer_info.topic()))
+    {
+        return;
+    }
+
     // virtual              - needs info and give none
     // local                - needs info and give info
     // external             - needs none and give info
@@ -1040,6 +1055,63 @@ void DiscoveryDataBase::match_writer_reader_(
     }
 }
 
+void DiscoveryDataBase::add_server_interest_(
+        const eprosima::fastrtps::rtps::GuidPrefix_t& server,
+        const std::string& topic_name,
+        const eprosima::fastrtps::rtps::GUID_t& reader_guid)
+{
+    std::unordered_set<eprosima::fastrtps::rtps::GUID_t>& relayed_readers = server_interests_[server][topic_name];
+    if (!relayed_readers.insert(reader_guid).second || relayed_readers.size() > 1)
+    {
+        return;
+    }
+    logInfo(DISCOVERY_DATABASE, "Server " << server << " interested in topic " << topic_name);
+
+    // The writers already on the topic were not routed to the server yet
+    eprosima::fastrtps::rtps::GUID_t virtual_reader(server, fastrtps::rtps::ds_server_virtual_reader);
+    if (!topic_routing_ || readers_.find(virtual_reader) == readers_.end())
+    {
+        return;
+    }
+    auto writers_it = writers_by_topic_.find(topic_name);
+    if (writers_it != writers_by_topic_.end())
+    {
+        for (auto writer : writers_it->second)
+        {
+            match_writer_reader_(writer, virtual_reader);
+        }
+        set_dirty_topic_(topic_name);
+    }
+}
+
+void DiscoveryDataBase::remove_server_interests_(
+        const eprosima::fastrtps::rtps::GUID_t& reader_guid,
+        const std::string& topic_name)
+{
+    for (auto& server : server_interests_)
+    {
+        auto topic_it = server.second.find(topic_name);
+        if (topic_it == server.second.end() || topic_it->second.erase(reader_guid) == 0 ||
+                !topic_it->second.empty())
+        {
+            continue;
+        }
+
+        // The writers already routed to the server stay matched with its virtual reader, so it keeps getting their
+        // updates and disposals. Only the writers appearing from now on are not routed to it
+        server.second.erase(topic_it);
+        logInfo(DISCOVERY_DATABASE, "Server " << server.first << " no longer interested in topic " << topic_name);
+    }
+}
+
+bool DiscoveryDataBase::server_interested_in_topic_(
+        const eprosima::fastrtps::rtps::GuidPrefix_t& server,
+        const std::string& topic_name) const
+{
+    auto it = server_interests_.find(server);
+    return it != server_interests_.end() && it->second.count(topic_name) > 0;
+}
+
 bool DiscoveryDataBase::set_dirty_topic_(
         std::string topic)
 {
@@ -1050,24 +1122,23 @@ bool DiscoveryDataBase::set_dirty_topic_(
     {
         // Set all topics to dirty
         dirty_topics_.clear();
+        dirty_topics_index_.clear();
 
         // It is enough to use writers_by_topic because the topics are simetrical in writers and readers:
         //  if a topic exists in one, it exists in the other
-        for (auto topic_it : writers_by_topic_)
+        for (const auto& topic_it : writers_by_topic_)
         {
             if (topic_it.first != virtual_topic_)
             {
                 dirty_topics_.push_back(topic_it.first);
+                dirty_topics_index_.insert(topic_it.first);
             }
         }
         return true;
     }
     else
     {
-        if (std::find(
-                    dirty_topics_.begin(),
-                    dirty_topics_.end(),
-                    topic) == dirty_topics_.end())
+        if (dirty_topics_index_.insert(topic).second)
         {
             dirty_topics_.push_back(topic);
             return true;
@@ -1082,8 +1153,7 @@ void DiscoveryDataBase::process_dispose_participant_(
     const eprosima::fastrtps::rtps::GUID_t& participant_guid = guid_from_change(ch);
 
     // Change DATA(p) with DATA(Up) in participants map
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator pit =
-            participants_.find(participant_guid.guidPrefix);
+    ParticipantMap::iterator pit = participants_.find(participant_guid.guidPrefix);
     if (pit != participants_.end())
     {
         // Check if this participant is already NOT ALIVE
@@ -1136,6 +1206,9 @@ void DiscoveryDataBase::process_dispose_participant_(
     // Unmatch own participant
     unmatch_participant_(participant_guid.guidPrefix);
 
+    // A server coming back has to show its interests again
+    server_interests_.erase(participant_guid.guidPrefix);
+
     // Add entry to disposals_
     if (std::find(disposals_.begin(), disposals_.end(), ch) == disposals_.end())
     {
@@ -1149,7 +1222,7 @@ void DiscoveryDataBase::process_dispose_writer_(
     const eprosima::fastrtps::rtps::GUID_t& writer_guid = guid_from_change(ch);
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator wit = writers_.find(writer_guid);
+    EndpointMap::iterator wit = writers_.find(writer_guid);
     if (wit != writers_.end())
     {
         // Change DATA(w) with DATA(Uw)
@@ -1176,7 +1249,7 @@ void DiscoveryDataBase::process_dispose_reader_(
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator rit = readers_.find(reader_guid);
+    EndpointMap::iterator rit = readers_.find(reader_guid);
     if (rit != readers_.end())
     {
         // Change DATA(r) with DATA(Ur)
@@ -1185,6 +1258,9 @@ void DiscoveryDataBase::process_dispose_reader_(
         // Remove reader from topic
         remove_reader_from_topic_(reader_guid, rit->second.topic());
 
+        // The servers which relayed the reader may no longer be interested in its topic
+        remove_server_interests_(reader_guid, rit->second.topic());
+
         // Add entry to disposals_
         if (rit->second.topic() != virtual_topic_)
         {
@@ -1208,130 +1284,66 @@ bool DiscoveryDataBase::process_dirty_topics()
     // Get shared lock
     std::unique_lock<std::recursive_mutex> lock(mutex_);
 
-    // Iterator objects are declared here because they are reused in each iteration of the loops
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_reader_it;
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_writer_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator readers_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator writers_it;
-
-    // Iterate over dirty_topics_
-    for (auto topic_it = dirty_topics_.begin(); topic_it != dirty_topics_.end();)
+    // Topics are independent, so they may be processed by several threads
+    std::vector<DirtyTopicResult> results(dirty_topics_.size());
+    std::function<void(size_t)> process_topic = [this, &results](size_t i)
+            {
+                process_dirty_topic_(dirty_topics_[i], results[i]);
+            };
+    if (matching_workers_ && dirty_topics_.size() > 1)
+    {
+        matching_workers_->run(dirty_topics_.size(), process_topic);
+    }
+    else
     {
-        logInfo(DISCOVERY_DATABASE, "Processing topic: " << *topic_it);
-        // Flag to store whether a topic can be cleared.
-        bool is_clearable = true;
+        for (size_t i = 0; i < dirty_topics_.size(); ++i)
+        {
+            process_topic(i);
+        }
+    }
 
-        // Get all the writers in the topic
-        std::vector<fastrtps::rtps::GUID_t> writers;
-        auto ret = writers_by_topic_.find(*topic_it);
-        if (ret != writers_by_topic_.end())
+    // Merge the results in the order of the topics, as if they were processed sequentially
+    std::vector<std::string> still_dirty_topics;
+    for (size_t i = 0; i < dirty_topics_.size(); ++i)
+    {
+        DirtyTopicResult& result = results[i];
+        for (eprosima::fastrtps::rtps::CacheChange_t* change : result.edp_subscriptions_to_send)
         {
-            writers = ret->second;
+            if (add_edp_subscriptions_to_send_(change))
+            {
+                logInfo(DISCOVERY_DATABASE, "Addind DATA(r) to send: " << change->instanceHandle);
+            }
         }
-        // Get all the readers in the topic
-        std::vector<fastrtps::rtps::GUID_t> readers;
-        ret = readers_by_topic_.find(*topic_it);
-        if (ret != readers_by_topic_.end())
+        for (eprosima::fastrtps::rtps::CacheChange_t* change : result.edp_publications_to_send)
         {
-            readers = ret->second;
+            if (add_edp_publications_to_send_(change))
+            {
+                logInfo(DISCOVERY_DATABASE, "Addind DATA(w) to send: " << change->instanceHandle);
+            }
         }
-
-        for (fastrtps::rtps::GUID_t writer: writers)
-        // Iterate over writers in the topic:
+        for (eprosima::fastrtps::rtps::CacheChange_t* change : result.pdp_to_send)
         {
-            logInfo(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing writer: " << writer);
-            // Iterate over readers in the topic:
-            for (fastrtps::rtps::GUID_t reader : readers)
+            if (add_pdp_to_send_(change))
             {
-                logInfo(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing reader: " << reader);
-                // Find participants with writer info and participant with reader info in participants_
-                parts_reader_it = participants_.find(reader.guidPrefix);
-                parts_writer_it = participants_.find(writer.guidPrefix);
-                // Find reader info in readers_
-                readers_it = readers_.find(reader);
-                // Find writer info in writers_
-                writers_it = writers_.find(writer);
-
-                // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
-                // with the writer.
-                if (parts_reader_it != participants_.end())
-                {
-                    if (parts_reader_it->second.is_matched(writer.guidPrefix))
-                    {
-                        // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
-                        if (readers_it != readers_.end() &&
-                                readers_it->second.is_relevant_participant(writer.guidPrefix) &&
-                                !readers_it->second.is_matched(writer.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(r) to a `edp_publications_to_send_` (if it's not there).
-                            if (add_edp_subscriptions_to_send_(readers_it->second.change()))
-                            {
-                                logInfo(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
-                                        << readers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
-                    {
-                        // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_reader_it->second.change()))
-                        {
-                            logInfo(DISCOVERY_DATABASE, "Addind readers' DATA(p) to send: "
-                                    << parts_reader_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
-                    }
-                }
-
-                // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
-                // with the reader.
-                if (parts_writer_it != participants_.end())
-                {
-                    if (parts_writer_it->second.is_matched(reader.guidPrefix))
-                    {
-                        // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
-                        if (writers_it != writers_.end() &&
-                                writers_it->second.is_relevant_participant(reader.guidPrefix) &&
-                                !writers_it->second.is_matched(reader.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(w) to a `edp_subscriptions_to_send_` (if it's not there).
-                            if (add_edp_publications_to_send_(writers_it->second.change()))
-                            {
-                                logInfo(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
-                                        << writers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
-                    {
-                        // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_writer_it->second.change()))
-                        {
-                            logInfo(DISCOVERY_DATABASE, "Addind writers' DATA(p) to send: "
-                                    << parts_writer_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
-                    }
-                }
+                logInfo(DISCOVERY_DATABASE, "Addind DATA(p) to send: " << change->instanceHandle);
             }
         }
 
         // Check whether the topic is still dirty or it can be cleared
-        if (is_clearable)
+        if (result.is_clearable)
         {
             // Delete topic from dirty_topics_
-            logInfo(DISCOVERY_DATABASE, "Topic " << *topic_it << " has been cleaned");
-            topic_it = dirty_topics_.erase(topic_it);
+            logInfo(DISCOVERY_DATABASE, "Topic " << dirty_topics_[i] << " has been cleaned");
+            dirty_topics_index_.erase(dirty_topics_[i]);
         }
         else
         {
             // Proceed with next topic
-            logInfo(DISCOVERY_DATABASE, "Topic " << *topic_it << " is still dirty");
-            ++topic_it;
+            logInfo(DISCOVERY_DATABASE, "Topic " << dirty_topics_[i] << " is still dirty");
+            still_dirty_topics.push_back(std::move(dirty_topics_[i]));
         }
     }
+    dirty_topics_.swap(still_dirty_topics);
 
     // Return whether there still are dirty topics
     logInfo(DISCOVERY_DATABASE, "Are there dirty topics? " << !dirty_topics_.empty());
@@ -1339,6 +1351,105 @@ bool DiscoveryDataBase::process_dirty_topics()
     return !dirty_topics_.empty();
 }
 
+void DiscoveryDataBase::process_dirty_topic_(
+        const std::string& topic_name,
+        DirtyTopicResult& result) const
+{
+    logInfo(DISCOVERY_DATABASE, "Processing topic: " << topic_name);
+
+    // Get all the writers in the topic
+    static const std::vector<fastrtps::rtps::GUID_t> no_endpoints;
+    auto ret = writers_by_topic_.find(topic_name);
+    const std::vector<fastrtps::rtps::GUID_t>& writers = (ret != writers_by_topic_.end()) ? ret->second : no_endpoints;
+    // Get all the readers in the topic
+    ret = readers_by_topic_.find(topic_name);
+    const std::vector<fastrtps::rtps::GUID_t>& readers = (ret != readers_by_topic_.end()) ? ret->second : no_endpoints;
+
+    for (const fastrtps::rtps::GUID_t& writer: writers)
+    // Iterate over writers in the topic:
+    {
+        logInfo(DISCOVERY_DATABASE, "[" << topic_name << "]" << " Processing writer: " << writer);
+
+        // Find participant with writer info in participants_
+        auto parts_writer_it = participants_.find(writer.guidPrefix);
+        // Find writer info in writers_
+        auto writers_it = writers_.find(writer);
+
+        // Iterate over readers in the topic:
+        for (const fastrtps::rtps::GUID_t& reader : readers)
+        {
+            logInfo(DISCOVERY_DATABASE, "[" << topic_name << "]" << " Processing reader: " << reader);
+            // Find participant with reader info in participants_
+            auto parts_reader_it = participants_.find(reader.guidPrefix);
+            // Find reader info in readers_
+            auto readers_it = readers_.find(reader);
+
+            // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
+            // with the writer.
+            if (parts_reader_it != participants_.end())
+            {
+                if (parts_reader_it->second.is_matched(writer.guidPrefix))
+                {
+                    // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
+                    if (readers_it != readers_.end() &&
+                            readers_it->second.is_relevant_participant(writer.guidPrefix) &&
+                            !readers_it->second.is_matched(writer.guidPrefix))
+                    {
+                        // If the status is 0, add DATA(r) to a `edp_publications_to_send_` (if it's not there).
+                        result.edp_subscriptions_to_send.push_back(readers_it->second.change());
+                    }
+                }
+                else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
+                {
+                    // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
+                    result.pdp_to_send.push_back(parts_reader_it->second.change());
+                    // Set topic as not-clearable.
+                    result.is_clearable = false;
+                }
+            }
+
+            // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
+            // with the reader.
+            if (parts_writer_it != participants_.end())
+            {
+                if (parts_writer_it->second.is_matched(reader.guidPrefix))
+                {
+                    // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
+                    if (writers_it != writers_.end() &&
+                            writers_it->second.is_relevant_participant(reader.guidPrefix) &&
+                            !writers_it->second.is_matched(reader.guidPrefix))
+                    {
+                        // If the status is 0, add DATA(w) to a `edp_subscriptions_to_send_` (if it's not there).
+                        result.edp_publications_to_send.push_back(writers_it->second.change());
+                    }
+                }
+                else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
+                {
+                    // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
+                    result.pdp_to_send.push_back(parts_writer_it->second.change());
+                    // Set topic as not-clearable.
+                    result.is_clearable = false;
+                }
+            }
+        }
+    }
+}
+
+void DiscoveryDataBase::matching_threads(
+        uint32_t num_threads,
+        const fastdds::rtps::ThreadSettings& thread_settings)
+{
+    std::unique_lock<std::recursive_mutex> lock(mutex_);
+    if (num_threads > 1)
+    {
+        matching_workers_.reset(new DiscoveryDataBaseWorkers(num_threads, thread_settings));
+    }
+    else
+    {
+        matching_workers_.reset();
+    }
+}
+
 bool DiscoveryDataBase::delete_entity_of_change(
         fastrtps::rtps::CacheChange_t* change)
 {
@@ -1787,7 +1898,7 @@ void DiscoveryDataBase::remove_writer_from_topic_(
 {
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it;
+        TopicMap::iterator topic_it;
         for (topic_it = writers_by_topic_.begin(); topic_it != writers_by_topic_.end(); topic_it++)
         {
             for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator writer_it = topic_it->second.begin();
@@ -1804,8 +1915,7 @@ void DiscoveryDataBase::remove_writer_from_topic_(
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it =
-                writers_by_topic_.find(topic_name);
+        TopicMap::iterator topic_it = writers_by_topic_.find(topic_name);
         if (topic_it != writers_by_topic_.end())
         {
             for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator writer_it = topic_it->second.begin();
@@ -1835,7 +1945,7 @@ void DiscoveryDataBase::remove_reader_from_topic_(
 
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it;
+        TopicMap::iterator topic_it;
         for (topic_it = readers_by_topic_.begin(); topic_it != readers_by_topic_.end(); topic_it++)
         {
             for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator reader_it = topic_it->second.begin();
@@ -1852,8 +1962,7 @@ void DiscoveryDataBase::remove_reader_from_topic_(
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it =
-                readers_by_topic_.find(topic_name);
+        TopicMap::iterator topic_it = readers_by_topic_.find(topic_name);
         if (topic_it != readers_by_topic_.end())
         {
             for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator reader_it = topic_it->second.begin();
@@ -2021,9 +2130,8 @@ bool DiscoveryDataBase::delete_participant_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator
-DiscoveryDataBase::delete_participant_entity_(
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it)
+DiscoveryDataBase::ParticipantMap::iterator DiscoveryDataBase::delete_participant_entity_(
+        ParticipantMap::iterator it)
 {
     logInfo(DISCOVERY_DATABASE, "Deleting participant: " << it->first);
     if (it == participants_.end())
@@ -2048,8 +2156,8 @@ bool DiscoveryDataBase::delete_reader_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_reader_entity_(
-        std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointMap::iterator DiscoveryDataBase::delete_reader_entity_(
+        EndpointMap::iterator it)
 {
     logInfo(DISCOVERY_DATABASE, "Deleting reader: " << it->first.guidPrefix);
     if (it == readers_.end())
@@ -2068,6 +2176,8 @@ std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator Disc
         pit->second.remove_reader(it->first);
     }
 
+    remove_server_interests_(it->first, it->second.topic());
+
     if (it->second.is_virtual())
     {
         // If the change is virtual, we can simply delete it
@@ -2097,8 +2207,8 @@ bool DiscoveryDataBase::delete_writer_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_writer_entity_(
-        std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointMap::iterator DiscoveryDataBase::delete_writer_entity_(
+        EndpointMap::iterator it)
 {
     logInfo(DISCOVERY_DATABASE, "Deleting writer: " << it->first.guidPrefix);
     if (it == writers_.end())
@@ -2136,10 +2246,7 @@ bool DiscoveryDataBase::add_pdp_to_send_(
         eprosima::fastrtps::rtps::CacheChange_t* change)
 {
     // Add DATA(p) to send in next iteration if it is not already there
-    if (std::find(
-                pdp_to_send_.begin(),
-                pdp_to_send_.end(),
-                change) == pdp_to_send_.end())
+    if (pdp_to_send_index_.insert(change).second)
     {
         logInfo(DISCOVERY_DATABASE, "Addind DATA(p) to send: "
                 << change->instanceHandle);
@@ -2153,10 +2260,7 @@ bool DiscoveryDataBase::add_edp_publications_to_send_(
         eprosima::fastrtps::rtps::CacheChange_t* change)
 {
     // Add DATA(w) to send in next iteration if it is not already there
-    if (std::find(
-                edp_publications_to_send_.begin(),
-                edp_publications_to_send_.end(),
-                change) == edp_publications_to_send_.end())
+    if (edp_publications_to_send_index_.insert(change).second)
     {
         logInfo(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
                 << change->instanceHandle);
@@ -2170,10 +2274,7 @@ bool DiscoveryDataBase::add_edp_subscriptions_to_send_(
         eprosima::fastrtps::rtps::CacheChange_t* change)
 {
     // Add DATA(r) to send in next iteration if it is not already there
-    if (std::find(
-                edp_subscriptions_to_send_.begin(),
-                edp_subscriptions_to_send_.end(),
-                change) == edp_subscriptions_to_send_.end())
+    if (edp_subscriptions_to_send_index_.insert(change).second)
     {
         logInfo(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
                 << change->instanceHandle);
@@ -2332,8 +2433,7 @@ bool DiscoveryDataBase::from_json(
             add_writer_to_topic_(guid_aux, topic);
 
             // Add writer to its participant
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
-                    participants_.find(guid_aux.guidPrefix);
+            ParticipantMap::iterator writer_part_it = participants_.find(guid_aux.guidPrefix);
             if (writer_part_it != participants_.end())
             {
                 writer_part_it->second.add_writer(guid_aux);
@@ -2385,13 +2485,18 @@ bool DiscoveryDataBase::from_json(
             // Add Participant
             readers_.insert(std::make_pair(guid_aux, dei));
 
+            // Interests of the servers, whose writers are already in the restored ack lists
+            if (!dei.is_virtual() && change->writerGUID.guidPrefix != guid_aux.guidPrefix)
+            {
+                server_interests_[change->writerGUID.guidPrefix][topic].insert(guid_aux);
+            }
+
             // Extra configurations for readers
             // Add reader to readers_by_topic. This will create the topic if necessary
             add_reader_to_topic_(guid_aux, topic);
 
             // Add reader to its participant
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
-                    participants_.find(guid_aux.guidPrefix);
+            ParticipantMap::iterator reader_part_it = participants_.find(guid_aux.guidPrefix);
             if (reader_part_it != participants_.end())
             {
                 reader_part_it->second.add_reader(guid_aux);
@@ -2426,11 +2531,19 @@ bool DiscoveryDataBase::from_json(
 
 void DiscoveryDataBase::clean_backup()
 {
-    logInfo(DISCOVERY_DATABASE, "Restoring queue DDB in json backup");
+    logInfo(DISCOVERY_DATABASE, "Restoring queue DDB in backup journal");
 
     // This will erase the last backup stored
+    std::unique_lock<std::recursive_mutex> lock(data_queues_mutex_);
     backup_file_.close();
-    backup_file_.open(backup_file_name_, std::ios_base::out);
+    backup_file_.open(backup_file_name_, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    backup_file_size_ = 0;
+}
+
+size_t DiscoveryDataBase::backup_journal_size()
+{
+    std::unique_lock<std::recursive_mutex> lock(data_queues_mutex_);
+    return backup_file_size_;
 }
 
 void DiscoveryDataBase::persistence_enable(
@@ -2439,7 +2552,23 @@ void DiscoveryDataBase::persistence_enable(
     is_persistent_ = true;
     backup_file_name_ = backup_file_name;
     // It opens the file in append mode because the info in it has not been yet
-    backup_file_.open(backup_file_name_, std::ios::app);
+    backup_file_.open(backup_file_name_, std::ios_base::app | std::ios_base::binary);
+    backup_file_.seekp(0, std::ios_base::end);
+    std::streamoff size = backup_file_.tellp();
+    backup_file_size_ = size > 0 ? static_cast<size_t>(size) : 0;
+}
+
+void DiscoveryDataBase::write_backup_record_(
+        const eprosima::fastrtps::rtps::CacheChange_t& change)
+{
+    size_t written = ddb::write_journal_record(backup_file_, change);
+    if (written == 0)
+    {
+        logError(DISCOVERY_DATABASE, "Error writing change " << change.instanceHandle << " to the backup journal");
+        return;
+    }
+    backup_file_.flush();
+    backup_file_size_ += written;
 }
 
 } // namespace ddb
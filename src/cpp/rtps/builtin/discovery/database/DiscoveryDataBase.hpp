@@ -22,9 +22,12 @@
 
 #include <vector>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <iostream>
 #include <fstream>
+#include <unordered_map>
+#include <unordered_set>
 
 #include <fastrtps/utils/fixed_size_string.hpp>
 #include <fastdds/rtps/writer/ReaderProxy.h>
@@ -35,6 +38,7 @@
 #include "./DiscoveryParticipantInfo.hpp"
 #include "./DiscoveryEndpointInfo.hpp"
 #include "./DiscoveryDataQueueInfo.hpp"
+#include "./DiscoveryDataBaseWorkers.hpp"
 
 #include <json.hpp>
 
@@ -142,7 +146,7 @@ public:
         enabled_ = true;
     }
 
-    // enable ddb in persistence mode and open the file to backup up in append mode
+    // enable ddb in persistence mode and open the journal file to backup up in append mode
     void persistence_enable(
             std::string backup_file_name);
 
@@ -153,6 +157,26 @@ public:
         enabled_ = false;
     }
 
+    /* Set the number of threads matching the endpoints on the dirty topics
+     * Each topic is processed by a single thread, so only servers with many topics benefit from this
+     * @num_threads: Number of threads, including the one calling process_dirty_topics. 1 by default.
+     * @thread_settings: Settings of the threads helping the calling one.
+     */
+    void matching_threads(
+            uint32_t num_threads,
+            const fastdds::rtps::ThreadSettings& thread_settings = fastdds::rtps::ThreadSettings());
+
+    /* Set whether the endpoints are only routed to the remote servers interested in their topics
+     * Readers are forwarded to every server, acting as the announcement of interest of their servers. Writers are
+     * only forwarded to the servers which have sent a reader on the same topic. Disabled by default.
+     * @enable: Whether to route the writers by topic.
+     */
+    void topic_routing(
+            bool enable)
+    {
+        topic_routing_ = enable;
+    }
+
     //! Check whether the database is enabled
     bool is_enabled()
     {
@@ -314,6 +338,9 @@ public:
     // This function must be called with the incoming datas blocked
     void clean_backup();
 
+    // Size in bytes of the journal with the changes arrived since the last backup
+    size_t backup_journal_size();
+
     // Lock the incoming of new data to the DDB queue. This locks the Listener as well
     void lock_incoming_data()
     {
@@ -333,6 +360,10 @@ public:
 
 protected:
 
+    using ParticipantMap = std::unordered_map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>;
+    using EndpointMap = std::unordered_map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>;
+    using TopicMap = std::unordered_map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>;
+
     // change a cacheChange by update or new disposal
     void update_change_and_unmatch_(
             fastrtps::rtps::CacheChange_t* new_change,
@@ -375,6 +406,23 @@ protected:
             const eprosima::fastrtps::rtps::GUID_t& writer_guid,
             const eprosima::fastrtps::rtps::GUID_t& reader_guid);
 
+    // record that a remote server has sent a reader on a topic, routing the writers on it to that server
+    void add_server_interest_(
+            const eprosima::fastrtps::rtps::GuidPrefix_t& server,
+            const std::string& topic_name,
+            const eprosima::fastrtps::rtps::GUID_t& reader_guid);
+
+    // forget a removed reader, dropping the interest of the servers which relayed it if it was their last one
+    // on the topic
+    void remove_server_interests_(
+            const eprosima::fastrtps::rtps::GUID_t& reader_guid,
+            const std::string& topic_name);
+
+    // whether the writers on a topic must be routed to the given server
+    bool server_interested_in_topic_(
+            const eprosima::fastrtps::rtps::GuidPrefix_t& server,
+            const std::string& topic_name) const;
+
     void process_dispose_participant_(
             eprosima::fastrtps::rtps::CacheChange_t* ch);
 
@@ -403,22 +451,22 @@ protected:
     bool delete_participant_entity_(
             const fastrtps::rtps::GuidPrefix_t& guid_prefix);
 
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator delete_participant_entity_(
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it);
+    ParticipantMap::iterator delete_participant_entity_(
+            ParticipantMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_writer_entity_(
             const fastrtps::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_writer_entity_(
-            std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointMap::iterator delete_writer_entity_(
+            EndpointMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_reader_entity_(
             const fastrtps::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_reader_entity_(
-            std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointMap::iterator delete_reader_entity_(
+            EndpointMap::iterator it);
 
     // return if there are more than one writer in the participant in the same topic
     bool repeated_writer_topic_(
@@ -455,6 +503,25 @@ protected:
     bool set_dirty_topic_(
             std::string topic);
 
+    //! Changes to send found while processing a dirty topic
+    struct DirtyTopicResult
+    {
+        bool is_clearable = true;
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> pdp_to_send;
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_publications_to_send;
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_subscriptions_to_send;
+    };
+
+    // Check the matching state of all the endpoints in a dirty topic. Only reads the database, so several topics can
+    // be processed at the same time
+    void process_dirty_topic_(
+            const std::string& topic_name,
+            DirtyTopicResult& result) const;
+
+    // Append a change to the backup journal. Must be called with the incoming data locked
+    void write_backup_record_(
+            const eprosima::fastrtps::rtps::CacheChange_t& change);
+
     // Add data in pdp_to_send if not already in it
     bool add_pdp_to_send_(
             eprosima::fastrtps::rtps::CacheChange_t* change);
@@ -483,24 +550,25 @@ protected:
     fastrtps::DBQueue<eprosima::fastdds::rtps::ddb::DiscoveryEDPDataQueueInfo> edp_data_queue_;
 
     //! Covenient per-topic mapping of readers and writers to speed-up queries
-    std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>> readers_by_topic_;
-    std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>> writers_by_topic_;
+    TopicMap readers_by_topic_;
+    TopicMap writers_by_topic_;
 
     //! Collection of participant proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - keeps an account of participant's readers and writers
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo> participants_;
+    ParticipantMap participants_;
 
     //! Collection of reader and writer proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - stores the topic name (only matching criteria available)
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo> readers_;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo> writers_;
+    EndpointMap readers_;
+    EndpointMap writers_;
 
     //! Collection of topics whose related endpoints have changed and require a match recalculation
     std::vector<std::string> dirty_topics_;
+    std::unordered_set<std::string> dirty_topics_index_;
 
     //! Collection of changes to take out of the server builtin writers
     std::vector<eprosima::fastrtps::rtps::CacheChange_t*> disposals_;
@@ -510,12 +578,27 @@ protected:
     std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_publications_to_send_;
     std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_subscriptions_to_send_;
 
+    //! Changes in each of the collections above, so they are not added twice
+    std::unordered_set<eprosima::fastrtps::rtps::CacheChange_t*> pdp_to_send_index_;
+    std::unordered_set<eprosima::fastrtps::rtps::CacheChange_t*> edp_publications_to_send_index_;
+    std::unordered_set<eprosima::fastrtps::rtps::CacheChange_t*> edp_subscriptions_to_send_index_;
+
     //! changes that are no longer associated to living endpoints and should be returned to it's pool
     std::vector<eprosima::fastrtps::rtps::CacheChange_t*> changes_to_release_;
 
     //! General mutex
     mutable std::recursive_mutex mutex_;
 
+    //! Threads helping to process the dirty topics, if any
+    std::unique_ptr<DiscoveryDataBaseWorkers> matching_workers_;
+
+    //! Whether the writers are only routed to the servers interested in their topics
+    std::atomic<bool> topic_routing_{false};
+
+    //! Readers each remote server has sent, by topic. A server is interested in the topics it has readers on
+    std::unordered_map<fastrtps::rtps::GuidPrefix_t,
+            std::unordered_map<std::string, std::unordered_set<fastrtps::rtps::GUID_t>>> server_interests_;
+
     //! Mutex to lock updating to queues
     mutable std::recursive_mutex data_queues_mutex_;
 
@@ -545,6 +628,8 @@ protected:
     // This file will keep open to write it fast every time a new cache arrives
     // It needs a flush every time a new change is added
     std::ofstream backup_file_;
+    // Bytes written to the backup file since it was cleaned
+    size_t backup_file_size_ = 0;
 };
 
 
@@ -0,0 +1,122 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryDataBaseWorkers.cpp
+ *
+ */
+
+#include "./DiscoveryDataBaseWorkers.hpp"
+
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+DiscoveryDataBaseWorkers::DiscoveryDataBaseWorkers(
+        uint32_t num_threads,
+        const fastdds::rtps::ThreadSettings& thread_settings)
+    : thread_settings_(thread_settings)
+    , next_task_(0)
+{
+    for (uint32_t i = 1; i < num_threads; ++i)
+    {
+        threads_.push_back(create_thread([this]()
+                {
+                    worker_loop();
+                }, thread_settings_, "discovery database"));
+    }
+}
+
+DiscoveryDataBaseWorkers::~DiscoveryDataBaseWorkers()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        stop_ = true;
+        job_cv_.notify_all();
+    }
+
+    for (fastrtps::Thread& thread : threads_)
+    {
+        thread.join();
+    }
+}
+
+void DiscoveryDataBaseWorkers::run(
+        size_t num_tasks,
+        const std::function<void(size_t)>& task)
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        task_ = &task;
+        num_tasks_ = num_tasks;
+        next_task_.store(0);
+        busy_workers_ = threads_.size();
+        ++job_id_;
+        job_cv_.notify_all();
+    }
+
+    // The calling thread takes tasks too
+    process_tasks();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]()
+            {
+                return busy_workers_ == 0;
+            });
+    task_ = nullptr;
+}
+
+void DiscoveryDataBaseWorkers::worker_loop()
+{
+    uint64_t last_job = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;)
+    {
+        job_cv_.wait(lock, [this, last_job]()
+                {
+                    return stop_ || job_id_ != last_job;
+                });
+        if (stop_)
+        {
+            return;
+        }
+        last_job = job_id_;
+
+        lock.unlock();
+        process_tasks();
+        lock.lock();
+
+        if (--busy_workers_ == 0)
+        {
+            done_cv_.notify_all();
+        }
+    }
+}
+
+void DiscoveryDataBaseWorkers::process_tasks()
+{
+    size_t index;
+    while ((index = next_task_.fetch_add(1)) < num_tasks_)
+    {
+        (*task_)(index);
+    }
+}
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
@@ -0,0 +1,103 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryDataBaseWorkers.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_DISCOVERY_DATABASE_WORKERS_H_
+#define _FASTDDS_RTPS_DISCOVERY_DATABASE_WORKERS_H_
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+#include <utils/Thread.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+/**
+ * Threads helping the thread of the discovery server to process the database.
+ *
+ * Each job is a number of independent tasks, which are taken one by one by the workers and the calling thread
+ * until all of them are done.
+ *@ingroup DISCOVERY_MODULE
+ */
+class DiscoveryDataBaseWorkers
+{
+
+public:
+
+    /**
+     * Constructor.
+     * @param num_threads Number of threads processing each job, including the calling one.
+     * @param thread_settings Settings of the threads helping the calling one.
+     */
+    DiscoveryDataBaseWorkers(
+            uint32_t num_threads,
+            const fastdds::rtps::ThreadSettings& thread_settings = fastdds::rtps::ThreadSettings());
+
+    ~DiscoveryDataBaseWorkers();
+
+    /**
+     * Run a job, returning when all its tasks are done.
+     * @param num_tasks Number of tasks of the job.
+     * @param task Function processing the task with the given index. Called concurrently for different tasks.
+     */
+    void run(
+            size_t num_tasks,
+            const std::function<void(size_t)>& task);
+
+private:
+
+    void worker_loop();
+
+    void process_tasks();
+
+    fastdds::rtps::ThreadSettings thread_settings_;
+
+    std::vector<fastrtps::Thread> threads_;
+
+    //! Protects the fields describing the current job
+    std::mutex mutex_;
+    std::condition_variable job_cv_;
+    std::condition_variable done_cv_;
+
+    //! Increased for each job, so workers know there is a new one
+    uint64_t job_id_ = 0;
+    //! Workers still processing the current job
+    size_t busy_workers_ = 0;
+    bool stop_ = false;
+
+    const std::function<void(size_t)>* task_ = nullptr;
+    size_t num_tasks_ = 0;
+    //! Index of the next task to take
+    std::atomic<size_t> next_task_;
+};
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_DISCOVERY_DATABASE_WORKERS_H_ */
@@ -17,7 +17,7 @@
  *
  */
 
-#include <map>
+#include <unordered_map>
 #include <vector>
 
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
@@ -20,7 +20,7 @@
 #ifndef _FASTDDS_RTPS_DISCOVERY_PARTICIPANT_ACK_STATUS_H_
 #define _FASTDDS_RTPS_DISCOVERY_PARTICIPANT_ACK_STATUS_H_
 
-#include <map>
+#include <unordered_map>
 #include <vector>
 
 #include <fastdds/rtps/common/GuidPrefix_t.hpp>
@@ -73,7 +73,7 @@ public:
 
 private:
 
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, bool> relevant_participants_map_;
+    std::unordered_map<eprosima::fastrtps::rtps::GuidPrefix_t, bool> relevant_participants_map_;
 };
 
 } /* namespace ddb */
@@ -17,9 +17,15 @@
  *
  */
 
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
 #include <json.hpp>
 
 #include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/messages/CDRMessage.h>
 #include "SharedBackupFunctions.hpp"
 
 namespace eprosima {
@@ -79,6 +85,275 @@ void from_json(
     b64decode(change.serializedPayload.data, j["serialized_payload"]["data"].get<std::string>());
 }
 
+using fastrtps::rtps::CDRMessage_t;
+namespace CDRMessage = fastrtps::rtps::CDRMessage;
+
+// Size of the body of a journal record, without the payload data
+constexpr uint32_t journal_record_fixed_size = 2 + 4 * 16 + 3 * 8 + 2 * 8 + 2 + 4;
+// Size of the header of a journal record
+constexpr uint32_t journal_record_header_size = 8;
+
+static uint32_t journal_checksum(
+        const fastrtps::rtps::octet* data,
+        uint32_t length)
+{
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < length; ++i)
+    {
+        hash ^= data[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
+
+static bool add_guid(
+        CDRMessage_t* msg,
+        const fastrtps::rtps::GUID_t& guid)
+{
+    return CDRMessage::addData(msg, guid.guidPrefix.value, fastrtps::rtps::GuidPrefix_t::size) &&
+           CDRMessage::addEntityId(msg, &guid.entityId);
+}
+
+static bool read_guid(
+        CDRMessage_t* msg,
+        fastrtps::rtps::GUID_t& guid)
+{
+    return CDRMessage::readData(msg, guid.guidPrefix.value, fastrtps::rtps::GuidPrefix_t::size) &&
+           CDRMessage::readEntityId(msg, &guid.entityId);
+}
+
+static bool add_time(
+        CDRMessage_t* msg,
+        const fastrtps::rtps::Time_t& time)
+{
+    return CDRMessage::addInt32(msg, time.seconds()) && CDRMessage::addUInt32(msg, time.fraction());
+}
+
+static bool add_sample_identity(
+        CDRMessage_t* msg,
+        const fastrtps::rtps::SampleIdentity& sample_identity)
+{
+    return add_guid(msg, sample_identity.writer_guid()) &&
+           CDRMessage::addSequenceNumber(msg, &sample_identity.sequence_number());
+}
+
+static bool read_sample_identity(
+        CDRMessage_t* msg,
+        fastrtps::rtps::SampleIdentity& sample_identity)
+{
+    return read_guid(msg, sample_identity.writer_guid()) &&
+           CDRMessage::readSequenceNumber(msg, &sample_identity.sequence_number());
+}
+
+size_t write_journal_record(
+        std::ostream& journal,
+        const eprosima::fastrtps::rtps::CacheChange_t& change)
+{
+    const fastrtps::rtps::SerializedPayload_t& payload = change.serializedPayload;
+    uint32_t body_length = journal_record_fixed_size + payload.length;
+    CDRMessage_t msg(journal_record_header_size + body_length);
+    msg.msg_endian = fastrtps::rtps::LITTLEEND;
+
+    // The header is filled once the body is serialized
+    msg.pos = journal_record_header_size;
+    msg.length = journal_record_header_size;
+    bool valid = CDRMessage::addOctet(&msg, static_cast<fastrtps::rtps::octet>(change.kind));
+    valid &= CDRMessage::addOctet(&msg, change.isRead ? 1 : 0);
+    valid &= add_guid(&msg, change.writerGUID);
+    valid &= CDRMessage::addData(&msg, change.instanceHandle.value, 16);
+    valid &= CDRMessage::addSequenceNumber(&msg, &change.sequenceNumber);
+    valid &= add_time(&msg, change.sourceTimestamp);
+    valid &= add_time(&msg, change.receptionTimestamp);
+    valid &= add_sample_identity(&msg, change.write_params.sample_identity());
+    valid &= add_sample_identity(&msg, change.write_params.related_sample_identity());
+    valid &= CDRMessage::addUInt16(&msg, payload.encapsulation);
+    valid &= CDRMessage::addUInt32(&msg, payload.length);
+    valid &= CDRMessage::addData(&msg, payload.data, payload.length);
+
+    uint32_t length = msg.length;
+    msg.pos = 0;
+    valid &= CDRMessage::addUInt32(&msg, body_length);
+    valid &= CDRMessage::addUInt32(&msg, journal_checksum(&msg.buffer[journal_record_header_size], body_length));
+    if (!valid)
+    {
+        return 0;
+    }
+
+    journal.write(reinterpret_cast<const char*>(msg.buffer), length);
+    return journal.good() ? length : 0;
+}
+
+bool read_journal_record(
+        std::istream& journal,
+        JournalRecord& record)
+{
+    fastrtps::rtps::octet header[journal_record_header_size];
+    if (!journal.read(reinterpret_cast<char*>(header), journal_record_header_size))
+    {
+        return false;
+    }
+
+    CDRMessage_t msg(0);
+    msg.init(header, journal_record_header_size);
+    msg.length = journal_record_header_size;
+    msg.msg_endian = fastrtps::rtps::LITTLEEND;
+    uint32_t body_length = 0;
+    uint32_t checksum = 0;
+    CDRMessage::readUInt32(&msg, &body_length);
+    CDRMessage::readUInt32(&msg, &checksum);
+
+    // Avoid allocating a huge buffer for a corrupted length
+    std::streampos body_start = journal.tellg();
+    journal.seekg(0, std::ios_base::end);
+    std::streamoff left = journal.tellg() - body_start;
+    journal.seekg(body_start);
+    if (body_length < journal_record_fixed_size || left < static_cast<std::streamoff>(body_length))
+    {
+        return false;
+    }
+
+    record.resize(body_length);
+    return journal.read(reinterpret_cast<char*>(record.data()), body_length) &&
+           journal_checksum(record.data(), body_length) == checksum;
+}
+
+bool read_journal(
+        std::istream& journal,
+        std::vector<JournalRecord>& records)
+{
+    JournalRecord record;
+    while (journal.peek() != std::istream::traits_type::eof())
+    {
+        if (!read_journal_record(journal, record))
+        {
+            return false;
+        }
+        records.push_back(std::move(record));
+    }
+    return true;
+}
+
+bool from_journal_record(
+        JournalRecord& record,
+        eprosima::fastrtps::rtps::CacheChange_t& change)
+{
+    CDRMessage_t msg(0);
+    msg.init(record.data(), static_cast<uint32_t>(record.size()));
+    msg.length = msg.max_size;
+    msg.msg_endian = fastrtps::rtps::LITTLEEND;
+
+    fastrtps::rtps::octet kind = 0;
+    fastrtps::rtps::octet is_read = 0;
+    bool valid = CDRMessage::readOctet(&msg, &kind);
+    valid &= CDRMessage::readOctet(&msg, &is_read);
+    valid &= read_guid(&msg, change.writerGUID);
+    valid &= CDRMessage::readData(&msg, change.instanceHandle.value, 16);
+    valid &= CDRMessage::readSequenceNumber(&msg, &change.sequenceNumber);
+    valid &= CDRMessage::readTimestamp(&msg, &change.sourceTimestamp);
+    valid &= CDRMessage::readTimestamp(&msg, &change.receptionTimestamp);
+
+    fastrtps::rtps::SampleIdentity sample_identity;
+    fastrtps::rtps::SampleIdentity related_sample_identity;
+    valid &= read_sample_identity(&msg, sample_identity);
+    valid &= read_sample_identity(&msg, related_sample_identity);
+
+    uint16_t encapsulation = 0;
+    uint32_t length = 0;
+    valid &= CDRMessage::readUInt16(&msg, &encapsulation);
+    valid &= CDRMessage::readUInt32(&msg, &length);
+    if (!valid || msg.pos + length != msg.length)
+    {
+        return false;
+    }
+
+    change.kind = static_cast<fastrtps::rtps::ChangeKind_t>(kind);
+    change.isRead = is_read != 0;
+    change.write_params.sample_identity(sample_identity);
+    change.write_params.related_sample_identity(related_sample_identity);
+
+    fastrtps::rtps::SerializedPayload_t& payload = change.serializedPayload;
+    if (length > payload.max_size)
+    {
+        payload.reserve(length);
+    }
+    payload.encapsulation = encapsulation;
+    payload.length = length;
+    return CDRMessage::readData(&msg, payload.data, length);
+}
+
+bool read_snapshot(
+        const std::string& snapshot_file_name,
+        const std::string& json_file_name,
+        json& ddb_json,
+        size_t& snapshot_size)
+{
+    snapshot_size = 0;
+    std::ifstream file;
+    try
+    {
+        file.open(snapshot_file_name, std::ios_base::in | std::ios_base::binary);
+        if (file.is_open())
+        {
+            std::vector<uint8_t> snapshot((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+            ddb_json = json::from_cbor(snapshot);
+            snapshot_size = snapshot.size();
+        }
+        else
+        {
+            // Backups of previous versions only have the json snapshot
+            file.open(json_file_name, std::ios_base::in);
+            file >> ddb_json;
+        }
+    }
+    catch (const std::exception& /* e */)
+    {
+        return false;
+    }
+    return true;
+}
+
+bool restore_journal(
+        const std::string& journal_file_name,
+        std::vector<JournalRecord>& records)
+{
+    std::ifstream file(journal_file_name, std::ios_base::in | std::ios_base::binary);
+    if (!file.is_open())
+    {
+        return true;
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    size_t first_record = records.size();
+    std::istringstream journal(data);
+    if (read_journal(journal, records))
+    {
+        return true;
+    }
+
+    // New records are appended to the file, so they would follow the broken one and could not be read
+    size_t valid_size = 0;
+    for (size_t i = first_record; i < records.size(); ++i)
+    {
+        valid_size += journal_record_header_size + records[i].size();
+    }
+
+    // Like the snapshot, it is replaced through a temporary file, so the valid records are kept if the server stops
+    std::string tmp_file_name = journal_file_name + ".tmp";
+    std::ofstream tmp_file(tmp_file_name, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    tmp_file.write(data.data(), static_cast<std::streamsize>(valid_size));
+    tmp_file.close();
+    if (tmp_file)
+    {
+#if defined(_WIN32)
+        // rename does not replace existing files on Windows
+        std::remove(journal_file_name.c_str());
+#endif // if defined(_WIN32)
+        std::rename(tmp_file_name.c_str(), journal_file_name.c_str());
+    }
+    return false;
+}
+
 // stack overflow
 // @polfosol-ఠ-ఠ
 // https://stackoverflow.com/questions/180947/base64-decode-snippet-in-c/37109258#37109258
@@ -20,6 +20,11 @@
 #ifndef _SHARED_DUMP_FUNCTIONS_H_
 #define _SHARED_DUMP_FUNCTIONS_H_
 
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
 #include <json.hpp>
 #include <fastdds/rtps/common/CacheChange.h>
 
@@ -60,6 +65,70 @@ void from_json(
         const json& j,
         eprosima::fastrtps::rtps::CacheChange_t& change);
 
+// Binary record of the journal of the database, without its header
+using JournalRecord = std::vector<eprosima::fastrtps::rtps::octet>;
+
+// Appends a change to the journal of the database as a binary record, serialized as little endian CDR
+// Returns the number of bytes written, or 0 if the change could not be written
+size_t write_journal_record(
+        std::ostream& journal,
+        const eprosima::fastrtps::rtps::CacheChange_t& change);
+
+// Reads the next record of the journal of the database
+// Returns false at the end of the journal, and also when the record is truncated or corrupted, which happens
+// when the server stopped while writing it
+bool read_journal_record(
+        std::istream& journal,
+        JournalRecord& record);
+
+// Reads every record of the journal of the database, in the order they were written
+// Returns false when the journal ends with a truncated or corrupted record, which is left out of records
+bool read_journal(
+        std::istream& journal,
+        std::vector<JournalRecord>& records);
+
+// Deserialize a change from a journal record. The payload of the change is reserved if it does not fit
+bool from_journal_record(
+        JournalRecord& record,
+        eprosima::fastrtps::rtps::CacheChange_t& change);
+
+// Reads the snapshot of the database from its binary file, or from the json file of previous versions when there is
+// no binary one. The size of the binary snapshot is returned in snapshot_size, 0 for a json one
+// Returns false when no snapshot could be read
+bool read_snapshot(
+        const std::string& snapshot_file_name,
+        const std::string& json_file_name,
+        json& ddb_json,
+        size_t& snapshot_size);
+
+// Reads every record of the journal file of the database, in the order they were written
+// A truncated or corrupted record at the end is left out, and the file is truncated after the last valid record,
+// so the records appended to it afterwards are not hidden behind the broken one
+// Returns false when the journal ended with a truncated or corrupted record
+bool restore_journal(
+        const std::string& journal_file_name,
+        std::vector<JournalRecord>& records);
+
+// JOURNAL RECORD
+/*
+   header:
+    <body_length>:uint32
+    <checksum>:uint32   FNV-1a of the body
+   body:
+    <kind>:octet
+    <is_read>:octet
+    <writer_GUID>:GUID_t
+    <instance_handle>:InstanceHandle_t
+    <sequence_number>:SequenceNumber_t
+    <source_timestamp>:Time_t
+    <reception_timestamp>:Time_t
+    <sample_identity>:GUID_t,SequenceNumber_t
+    <related_sample_identity>:GUID_t,SequenceNumber_t
+    <encapsulation>:uint16
+    <length>:uint32
+    <data>:octet[length]
+ */
+
 // INFO TO STORE IN DDB
 /*
    {
@@ -34,8 +34,6 @@
 
 #include <fastrtps/attributes/TopicAttributes.h>
 
-#include <fastrtps/utils/StringMatching.h>
-
 #include <fastrtps/types/TypeObjectFactory.h>
 
 #include <fastdds/core/policy/ParameterList.hpp>
@@ -47,7 +45,10 @@
 #include <rtps/participant/RTPSParticipantImpl.h>
 
 #include <utils/collections/node_size_helpers.hpp>
+#include <utils/PartitionMatcher.hpp>
 
+#include <algorithm>
+#include <cstring>
 #include <mutex>
 
 using namespace eprosima::fastrtps;
@@ -63,6 +64,185 @@ namespace rtps {
 using reader_map_helper = utilities::collections::map_size_helper<GUID_t, SubscriptionMatchedStatus>;
 using writer_map_helper = utilities::collections::map_size_helper<GUID_t, PublicationMatchedStatus>;
 
+template<typename Endpoint>
+static void add_to_topic_index(
+        std::map<std::string, std::vector<Endpoint>>& index,
+        const std::string& topic,
+        const Endpoint& endpoint)
+{
+    std::vector<Endpoint>& endpoints = index[topic];
+    if (std::find(endpoints.begin(), endpoints.end(), endpoint) == endpoints.end())
+    {
+        endpoints.push_back(endpoint);
+    }
+}
+
+template<typename Endpoint>
+static void remove_from_topic_index(
+        std::map<std::string, std::vector<Endpoint>>& index,
+        const std::string& topic,
+        const Endpoint& endpoint)
+{
+    auto it = index.find(topic);
+    if (it != index.end())
+    {
+        std::vector<Endpoint>& endpoints = it->second;
+        endpoints.erase(std::remove(endpoints.begin(), endpoints.end(), endpoint), endpoints.end());
+        if (endpoints.empty())
+        {
+            index.erase(it);
+        }
+    }
+}
+
+/*
+ * The candidates are returned by copy, as listeners called while pairing may create or remove endpoints.
+ */
+template<typename Endpoint>
+static std::vector<Endpoint> topic_candidates(
+        const std::map<std::string, std::vector<Endpoint>>& index,
+        const std::string& topic)
+{
+    auto it = index.find(topic);
+    return it == index.end() ? std::vector<Endpoint>() : it->second;
+}
+
+//! Results of QoS compatibility checks kept, the least recently used one is dropped when adding more
+static constexpr size_t max_qos_compatibility_cache_size = 1024;
+
+//! Compiled lists of partitions kept, the least recently used one is dropped when adding more
+static constexpr size_t max_partition_matchers = 256;
+
+//! Results of type consistency checks kept, the least recently used one is dropped when adding more
+static constexpr size_t max_type_consistency_cache_size = 1024;
+
+static std::string partition_fingerprint(
+        const fastdds::dds::PartitionQosPolicy& partitions)
+{
+    // Names cannot contain the separator, so different lists of partitions give different fingerprints
+    std::string ret;
+    for (auto it = partitions.begin(); it != partitions.end(); ++it)
+    {
+        ret.append(it->name());
+        ret.push_back('\0');
+    }
+    return ret;
+}
+
+/*
+ * Serializes the QoS policies checked when matching a writer and a reader, so endpoints with the same fingerprints
+ * are known to have the same compatibility without checking them again.
+ */
+template<typename Qos>
+static std::string compute_qos_fingerprint(
+        const Qos& qos)
+{
+    std::string ret;
+    auto append = [&ret](const void* data, size_t size)
+            {
+                ret.append(static_cast<const char*>(data), size);
+            };
+
+    append(&qos.m_reliability.kind, sizeof(qos.m_reliability.kind));
+    append(&qos.m_durability.kind, sizeof(qos.m_durability.kind));
+    append(&qos.m_ownership.kind, sizeof(qos.m_ownership.kind));
+    append(&qos.m_deadline.period.seconds, sizeof(qos.m_deadline.period.seconds));
+    append(&qos.m_deadline.period.nanosec, sizeof(qos.m_deadline.period.nanosec));
+    append(&qos.m_disablePositiveACKs.enabled, sizeof(qos.m_disablePositiveACKs.enabled));
+    append(&qos.m_liveliness.kind, sizeof(qos.m_liveliness.kind));
+    append(&qos.m_liveliness.lease_duration.seconds, sizeof(qos.m_liveliness.lease_duration.seconds));
+    append(&qos.m_liveliness.lease_duration.nanosec, sizeof(qos.m_liveliness.lease_duration.nanosec));
+
+    ret.append(partition_fingerprint(qos.m_partition));
+
+    return ret;
+}
+
+/*
+ * Warns about the reasons a writer and a reader do not match. Called both after checking their QoS and when the
+ * result of a previous check is reused, so the same warnings are given either way.
+ */
+static void log_incompatible_qos(
+        const WriterProxyData* wdata,
+        const ReaderProxyData* rdata,
+        bool remote_reader,
+        const EDP::MatchingFailureMask& reason,
+        const fastdds::dds::PolicyMask& incompatible_qos)
+{
+    const GUID_t& remote_guid = remote_reader ? rdata->guid() : wdata->guid();
+
+    if (incompatible_qos.test(fastdds::dds::RELIABILITY_QOS_POLICY_ID))
+    {
+        if (remote_reader)
+        {
+            logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "):Remote Reader "
+                                                             << remote_guid << " is Reliable and local writer is BE ");
+        }
+        else
+        {
+            logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << wdata->topicName() << "): Remote Writer "
+                                                             << remote_guid
+                                                             << " is Best Effort and local reader is RELIABLE ");
+        }
+    }
+
+    if (incompatible_qos.test(fastdds::dds::DURABILITY_QOS_POLICY_ID))
+    {
+        // TODO (MCC) Change log message
+        if (remote_reader)
+        {
+            logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "):RemoteReader "
+                                                             << remote_guid <<
+                    " has TRANSIENT_LOCAL DURABILITY and we offer VOLATILE");
+        }
+        else
+        {
+            logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << wdata->topicName() << "):RemoteWriter "
+                                                             << remote_guid <<
+                    " has VOLATILE DURABILITY and we want TRANSIENT_LOCAL");
+        }
+    }
+
+    if (incompatible_qos.test(fastdds::dds::OWNERSHIP_QOS_POLICY_ID))
+    {
+        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "):Remote "
+                                                         << (remote_reader ? "reader " : "Writer ")
+                                                         << remote_guid << " has different Ownership Kind");
+    }
+
+    if (incompatible_qos.test(fastdds::dds::DEADLINE_QOS_POLICY_ID))
+    {
+        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "):Remote "
+                                                         << (remote_reader ? "reader " : "Writer ")
+                                                         << remote_guid << " has smaller DEADLINE period");
+    }
+
+    if (incompatible_qos.test(fastdds::dds::DISABLEPOSITIVEACKS_QOS_POLICY_ID))
+    {
+        logWarning(RTPS_EDP, "Incompatible Disable Positive Acks QoS: writer is enabled but reader is not");
+    }
+
+    if (incompatible_qos.test(fastdds::dds::LIVELINESS_QOS_POLICY_ID))
+    {
+        // Both the lease duration and the kind are reported under the same policy
+        if (wdata->m_qos.m_liveliness.lease_duration > rdata->m_qos.m_liveliness.lease_duration)
+        {
+            logWarning(RTPS_EDP, "Incompatible liveliness lease durations: offered lease duration "
+                    << wdata->m_qos.m_liveliness.lease_duration << " must be <= requested lease duration "
+                    << rdata->m_qos.m_liveliness.lease_duration);
+        }
+        if (wdata->m_qos.m_liveliness.kind < rdata->m_qos.m_liveliness.kind)
+        {
+            logWarning(RTPS_EDP, "Incompatible liveliness kinds: offered kind is < requested kind");
+        }
+    }
+
+    if (reason.test(EDP::MatchingFailureMask::partitions))
+    {
+        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "): Different Partitions");
+    }
+}
+
 EDP::EDP(
         PDP* p,
         RTPSParticipantImpl* part)
@@ -214,6 +394,13 @@ bool EDP::newLocalReaderProxyData(
         return false;
     }
 
+    {
+        std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
+        std::string topic = att.getTopicName().to_string();
+        add_to_topic_index(local_readers_by_topic_, topic, reader);
+        local_endpoint_topics_[reader->getGuid()] = topic;
+    }
+
     //PAIRING
     pairing_reader_proxy_with_any_local_writer(participant_guid, reader_data);
     pairingReader(reader, participant_guid, *reader_data);
@@ -343,6 +530,13 @@ bool EDP::newLocalWriterProxyData(
         return false;
     }
 
+    {
+        std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
+        std::string topic = att.getTopicName().to_string();
+        add_to_topic_index(local_writers_by_topic_, topic, writer);
+        local_endpoint_topics_[writer->getGuid()] = topic;
+    }
+
     //PAIRING
     pairing_writer_proxy_with_any_local_reader(participant_guid, writer_data);
     pairingWriter(writer, participant_guid, *writer_data);
@@ -517,6 +711,30 @@ bool EDP::updatedLocalWriter(
     return false;
 }
 
+void EDP::unregister_local_reader(
+        RTPSReader* R)
+{
+    std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
+    auto topic_it = local_endpoint_topics_.find(R->getGuid());
+    if (topic_it != local_endpoint_topics_.end())
+    {
+        remove_from_topic_index(local_readers_by_topic_, topic_it->second, R);
+        local_endpoint_topics_.erase(topic_it);
+    }
+}
+
+void EDP::unregister_local_writer(
+        RTPSWriter* W)
+{
+    std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
+    auto topic_it = local_endpoint_topics_.find(W->getGuid());
+    if (topic_it != local_endpoint_topics_.end())
+    {
+        remove_from_topic_index(local_writers_by_topic_, topic_it->second, W);
+        local_endpoint_topics_.erase(topic_it);
+    }
+}
+
 bool EDP::unpairWriterProxy(
         const GUID_t& participant_guid,
         const GUID_t& writer_guid,
@@ -526,9 +744,24 @@ bool EDP::unpairWriterProxy(
 
     logInfo(RTPS_EDP, writer_guid);
 
+    std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-            rit != mp_RTPSParticipant->userReadersListEnd(); ++rit)
+
+    // Only the readers on the topic of the writer may be matched with it
+    std::vector<RTPSReader*> readers;
+    auto topic_it = discovered_endpoints_.find(writer_guid);
+    if (topic_it != discovered_endpoints_.end())
+    {
+        readers = topic_candidates(local_readers_by_topic_, topic_it->second.topic);
+        remove_from_topic_index(discovered_writers_by_topic_, topic_it->second.topic, writer_guid);
+        discovered_endpoints_.erase(topic_it);
+    }
+    else
+    {
+        readers.assign(mp_RTPSParticipant->userReadersListBegin(), mp_RTPSParticipant->userReadersListEnd());
+    }
+
+    for (std::vector<RTPSReader*>::iterator rit = readers.begin(); rit != readers.end(); ++rit)
     {
         if ((*rit)->matched_writer_remove(writer_guid, removed_by_lease))
         {
@@ -563,9 +796,24 @@ bool EDP::unpairReaderProxy(
 
     logInfo(RTPS_EDP, reader_guid);
 
+    std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
-            wit != mp_RTPSParticipant->userWritersListEnd(); ++wit)
+
+    // Only the writers on the topic of the reader may be matched with it
+    std::vector<RTPSWriter*> writers;
+    auto topic_it = discovered_endpoints_.find(reader_guid);
+    if (topic_it != discovered_endpoints_.end())
+    {
+        writers = topic_candidates(local_writers_by_topic_, topic_it->second.topic);
+        remove_from_topic_index(discovered_readers_by_topic_, topic_it->second.topic, reader_guid);
+        discovered_endpoints_.erase(topic_it);
+    }
+    else
+    {
+        writers.assign(mp_RTPSParticipant->userWritersListBegin(), mp_RTPSParticipant->userWritersListEnd());
+    }
+
+    for (std::vector<RTPSWriter*>::iterator wit = writers.begin(); wit != writers.end(); ++wit)
     {
         if ((*wit)->matched_reader_remove(reader_guid))
         {
@@ -640,55 +888,50 @@ bool EDP::valid_matching(
         return false;
     }
 
+    DiscoveredEndpoint computed_writer;
+    DiscoveredEndpoint computed_reader;
+    const DiscoveredEndpoint& wmatching = matching_data(*wdata, computed_writer);
+    const DiscoveredEndpoint& rmatching = matching_data(*rdata, computed_reader);
+    if (cached_qos_compatibility(wmatching.qos_fingerprint, rmatching.qos_fingerprint, reason, incompatible_qos))
+    {
+        log_incompatible_qos(wdata, rdata, true, reason, incompatible_qos);
+        return reason.none();
+    }
+
     if ( wdata->m_qos.m_reliability.kind == BEST_EFFORT_RELIABILITY_QOS
             && rdata->m_qos.m_reliability.kind == RELIABLE_RELIABILITY_QOS)
     //Means our writer is BE but the reader wants RE
     {
-        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "):Remote Reader "
-                                                         << rdata->guid() << " is Reliable and local writer is BE ");
         incompatible_qos.set(fastdds::dds::RELIABILITY_QOS_POLICY_ID);
     }
 
     if (wdata->m_qos.m_durability.kind < rdata->m_qos.m_durability.kind)
     {
-        // TODO (MCC) Change log message
-        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "):RemoteReader "
-                                                         << rdata->guid() <<
-                " has TRANSIENT_LOCAL DURABILITY and we offer VOLATILE");
         incompatible_qos.set(fastdds::dds::DURABILITY_QOS_POLICY_ID);
     }
 
     if (wdata->m_qos.m_ownership.kind != rdata->m_qos.m_ownership.kind)
     {
-        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "):Remote reader "
-                                                         << rdata->guid() << " has different Ownership Kind");
         incompatible_qos.set(fastdds::dds::OWNERSHIP_QOS_POLICY_ID);
     }
 
     if (wdata->m_qos.m_deadline.period > rdata->m_qos.m_deadline.period)
     {
-        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "):Remote reader "
-                                                         << rdata->guid() << " has smaller DEADLINE period");
         incompatible_qos.set(fastdds::dds::DEADLINE_QOS_POLICY_ID);
     }
 
     if (!wdata->m_qos.m_disablePositiveACKs.enabled && rdata->m_qos.m_disablePositiveACKs.enabled)
     {
-        logWarning(RTPS_EDP, "Incompatible Disable Positive Acks QoS: writer is enabled but reader is not");
         incompatible_qos.set(fastdds::dds::DISABLEPOSITIVEACKS_QOS_POLICY_ID);
     }
 
     if (wdata->m_qos.m_liveliness.lease_duration > rdata->m_qos.m_liveliness.lease_duration)
     {
-        logWarning(RTPS_EDP, "Incompatible liveliness lease durations: offered lease duration "
-                << wdata->m_qos.m_liveliness.lease_duration << " must be <= requested lease duration "
-                << rdata->m_qos.m_liveliness.lease_duration);
         incompatible_qos.set(fastdds::dds::LIVELINESS_QOS_POLICY_ID);
     }
 
     if (wdata->m_qos.m_liveliness.kind < rdata->m_qos.m_liveliness.kind)
     {
-        logWarning(RTPS_EDP, "Incompatible liveliness kinds: offered kind is < requested kind");
         incompatible_qos.set(fastdds::dds::LIVELINESS_QOS_POLICY_ID);
     }
 
@@ -700,66 +943,16 @@ bool EDP::valid_matching(
     if (incompatible_qos.any())
     {
         reason.set(MatchingFailureMask::incompatible_qos);
-        return false;
     }
-
     //Partition check:
-    bool matched = false;
-    if (wdata->m_qos.m_partition.empty() && rdata->m_qos.m_partition.empty())
-    {
-        matched = true;
-    }
-    else if (wdata->m_qos.m_partition.empty() && rdata->m_qos.m_partition.size() > 0)
-    {
-        for (auto rnameit = rdata->m_qos.m_partition.begin();
-                rnameit != rdata->m_qos.m_partition.end(); ++rnameit)
-        {
-            if (rnameit->size() == 0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else if (wdata->m_qos.m_partition.size() > 0 && rdata->m_qos.m_partition.empty())
-    {
-        for (auto wnameit = wdata->m_qos.m_partition.begin();
-                wnameit !=  wdata->m_qos.m_partition.end(); ++wnameit)
-        {
-            if (wnameit->size() == 0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else
+    else if (!wmatching.partitions->matches(*rmatching.partitions))
     {
-        for (auto wnameit = wdata->m_qos.m_partition.begin();
-                wnameit !=  wdata->m_qos.m_partition.end(); ++wnameit)
-        {
-            for (auto rnameit = rdata->m_qos.m_partition.begin();
-                    rnameit != rdata->m_qos.m_partition.end(); ++rnameit)
-            {
-                if (StringMatching::matchString(wnameit->name(), rnameit->name()))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-            if (matched)
-            {
-                break;
-            }
-        }
-    }
-    if (!matched) //Different partitions
-    {
-        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << rdata->topicName() << "): Different Partitions");
         reason.set(MatchingFailureMask::partitions);
     }
 
-    return matched;
+    log_incompatible_qos(wdata, rdata, true, reason, incompatible_qos);
+    cache_qos_compatibility(wmatching.qos_fingerprint, rmatching.qos_fingerprint, reason, incompatible_qos);
+    return reason.none();
 }
 
 /**
@@ -870,51 +1063,45 @@ bool EDP::valid_matching(
         reason.set(MatchingFailureMask::inconsistent_topic);
         return false;
     }
+
+    DiscoveredEndpoint computed_writer;
+    DiscoveredEndpoint computed_reader;
+    const DiscoveredEndpoint& wmatching = matching_data(*wdata, computed_writer);
+    const DiscoveredEndpoint& rmatching = matching_data(*rdata, computed_reader);
+    if (cached_qos_compatibility(wmatching.qos_fingerprint, rmatching.qos_fingerprint, reason, incompatible_qos))
+    {
+        log_incompatible_qos(wdata, rdata, false, reason, incompatible_qos);
+        return reason.none();
+    }
+
     if (rdata->m_qos.m_reliability.kind == RELIABLE_RELIABILITY_QOS
             && wdata->m_qos.m_reliability.kind == BEST_EFFORT_RELIABILITY_QOS)
     //Means our reader is reliable but hte writer is not
     {
-        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << wdata->topicName() << "): Remote Writer " << wdata->guid()
-                                                         << " is Best Effort and local reader is RELIABLE "
-                );
         incompatible_qos.set(fastdds::dds::RELIABILITY_QOS_POLICY_ID);
     }
     if (rdata->m_qos.m_durability.kind > wdata->m_qos.m_durability.kind)
     {
-        // TODO (MCC) Change log message
-        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << wdata->topicName() << "):RemoteWriter " << wdata->guid()
-                                                         << " has VOLATILE DURABILITY and we want TRANSIENT_LOCAL";
-                );
         incompatible_qos.set(fastdds::dds::DURABILITY_QOS_POLICY_ID);
     }
     if (rdata->m_qos.m_ownership.kind != wdata->m_qos.m_ownership.kind)
     {
-        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " << wdata->topicName() << "):Remote Writer " << wdata->guid()
-                                                         << " has different Ownership Kind");
         incompatible_qos.set(fastdds::dds::OWNERSHIP_QOS_POLICY_ID);
     }
     if (rdata->m_qos.m_deadline.period < wdata->m_qos.m_deadline.period)
     {
-        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: "
-                << wdata->topicName() << "):RemoteWriter "
-                << wdata->guid() << "has smaller DEADLINE period");
         incompatible_qos.set(fastdds::dds::DEADLINE_QOS_POLICY_ID);
     }
     if (rdata->m_qos.m_disablePositiveACKs.enabled && !wdata->m_qos.m_disablePositiveACKs.enabled)
     {
-        logWarning(RTPS_EDP, "Incompatible Disable Positive Acks QoS: writer is enabled but reader is not");
         incompatible_qos.set(fastdds::dds::DISABLEPOSITIVEACKS_QOS_POLICY_ID);
     }
     if (wdata->m_qos.m_liveliness.lease_duration > rdata->m_qos.m_liveliness.lease_duration)
     {
-        logWarning(RTPS_EDP, "Incompatible liveliness lease durations: offered lease duration "
-                << wdata->m_qos.m_liveliness.lease_duration << " must be <= requested lease duration "
-                << rdata->m_qos.m_liveliness.lease_duration);
         incompatible_qos.set(fastdds::dds::LIVELINESS_QOS_POLICY_ID);
     }
     if (wdata->m_qos.m_liveliness.kind < rdata->m_qos.m_liveliness.kind)
     {
-        logWarning(RTPS_EDP, "Incompatible liveliness kinds: offered kind is < than requested kind");
         incompatible_qos.set(fastdds::dds::LIVELINESS_QOS_POLICY_ID);
     }
 #if HAVE_SECURITY
@@ -925,68 +1112,16 @@ bool EDP::valid_matching(
     if (incompatible_qos.any())
     {
         reason.set(MatchingFailureMask::incompatible_qos);
-        return false;
     }
-
     //Partition check:
-    bool matched = false;
-    if (rdata->m_qos.m_partition.empty() && wdata->m_qos.m_partition.empty())
-    {
-        matched = true;
-    }
-    else if (rdata->m_qos.m_partition.empty() && wdata->m_qos.m_partition.size() > 0)
-    {
-        for (auto rnameit = wdata->m_qos.m_partition.begin();
-                rnameit != wdata->m_qos.m_partition.end(); ++rnameit)
-        {
-            if (rnameit->size() == 0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else if (rdata->m_qos.m_partition.size() > 0 && wdata->m_qos.m_partition.empty())
+    else if (!wmatching.partitions->matches(*rmatching.partitions))
     {
-        for (auto wnameit = rdata->m_qos.m_partition.begin();
-                wnameit !=  rdata->m_qos.m_partition.end(); ++wnameit)
-        {
-            if (wnameit->size() == 0)
-            {
-                matched = true;
-                break;
-            }
-        }
-    }
-    else
-    {
-        for (auto wnameit = rdata->m_qos.m_partition.begin();
-                wnameit !=  rdata->m_qos.m_partition.end(); ++wnameit)
-        {
-            for (auto rnameit = wdata->m_qos.m_partition.begin();
-                    rnameit != wdata->m_qos.m_partition.end(); ++rnameit)
-            {
-                if (StringMatching::matchString(wnameit->name(), rnameit->name()))
-                {
-                    matched = true;
-                    break;
-                }
-            }
-            if (matched)
-            {
-                break;
-            }
-        }
-    }
-    if (!matched) //Different partitions
-    {
-        logWarning(RTPS_EDP, "INCOMPATIBLE QOS (topic: " <<  wdata->topicName() <<
-                "): Different Partitions");
         reason.set(MatchingFailureMask::partitions);
     }
 
-    return matched;
-
+    log_incompatible_qos(wdata, rdata, false, reason, incompatible_qos);
+    cache_qos_compatibility(wmatching.qos_fingerprint, rmatching.qos_fingerprint, reason, incompatible_qos);
+    return reason.none();
 }
 
 //TODO Estas cuatro funciones comparten codigo comun (2 a 2) y se podrían seguramente combinar.
@@ -1001,75 +1136,78 @@ bool EDP::pairingReader(
     logInfo(RTPS_EDP, rdata.guid() << " in topic: \"" << rdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    for (ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-            pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    std::vector<GUID_t> writers = topic_candidates(discovered_writers_by_topic_, rdata.topicName().to_string());
+    for (const GUID_t& candidate : writers)
     {
-        for (auto& pair : *(*pit)->m_writers)
+        ParticipantProxyData* pdata = nullptr;
+        WriterProxyData* wdatait = find_discovered_writer(candidate, pdata);
+        if (wdatait == nullptr)
         {
-            WriterProxyData* wdatait = pair.second;
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
-            const GUID_t& reader_guid = R->getGuid();
-            const GUID_t& writer_guid = wdatait->guid();
+            continue;
+        }
 
-            if (valid)
-            {
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&rdata, wdatait, no_match_reason, incompatible_qos);
+        const GUID_t& reader_guid = R->getGuid();
+        const GUID_t& writer_guid = wdatait->guid();
+
+        if (valid)
+        {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid, (*pit)->m_guid,
-                        *wdatait, R->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
-                }
+            if (!mp_RTPSParticipant->security_manager().discovered_writer(R->m_guid, pdata->m_guid,
+                    *wdatait, R->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for reader " << reader_guid);
+            }
 #else
-                if (R->matched_writer_add(*wdatait))
+            if (R->matched_writer_add(*wdatait))
+            {
+                logInfo(RTPS_EDP_MATCH,
+                        "WP:" << wdatait->guid() << " match R:" << R->getGuid() << ". RLoc:" <<
+                        wdatait->remote_locators());
+                //MATCHED AND ADDED CORRECTLY:
+                if (R->getListener() != nullptr)
                 {
-                    logInfo(RTPS_EDP_MATCH,
-                            "WP:" << wdatait->guid() << " match R:" << R->getGuid() << ". RLoc:" <<
-                            wdatait->remote_locators());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (R->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        R->getListener()->onReaderMatched(R, info);
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    R->getListener()->onReaderMatched(R, info);
 
-                        const SubscriptionMatchedStatus& sub_info =
-                                update_subscription_matched_status(reader_guid, writer_guid, 1);
-                        R->getListener()->onReaderMatched(R, sub_info);
-                    }
+                    const SubscriptionMatchedStatus& sub_info =
+                            update_subscription_matched_status(reader_guid, writer_guid, 1);
+                    R->getListener()->onReaderMatched(R, sub_info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && R->getListener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && R->getListener() != nullptr)
-                {
-                    R->getListener()->on_requested_incompatible_qos(R, incompatible_qos);
-                }
+                R->getListener()->on_requested_incompatible_qos(R, incompatible_qos);
+            }
 
-                //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
-                if (R->matched_writer_is_matched(wdatait->guid())
-                        && R->matched_writer_remove(wdatait->guid()))
-                {
+            //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
+            if (R->matched_writer_is_matched(wdatait->guid())
+                    && R->matched_writer_remove(wdatait->guid()))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
-                            wdatait->guid());
+                mp_RTPSParticipant->security_manager().remove_writer(reader_guid, participant_guid,
+                        wdatait->guid());
 #endif // if HAVE_SECURITY
 
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (R->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = writer_guid;
-                        R->getListener()->onReaderMatched(R, info);
+                //MATCHED AND ADDED CORRECTLY:
+                if (R->getListener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = writer_guid;
+                    R->getListener()->onReaderMatched(R, info);
 
-                        const SubscriptionMatchedStatus& sub_info =
-                                update_subscription_matched_status(reader_guid, writer_guid, -1);
-                        R->getListener()->onReaderMatched(R, sub_info);
-                    }
+                    const SubscriptionMatchedStatus& sub_info =
+                            update_subscription_matched_status(reader_guid, writer_guid, -1);
+                    R->getListener()->onReaderMatched(R, sub_info);
                 }
             }
         }
@@ -1088,80 +1226,83 @@ bool EDP::pairingWriter(
     logInfo(RTPS_EDP, W->getGuid() << " in topic: \"" << wdata.topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
 
-    for (ResourceLimitedVector<ParticipantProxyData*>::const_iterator pit = mp_PDP->ParticipantProxiesBegin();
-            pit != mp_PDP->ParticipantProxiesEnd(); ++pit)
+    std::vector<GUID_t> readers = topic_candidates(discovered_readers_by_topic_, wdata.topicName().to_string());
+    for (const GUID_t& candidate : readers)
     {
-        for (auto& pair : *(*pit)->m_readers)
+        ParticipantProxyData* pdata = nullptr;
+        ReaderProxyData* rdatait = find_discovered_reader(candidate, pdata);
+        if (rdatait == nullptr)
         {
-            ReaderProxyData* rdatait = pair.second;
-            const GUID_t& reader_guid = rdatait->guid();
-            if (reader_guid == c_Guid_Unknown)
-            {
-                continue;
-            }
+            continue;
+        }
 
-            MatchingFailureMask no_match_reason;
-            fastdds::dds::PolicyMask incompatible_qos;
-            bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
+        const GUID_t& reader_guid = rdatait->guid();
+        if (reader_guid == c_Guid_Unknown)
+        {
+            continue;
+        }
 
-            if (valid)
-            {
+        MatchingFailureMask no_match_reason;
+        fastdds::dds::PolicyMask incompatible_qos;
+        bool valid = valid_matching(&wdata, rdatait, no_match_reason, incompatible_qos);
+
+        if (valid)
+        {
 #if HAVE_SECURITY
-                if (!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), (*pit)->m_guid,
-                        *rdatait, W->getAttributes().security_attributes()))
-                {
-                    logError(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
-                }
+            if (!mp_RTPSParticipant->security_manager().discovered_reader(W->getGuid(), pdata->m_guid,
+                    *rdatait, W->getAttributes().security_attributes()))
+            {
+                logError(RTPS_EDP, "Security manager returns an error for writer " << W->getGuid());
+            }
 #else
-                if (W->matched_reader_add(*rdatait))
+            if (W->matched_reader_add(*rdatait))
+            {
+                logInfo(RTPS_EDP_MATCH,
+                        "RP:" << rdatait->guid() << " match W:" << W->getGuid() << ". WLoc:" <<
+                        rdatait->remote_locators());
+                //MATCHED AND ADDED CORRECTLY:
+                if (W->getListener() != nullptr)
                 {
-                    logInfo(RTPS_EDP_MATCH,
-                            "RP:" << rdatait->guid() << " match W:" << W->getGuid() << ". WLoc:" <<
-                            rdatait->remote_locators());
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (W->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = MATCHED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        W->getListener()->onWriterMatched(W, info);
+                    MatchingInfo info;
+                    info.status = MATCHED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    W->getListener()->onWriterMatched(W, info);
 
-                        const GUID_t& writer_guid = W->getGuid();
-                        const PublicationMatchedStatus& pub_info =
-                                update_publication_matched_status(reader_guid, writer_guid, 1);
-                        W->getListener()->onWriterMatched(W, pub_info);
-                    }
+                    const GUID_t& writer_guid = W->getGuid();
+                    const PublicationMatchedStatus& pub_info =
+                            update_publication_matched_status(reader_guid, writer_guid, 1);
+                    W->getListener()->onWriterMatched(W, pub_info);
                 }
-#endif // if HAVE_SECURITY
             }
-            else
+#endif // if HAVE_SECURITY
+        }
+        else
+        {
+            if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && W->getListener() != nullptr)
             {
-                if (no_match_reason.test(MatchingFailureMask::incompatible_qos) && W->getListener() != nullptr)
-                {
-                    W->getListener()->on_offered_incompatible_qos(W, incompatible_qos);
-                }
+                W->getListener()->on_offered_incompatible_qos(W, incompatible_qos);
+            }
 
-                //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
-                if (W->matched_reader_is_matched(reader_guid) && W->matched_reader_remove(reader_guid))
-                {
+            //logInfo(RTPS_EDP,RTPS_CYAN<<"Valid Matching to writerProxy: "<<wdatait->m_guid<<RTPS_DEF<<endl);
+            if (W->matched_reader_is_matched(reader_guid) && W->matched_reader_remove(reader_guid))
+            {
 #if HAVE_SECURITY
-                    mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), participant_guid, reader_guid);
+                mp_RTPSParticipant->security_manager().remove_reader(W->getGuid(), participant_guid, reader_guid);
 #endif // if HAVE_SECURITY
-                    //MATCHED AND ADDED CORRECTLY:
-                    if (W->getListener() != nullptr)
-                    {
-                        MatchingInfo info;
-                        info.status = REMOVED_MATCHING;
-                        info.remoteEndpointGuid = reader_guid;
-                        W->getListener()->onWriterMatched(W, info);
+                //MATCHED AND ADDED CORRECTLY:
+                if (W->getListener() != nullptr)
+                {
+                    MatchingInfo info;
+                    info.status = REMOVED_MATCHING;
+                    info.remoteEndpointGuid = reader_guid;
+                    W->getListener()->onWriterMatched(W, info);
 
-                        const GUID_t& writer_guid = W->getGuid();
-                        const PublicationMatchedStatus& pub_info =
-                                update_publication_matched_status(reader_guid, writer_guid, -1);
-                        W->getListener()->onWriterMatched(W, pub_info);
+                    const GUID_t& writer_guid = W->getGuid();
+                    const PublicationMatchedStatus& pub_info =
+                            update_publication_matched_status(reader_guid, writer_guid, -1);
+                    W->getListener()->onWriterMatched(W, pub_info);
 
 
-                    }
                 }
             }
         }
@@ -1178,8 +1319,9 @@ bool EDP::pairing_reader_proxy_with_any_local_writer(
     logInfo(RTPS_EDP, rdata->guid() << " in topic: \"" << rdata->topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSWriter*>::iterator wit = mp_RTPSParticipant->userWritersListBegin();
-            wit != mp_RTPSParticipant->userWritersListEnd(); ++wit)
+    index_discovered_reader(*rdata);
+    std::vector<RTPSWriter*> writers = topic_candidates(local_writers_by_topic_, rdata->topicName().to_string());
+    for (std::vector<RTPSWriter*>::iterator wit = writers.begin(); wit != writers.end(); ++wit)
     {
         (*wit)->getMutex().lock();
         GUID_t writerGUID = (*wit)->getGuid();
@@ -1373,8 +1515,9 @@ bool EDP::pairing_writer_proxy_with_any_local_reader(
     logInfo(RTPS_EDP, wdata->guid() << " in topic: \"" << wdata->topicName() << "\"");
     std::lock_guard<std::recursive_mutex> pguard(*mp_PDP->getMutex());
     std::lock_guard<std::recursive_mutex> guard(*mp_RTPSParticipant->getParticipantMutex());
-    for (std::vector<RTPSReader*>::iterator rit = mp_RTPSParticipant->userReadersListBegin();
-            rit != mp_RTPSParticipant->userReadersListEnd(); ++rit)
+    index_discovered_writer(*wdata);
+    std::vector<RTPSReader*> readers = topic_candidates(local_readers_by_topic_, wdata->topicName().to_string());
+    for (std::vector<RTPSReader*>::iterator rit = readers.begin(); rit != readers.end(); ++rit)
     {
         GUID_t readerGUID;
         (*rit)->getMutex().lock();
@@ -1565,18 +1708,8 @@ bool EDP::checkTypeIdentifier(
         const WriterProxyData* wdata,
         const ReaderProxyData* rdata) const
 {
-    // TODO - Remove once XCDR or XCDR2 is implemented.
-    TypeConsistencyEnforcementQosPolicy coercion;
-    coercion.m_kind = DISALLOW_TYPE_COERCION;
-    coercion.m_ignore_member_names = false;
-    coercion.m_ignore_string_bounds = false;
-    coercion.m_force_type_validation = true;
-    coercion.m_prevent_type_widening = true;
-    coercion.m_ignore_sequence_bounds = false;
     return wdata->type_id().m_type_identifier._d() != static_cast<uint8_t>(0x00) &&
-           wdata->type_id().m_type_identifier.consistent(
-        //rdata->type_id().m_type_identifier, rdata->m_qos.type_consistency);
-        rdata->type_id().m_type_identifier, coercion);
+           consistent_types(wdata->type_id().m_type_identifier, rdata->type_id().m_type_identifier);
 }
 
 bool EDP::hasTypeIdentifier(
@@ -1616,24 +1749,7 @@ bool EDP::checkTypeObject(
 
         if (wtype != nullptr)
         {
-            // TODO - Remove once XCDR or XCDR2 is implemented.
-            /*
-             * Currently consistency checks are applied to type structure and compatibility,
-             * but doesn't check about annotations behavior.
-             * This may cause false matching cases with annotations @key or @non_serialize,
-             * for example.
-             * Once XCDR or XCDR2 is implemented, is it doesn't solve this cases, we must
-             * think about this problem and how consistency could solve it.
-             */
-            TypeConsistencyEnforcementQosPolicy coercion;
-            coercion.m_kind = DISALLOW_TYPE_COERCION;
-            coercion.m_ignore_member_names = false;
-            coercion.m_ignore_string_bounds = false;
-            coercion.m_force_type_validation = true;
-            coercion.m_prevent_type_widening = true;
-            coercion.m_ignore_sequence_bounds = false;
-            //return wtype->consistent(*rtype, rdata->m_qos.type_consistency);
-            return wtype->consistent(*rtype, coercion);
+            return consistent_types(*wtype, *rtype);
         }
 
         return false;
@@ -1665,6 +1781,181 @@ bool EDP::checkTypeObject(
     return false;
 }
 
+bool EDP::consistent_types(
+        const types::TypeIdentifier& wtype,
+        const types::TypeIdentifier& rtype) const
+{
+    // TODO - Remove once XCDR or XCDR2 is implemented.
+    /*
+     * Currently consistency checks are applied to type structure and compatibility,
+     * but doesn't check about annotations behavior.
+     * This may cause false matching cases with annotations @key or @non_serialize,
+     * for example.
+     * Once XCDR or XCDR2 is implemented, is it doesn't solve this cases, we must
+     * think about this problem and how consistency could solve it.
+     */
+    TypeConsistencyEnforcementQosPolicy coercion;
+    coercion.m_kind = DISALLOW_TYPE_COERCION;
+    coercion.m_ignore_member_names = false;
+    coercion.m_ignore_string_bounds = false;
+    coercion.m_force_type_validation = true;
+    coercion.m_prevent_type_widening = true;
+    coercion.m_ignore_sequence_bounds = false;
+
+    bool hashed = (wtype._d() == types::EK_COMPLETE || wtype._d() == types::EK_MINIMAL) && (wtype._d() == rtype._d());
+    if (!hashed)
+    {
+        //return wtype.consistent(rtype, rdata->m_qos.type_consistency);
+        return wtype.consistent(rtype, coercion);
+    }
+
+    const size_t hash_size = sizeof(types::EquivalenceHash);
+    if (0 == memcmp(wtype.equivalence_hash(), rtype.equivalence_hash(), hash_size))
+    {
+        return true;
+    }
+
+    TypeHashPair key;
+    key[0] = wtype._d();
+    memcpy(&key[1], wtype.equivalence_hash(), hash_size);
+    memcpy(&key[1 + hash_size], rtype.equivalence_hash(), hash_size);
+    {
+        std::lock_guard<std::mutex> guard(type_consistency_mutex_);
+        auto it = type_consistency_index_.find(key);
+        if (it != type_consistency_index_.end())
+        {
+            type_consistency_cache_.splice(type_consistency_cache_.begin(), type_consistency_cache_, it->second);
+            return it->second->consistent;
+        }
+    }
+
+    // Remote type objects may be registered later, for instance through the type lookup service
+    types::TypeObjectFactory* factory = types::TypeObjectFactory::get_instance();
+    if (factory->get_type_object(&wtype) == nullptr || factory->get_type_object(&rtype) == nullptr)
+    {
+        return false;
+    }
+
+    bool consistent = wtype.consistent(rtype, coercion);
+    std::lock_guard<std::mutex> guard(type_consistency_mutex_);
+    if (type_consistency_index_.count(key) == 0)
+    {
+        if (type_consistency_cache_.size() >= max_type_consistency_cache_size)
+        {
+            type_consistency_index_.erase(type_consistency_cache_.back().types);
+            type_consistency_cache_.pop_back();
+        }
+
+        type_consistency_cache_.push_front(TypeConsistency{key, consistent});
+        type_consistency_index_.emplace(key, type_consistency_cache_.begin());
+    }
+    return consistent;
+}
+
+bool EDP::cached_qos_compatibility(
+        const std::string& writer_fingerprint,
+        const std::string& reader_fingerprint,
+        MatchingFailureMask& reason,
+        fastdds::dds::PolicyMask& incompatible_qos) const
+{
+    std::lock_guard<std::mutex> guard(qos_compatibility_mutex_);
+    auto it = qos_compatibility_index_.find(QosFingerprintRefs(&writer_fingerprint, &reader_fingerprint));
+    if (it == qos_compatibility_index_.end())
+    {
+        return false;
+    }
+
+    // Moving the entry to the front keeps valid the iterator and the fingerprints pointed to by the index
+    qos_compatibility_cache_.splice(qos_compatibility_cache_.begin(), qos_compatibility_cache_, it->second);
+    reason = it->second->reason;
+    incompatible_qos = it->second->incompatible_qos;
+    return true;
+}
+
+void EDP::cache_qos_compatibility(
+        const std::string& writer_fingerprint,
+        const std::string& reader_fingerprint,
+        const MatchingFailureMask& reason,
+        const fastdds::dds::PolicyMask& incompatible_qos) const
+{
+    std::lock_guard<std::mutex> guard(qos_compatibility_mutex_);
+    auto it = qos_compatibility_index_.find(QosFingerprintRefs(&writer_fingerprint, &reader_fingerprint));
+    if (it != qos_compatibility_index_.end())
+    {
+        // Another thread checked the same QoS meanwhile
+        qos_compatibility_cache_.splice(qos_compatibility_cache_.begin(), qos_compatibility_cache_, it->second);
+        return;
+    }
+
+    if (qos_compatibility_cache_.size() >= max_qos_compatibility_cache_size)
+    {
+        const QosCompatibility& oldest = qos_compatibility_cache_.back();
+        qos_compatibility_index_.erase(QosFingerprintRefs(&oldest.fingerprints.first, &oldest.fingerprints.second));
+        qos_compatibility_cache_.pop_back();
+    }
+
+    qos_compatibility_cache_.emplace_front();
+    QosCompatibility& result = qos_compatibility_cache_.front();
+    result.fingerprints.first = writer_fingerprint;
+    result.fingerprints.second = reader_fingerprint;
+    result.reason = reason;
+    result.incompatible_qos = incompatible_qos;
+    qos_compatibility_index_.emplace(
+        QosFingerprintRefs(&result.fingerprints.first, &result.fingerprints.second),
+        qos_compatibility_cache_.begin());
+}
+
+std::shared_ptr<const PartitionMatcher> EDP::partition_matcher(
+        const fastdds::dds::PartitionQosPolicy& partitions) const
+{
+    std::string key = partition_fingerprint(partitions);
+    std::lock_guard<std::mutex> guard(qos_compatibility_mutex_);
+    auto it = partition_matcher_index_.find(&key);
+    if (it != partition_matcher_index_.end())
+    {
+        partition_matchers_.splice(partition_matchers_.begin(), partition_matchers_, it->second);
+        return it->second->matcher;
+    }
+
+    if (partition_matchers_.size() >= max_partition_matchers)
+    {
+        // Endpoints using the dropped matcher keep their own reference to it
+        partition_matcher_index_.erase(&partition_matchers_.back().fingerprint);
+        partition_matchers_.pop_back();
+    }
+
+    partition_matchers_.emplace_front();
+    PartitionMatcherEntry& entry = partition_matchers_.front();
+    entry.fingerprint = std::move(key);
+    entry.matcher = std::make_shared<const PartitionMatcher>(partitions);
+    partition_matcher_index_.emplace(&entry.fingerprint, partition_matchers_.begin());
+    return entry.matcher;
+}
+
+template<typename ProxyData>
+void EDP::fill_matching_data(
+        const ProxyData& data,
+        DiscoveredEndpoint& endpoint) const
+{
+    endpoint.qos_fingerprint = compute_qos_fingerprint(data.m_qos);
+    endpoint.partitions = partition_matcher(data.m_qos.m_partition);
+}
+
+template<typename ProxyData>
+const EDP::DiscoveredEndpoint& EDP::matching_data(
+        const ProxyData& data,
+        DiscoveredEndpoint& computed) const
+{
+    auto it = discovered_endpoints_.find(data.guid());
+    if (it != discovered_endpoints_.end())
+    {
+        return it->second;
+    }
+
+    fill_matching_data(data, computed);
+    return computed;
+}
+
 bool EDP::hasTypeObject(
         const WriterProxyData* wdata,
         const ReaderProxyData* rdata) const
@@ -1698,6 +1989,58 @@ bool EDP::hasTypeObject(
     return false;
 }
 
+void EDP::index_discovered_reader(
+        const ReaderProxyData& rdata)
+{
+    DiscoveredEndpoint& endpoint = discovered_endpoints_[rdata.guid()];
+    endpoint.topic = rdata.topicName().to_string();
+    fill_matching_data(rdata, endpoint);
+    add_to_topic_index(discovered_readers_by_topic_, endpoint.topic, rdata.guid());
+}
+
+void EDP::index_discovered_writer(
+        const WriterProxyData& wdata)
+{
+    DiscoveredEndpoint& endpoint = discovered_endpoints_[wdata.guid()];
+    endpoint.topic = wdata.topicName().to_string();
+    fill_matching_data(wdata, endpoint);
+    add_to_topic_index(discovered_writers_by_topic_, endpoint.topic, wdata.guid());
+}
+
+ReaderProxyData* EDP::find_discovered_reader(
+        const GUID_t& guid,
+        ParticipantProxyData*& participant) const
+{
+    ParticipantProxyData* pdata = mp_PDP->find_participant_proxy(guid.guidPrefix);
+    if (pdata != nullptr)
+    {
+        auto rit = pdata->m_readers->find(guid.entityId);
+        if (rit != pdata->m_readers->end())
+        {
+            participant = pdata;
+            return rit->second;
+        }
+    }
+    return nullptr;
+}
+
+WriterProxyData* EDP::find_discovered_writer(
+        const GUID_t& guid,
+        ParticipantProxyData*& participant) const
+{
+    ParticipantProxyData* pdata = mp_PDP->find_participant_proxy(guid.guidPrefix);
+    if (pdata != nullptr)
+    {
+        auto wit = pdata->m_writers->find(guid.entityId);
+        if (wit != pdata->m_writers->end())
+        {
+            participant = pdata;
+            return wit->second;
+        }
+    }
+    return nullptr;
+}
+
 const SubscriptionMatchedStatus& EDP::update_subscription_matched_status(
         const GUID_t& reader_guid,
         const GUID_t& writer_guid,
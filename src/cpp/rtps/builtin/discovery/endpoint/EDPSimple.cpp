@@ -39,6 +39,7 @@
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 
 #include <rtps/builtin/discovery/endpoint/EDPUtils.hpp>
+#include <rtps/flowcontrol/SharedFlowController.hpp>
 
 #include <mutex>
 #include <forward_list>
@@ -436,8 +437,7 @@ void EDPSimple::set_builtin_writer_attributes(
     attributes.endpoint.topicKind = WITH_KEY;
 
     // Set as asynchronous if there is a throughput controller installed
-    if (mp_RTPSParticipant->getRTPSParticipantAttributes().throughputController.bytesPerPeriod != UINT32_MAX &&
-            mp_RTPSParticipant->getRTPSParticipantAttributes().throughputController.periodMillisecs != 0)
+    if (!mp_RTPSParticipant->getFlowControllers().empty() || mp_PDP->discovery_flow_controller())
     {
         attributes.mode = ASYNCHRONOUS_WRITER;
     }
@@ -465,6 +465,7 @@ bool EDPSimple::createSEDPEndpoints()
         {
             return false;
         }
+        add_discovery_flow_controller(publications_writer_, watt);
 
         logInfo(RTPS_EDP, "SEDP Publication Writer created");
 
@@ -492,6 +493,7 @@ bool EDPSimple::createSEDPEndpoints()
         {
             return false;
         }
+        add_discovery_flow_controller(subscriptions_writer_, watt);
 
         logInfo(RTPS_EDP, "SEDP Subscription Writer created");
     }
@@ -500,6 +502,18 @@ bool EDPSimple::createSEDPEndpoints()
     return true;
 }
 
+void EDPSimple::add_discovery_flow_controller(
+        const t_p_StatefulWriter& writer,
+        const WriterAttributes& attributes)
+{
+    std::shared_ptr<FlowController> controller = mp_PDP->discovery_flow_controller();
+    if (controller)
+    {
+        writer.first->add_flow_controller(std::unique_ptr<FlowController>(
+                    new SharedFlowController(controller, writer.first, attributes)));
+    }
+}
+
 #if HAVE_SECURITY
 bool EDPSimple::create_sedp_secure_endpoints()
 {
@@ -549,6 +563,7 @@ bool EDPSimple::create_sedp_secure_endpoints()
         {
             return false;
         }
+        add_discovery_flow_controller(publications_secure_writer_, watt);
 
         logInfo(RTPS_EDP, "SEDP Publication Writer created");
 
@@ -579,6 +594,7 @@ bool EDPSimple::create_sedp_secure_endpoints()
         {
             return false;
         }
+        add_discovery_flow_controller(subscriptions_secure_writer_, watt);
 
         logInfo(RTPS_EDP, "SEDP Subscription Writer created");
     }
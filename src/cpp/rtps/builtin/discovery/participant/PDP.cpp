@@ -59,7 +59,11 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
+#include <rtps/flowcontrol/ThroughputController.h>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 
+#include <algorithm>
+#include <cstdlib>
 #include <mutex>
 #include <chrono>
 
@@ -123,6 +127,7 @@ PDP::PDP (
     {
         participant_proxies_pool_.push_back(new ParticipantProxyData(allocation));
     }
+    participant_proxies_by_prefix_.reserve(allocation.participants.initial);
 
     for (size_t i = 0; i < allocation.total_readers().initial; ++i)
     {
@@ -235,6 +240,7 @@ ParticipantProxyData* PDP::add_participant_proxy_data(
     ret_val->should_check_lease_duration = with_lease_duration;
     ret_val->m_guid = participant_guid;
     participant_proxies_.push_back(ret_val);
+    participant_proxies_by_prefix_[participant_guid.guidPrefix] = ret_val;
 
     return ret_val;
 }
@@ -363,6 +369,44 @@ bool PDP::initPDP(
     mp_RTPSParticipant = part;
     m_discovery = mp_RTPSParticipant->getAttributes().builtin;
     initial_announcements_ = m_discovery.discovery_config.initial_announcements;
+
+    const PropertyPolicy& properties = mp_RTPSParticipant->getAttributes().properties;
+
+    // Participants started at the same time are spread over time by delaying each announcement a random amount
+    const std::string* jitter = PropertyPolicyHelper::find_property(properties,
+                    "fastdds.discovery.announcement_jitter");
+    if (jitter != nullptr)
+    {
+        double value = std::strtod(jitter->c_str(), nullptr);
+        if (value < 0.0 || value >= 1.0)
+        {
+            logWarning(RTPS_PDP, "Ignoring announcement jitter " << *jitter <<
+                    ". It should be a fraction between 0 and 1");
+        }
+        else
+        {
+            announcement_jitter_ = value;
+            announcement_jitter_generator_.seed(
+                static_cast<std::mt19937::result_type>(std::hash<GuidPrefix_t>()(part->getGuid().guidPrefix)));
+        }
+    }
+
+    // The discovery writers share a throughput controller that limits the discovery traffic of the participant
+    const std::string* rate = PropertyPolicyHelper::find_property(properties, "fastdds.discovery.bytes_per_second");
+    if (rate != nullptr)
+    {
+        uint64_t bytes_per_second = std::strtoull(rate->c_str(), nullptr, 10);
+        if (bytes_per_second > 0)
+        {
+            // Samples bigger than the bytes allowed per period would never be sent
+            static constexpr uint32_t period_ms = 100;
+            uint64_t bytes_per_period = std::max<uint64_t>(bytes_per_second * period_ms / 1000u,
+                            m_discovery.writerPayloadSize);
+            ThroughputControllerDescriptor descriptor(
+                static_cast<uint32_t>(std::min<uint64_t>(bytes_per_period, UINT32_MAX - 1u)), period_ms);
+            discovery_flow_controller_ = std::make_shared<ThroughputController>(descriptor, mp_RTPSParticipant);
+        }
+    }
     //CREATE ENDPOINTS
     if (!createPDPEndpoints())
     {
@@ -395,7 +439,7 @@ bool PDP::initPDP(
     resend_participant_info_event_ = new TimedEvent(mp_RTPSParticipant->getEventResource(),
                     [&]() -> bool
                     {
-                        announceParticipantState(false);
+                        announce_participant_periodically();
                         set_next_announcement_interval();
                         return true;
                     },
@@ -521,17 +565,22 @@ void PDP::resetParticipantAnnouncement()
     resend_participant_info_event_->restart_timer();
 }
 
+ParticipantProxyData* PDP::find_participant_proxy(
+        const GuidPrefix_t& guid_prefix) const
+{
+    auto it = participant_proxies_by_prefix_.find(guid_prefix);
+    return it == participant_proxies_by_prefix_.end() ? nullptr : it->second;
+}
+
 bool PDP::has_reader_proxy_data(
         const GUID_t& reader)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(reader.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader.guidPrefix)
-        {
-            ProxyHashTable<ReaderProxyData>& readers = *pit->m_readers;
-            return readers.find(reader.entityId) != readers.end();
-        }
+        ProxyHashTable<ReaderProxyData>& readers = *pit->m_readers;
+        return readers.find(reader.entityId) != readers.end();
     }
     return false;
 }
@@ -541,16 +590,14 @@ bool PDP::lookupReaderProxyData(
         ReaderProxyData& rdata)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(reader.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader.guidPrefix)
+        auto rit = pit->m_readers->find(reader.entityId);
+        if (rit != pit->m_readers->end())
         {
-            auto rit = pit->m_readers->find(reader.entityId);
-            if (rit != pit->m_readers->end())
-            {
-                rdata.copy(rit->second);
-                return true;
-            }
+            rdata.copy(rit->second);
+            return true;
         }
     }
     return false;
@@ -560,13 +607,11 @@ bool PDP::has_writer_proxy_data(
         const GUID_t& writer)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(writer.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer.guidPrefix)
-        {
-            ProxyHashTable<WriterProxyData>& writers = *pit->m_writers;
-            return writers.find(writer.entityId) != writers.end();
-        }
+        ProxyHashTable<WriterProxyData>& writers = *pit->m_writers;
+        return writers.find(writer.entityId) != writers.end();
     }
     return false;
 }
@@ -576,16 +621,14 @@ bool PDP::lookupWriterProxyData(
         WriterProxyData& wdata)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(writer.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer.guidPrefix)
+        auto wit = pit->m_writers->find(writer.entityId);
+        if ( wit != pit->m_writers->end())
         {
-            auto wit = pit->m_writers->find(writer.entityId);
-            if ( wit != pit->m_writers->end())
-            {
-                wdata.copy(wit->second);
-                return true;
-            }
+            wdata.copy(wit->second);
+            return true;
         }
     }
     return false;
@@ -597,31 +640,29 @@ bool PDP::removeReaderProxyData(
     logInfo(RTPS_PDP, "Removing reader proxy data " << reader_guid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(reader_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader_guid.guidPrefix)
+        auto rit = pit->m_readers->find(reader_guid.entityId);
+
+        if (rit != pit->m_readers->end())
         {
-            auto rit = pit->m_readers->find(reader_guid.entityId);
+            ReaderProxyData* pR = rit->second;
+            mp_EDP->unpairReaderProxy(pit->m_guid, reader_guid);
 
-            if (rit != pit->m_readers->end())
+            RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+            if (listener)
             {
-                ReaderProxyData* pR = rit->second;
-                mp_EDP->unpairReaderProxy(pit->m_guid, reader_guid);
-
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    ReaderDiscoveryInfo info(std::move(*pR));
-                    info.status = ReaderDiscoveryInfo::REMOVED_READER;
-                    listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                }
-
-                // Clear reader proxy data and move to pool in order to allow reuse
-                pR->clear();
-                pit->m_readers->erase(rit);
-                reader_proxies_pool_.push_back(pR);
-                return true;
+                ReaderDiscoveryInfo info(std::move(*pR));
+                info.status = ReaderDiscoveryInfo::REMOVED_READER;
+                listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
             }
+
+            // Clear reader proxy data and move to pool in order to allow reuse
+            pR->clear();
+            pit->m_readers->erase(rit);
+            reader_proxies_pool_.push_back(pR);
+            return true;
         }
     }
 
@@ -634,32 +675,30 @@ bool PDP::removeWriterProxyData(
     logInfo(RTPS_PDP, "Removing writer proxy data " << writer_guid);
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(writer_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer_guid.guidPrefix)
+        auto wit = pit->m_writers->find(writer_guid.entityId);
+
+        if (wit != pit->m_writers->end())
         {
-            auto wit = pit->m_writers->find(writer_guid.entityId);
+            WriterProxyData* pW = wit->second;
+            mp_EDP->unpairWriterProxy(pit->m_guid, writer_guid, false);
 
-            if (wit != pit->m_writers->end())
+            RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+            if (listener)
             {
-                WriterProxyData* pW = wit->second;
-                mp_EDP->unpairWriterProxy(pit->m_guid, writer_guid, false);
-
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    WriterDiscoveryInfo info(std::move(*pW));
-                    info.status = WriterDiscoveryInfo::REMOVED_WRITER;
-                    listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                }
+                WriterDiscoveryInfo info(std::move(*pW));
+                info.status = WriterDiscoveryInfo::REMOVED_WRITER;
+                listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+            }
 
-                // Clear writer proxy data and move to pool in order to allow reuse
-                pW->clear();
-                pit->m_writers->erase(wit);
-                writer_proxies_pool_.push_back(pW);
+            // Clear writer proxy data and move to pool in order to allow reuse
+            pW->clear();
+            pit->m_writers->erase(wit);
+            writer_proxies_pool_.push_back(pW);
 
-                return true;
-            }
+            return true;
         }
     }
 
@@ -671,13 +710,11 @@ bool PDP::lookup_participant_name(
         string_255& name)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(guid.guidPrefix);
+    if (pit != nullptr && pit->m_guid == guid)
     {
-        if (pit->m_guid == guid)
-        {
-            name = pit->m_participantName;
-            return true;
-        }
+        name = pit->m_participantName;
+        return true;
     }
     return false;
 }
@@ -687,13 +724,11 @@ bool PDP::lookup_participant_key(
         InstanceHandle_t& key)
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(participant_guid.guidPrefix);
+    if (pit != nullptr && pit->m_guid == participant_guid)
     {
-        if (pit->m_guid == participant_guid)
-        {
-            key = pit->m_key;
-            return true;
-        }
+        key = pit->m_key;
+        return true;
     }
     return false;
 }
@@ -708,68 +743,20 @@ ReaderProxyData* PDP::addReaderProxyData(
 
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(reader_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == reader_guid.guidPrefix)
-        {
-            // Copy participant data to be used outside.
-            participant_guid = pit->m_guid;
-
-            // Check that it is not already there:
-            auto rpi = pit->m_readers->find(reader_guid.entityId);
+        // Copy participant data to be used outside.
+        participant_guid = pit->m_guid;
 
-            if ( rpi != pit->m_readers->end())
-            {
-                ret_val = rpi->second;
+        // Check that it is not already there:
+        auto rpi = pit->m_readers->find(reader_guid.entityId);
 
-                if (!initializer_func(ret_val, true, *pit))
-                {
-                    return nullptr;
-                }
-
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    ReaderDiscoveryInfo info(*ret_val);
-                    info.status = ReaderDiscoveryInfo::CHANGED_QOS_READER;
-                    listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                    check_and_notify_type_discovery(listener, *ret_val);
-                }
-
-                return ret_val;
-            }
-
-            // Try to take one entry from the pool
-            if (reader_proxies_pool_.empty())
-            {
-                size_t max_proxies = reader_proxies_pool_.max_size();
-                if (reader_proxies_number_ < max_proxies)
-                {
-                    // Pool is empty but limit has not been reached, so we create a new entry.
-                    ++reader_proxies_number_;
-                    ret_val = new ReaderProxyData(
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.data_limits);
-                }
-                else
-                {
-                    logWarning(RTPS_PDP, "Maximum number of reader proxies (" << max_proxies <<
-                            ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
-                    return nullptr;
-                }
-            }
-            else
-            {
-                // Pool is not empty, use entry from pool
-                ret_val = reader_proxies_pool_.back();
-                reader_proxies_pool_.pop_back();
-            }
-
-            // Add to ParticipantProxyData
-            (*pit->m_readers)[reader_guid.entityId] = ret_val;
+        if ( rpi != pit->m_readers->end())
+        {
+            ret_val = rpi->second;
 
-            if (!initializer_func(ret_val, false, *pit))
+            if (!initializer_func(ret_val, true, *pit))
             {
                 return nullptr;
             }
@@ -778,13 +765,59 @@ ReaderProxyData* PDP::addReaderProxyData(
             if (listener)
             {
                 ReaderDiscoveryInfo info(*ret_val);
-                info.status = ReaderDiscoveryInfo::DISCOVERED_READER;
+                info.status = ReaderDiscoveryInfo::CHANGED_QOS_READER;
                 listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
                 check_and_notify_type_discovery(listener, *ret_val);
             }
 
             return ret_val;
         }
+
+        // Try to take one entry from the pool
+        if (reader_proxies_pool_.empty())
+        {
+            size_t max_proxies = reader_proxies_pool_.max_size();
+            if (reader_proxies_number_ < max_proxies)
+            {
+                // Pool is empty but limit has not been reached, so we create a new entry.
+                ++reader_proxies_number_;
+                ret_val = new ReaderProxyData(
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.data_limits);
+            }
+            else
+            {
+                logWarning(RTPS_PDP, "Maximum number of reader proxies (" << max_proxies <<
+                        ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
+                return nullptr;
+            }
+        }
+        else
+        {
+            // Pool is not empty, use entry from pool
+            ret_val = reader_proxies_pool_.back();
+            reader_proxies_pool_.pop_back();
+        }
+
+        // Add to ParticipantProxyData
+        (*pit->m_readers)[reader_guid.entityId] = ret_val;
+
+        if (!initializer_func(ret_val, false, *pit))
+        {
+            return nullptr;
+        }
+
+        RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+        if (listener)
+        {
+            ReaderDiscoveryInfo info(*ret_val);
+            info.status = ReaderDiscoveryInfo::DISCOVERED_READER;
+            listener->onReaderDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+            check_and_notify_type_discovery(listener, *ret_val);
+        }
+
+        return ret_val;
     }
 
     return nullptr;
@@ -800,68 +833,20 @@ WriterProxyData* PDP::addWriterProxyData(
 
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* pit : participant_proxies_)
+    ParticipantProxyData* pit = find_participant_proxy(writer_guid.guidPrefix);
+    if (pit != nullptr)
     {
-        if (pit->m_guid.guidPrefix == writer_guid.guidPrefix)
-        {
-            // Copy participant data to be used outside.
-            participant_guid = pit->m_guid;
+        // Copy participant data to be used outside.
+        participant_guid = pit->m_guid;
 
-            // Check that it is not already there:
-            auto wpi = pit->m_writers->find(writer_guid.entityId);
+        // Check that it is not already there:
+        auto wpi = pit->m_writers->find(writer_guid.entityId);
 
-            if (wpi != pit->m_writers->end())
-            {
-                ret_val = wpi->second;
-
-                if (!initializer_func(ret_val, true, *pit))
-                {
-                    return nullptr;
-                }
-
-                RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
-                if (listener)
-                {
-                    WriterDiscoveryInfo info(*ret_val);
-                    info.status = WriterDiscoveryInfo::CHANGED_QOS_WRITER;
-                    listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
-                    check_and_notify_type_discovery(listener, *ret_val);
-                }
-
-                return ret_val;
-            }
-
-            // Try to take one entry from the pool
-            if (writer_proxies_pool_.empty())
-            {
-                size_t max_proxies = writer_proxies_pool_.max_size();
-                if (writer_proxies_number_ < max_proxies)
-                {
-                    // Pool is empty but limit has not been reached, so we create a new entry.
-                    ++writer_proxies_number_;
-                    ret_val = new WriterProxyData(
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
-                        mp_RTPSParticipant->getAttributes().allocation.data_limits);
-                }
-                else
-                {
-                    logWarning(RTPS_PDP, "Maximum number of writer proxies (" << max_proxies <<
-                            ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
-                    return nullptr;
-                }
-            }
-            else
-            {
-                // Pool is not empty, use entry from pool
-                ret_val = writer_proxies_pool_.back();
-                writer_proxies_pool_.pop_back();
-            }
-
-            // Add to ParticipantProxyData
-            (*pit->m_writers)[writer_guid.entityId] = ret_val;
+        if (wpi != pit->m_writers->end())
+        {
+            ret_val = wpi->second;
 
-            if (!initializer_func(ret_val, false, *pit))
+            if (!initializer_func(ret_val, true, *pit))
             {
                 return nullptr;
             }
@@ -870,13 +855,59 @@ WriterProxyData* PDP::addWriterProxyData(
             if (listener)
             {
                 WriterDiscoveryInfo info(*ret_val);
-                info.status = WriterDiscoveryInfo::DISCOVERED_WRITER;
+                info.status = WriterDiscoveryInfo::CHANGED_QOS_WRITER;
                 listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
                 check_and_notify_type_discovery(listener, *ret_val);
             }
 
             return ret_val;
         }
+
+        // Try to take one entry from the pool
+        if (writer_proxies_pool_.empty())
+        {
+            size_t max_proxies = writer_proxies_pool_.max_size();
+            if (writer_proxies_number_ < max_proxies)
+            {
+                // Pool is empty but limit has not been reached, so we create a new entry.
+                ++writer_proxies_number_;
+                ret_val = new WriterProxyData(
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_unicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.locators.max_multicast_locators,
+                    mp_RTPSParticipant->getAttributes().allocation.data_limits);
+            }
+            else
+            {
+                logWarning(RTPS_PDP, "Maximum number of writer proxies (" << max_proxies <<
+                        ") reached for participant " << mp_RTPSParticipant->getGuid() << std::endl);
+                return nullptr;
+            }
+        }
+        else
+        {
+            // Pool is not empty, use entry from pool
+            ret_val = writer_proxies_pool_.back();
+            writer_proxies_pool_.pop_back();
+        }
+
+        // Add to ParticipantProxyData
+        (*pit->m_writers)[writer_guid.entityId] = ret_val;
+
+        if (!initializer_func(ret_val, false, *pit))
+        {
+            return nullptr;
+        }
+
+        RTPSParticipantListener* listener = mp_RTPSParticipant->getListener();
+        if (listener)
+        {
+            WriterDiscoveryInfo info(*ret_val);
+            info.status = WriterDiscoveryInfo::DISCOVERED_WRITER;
+            listener->onWriterDiscovery(mp_RTPSParticipant->getUserRTPSParticipant(), std::move(info));
+            check_and_notify_type_discovery(listener, *ret_val);
+        }
+
+        return ret_val;
     }
 
     return nullptr;
@@ -897,15 +928,12 @@ bool PDP::remove_remote_participant(
 
     //Remove it from our vector or RTPSParticipantProxies:
     this->mp_mutex->lock();
-    for (ResourceLimitedVector<ParticipantProxyData*>::iterator pit = participant_proxies_.begin();
-            pit != participant_proxies_.end(); ++pit)
+    ParticipantProxyData* found = find_participant_proxy(partGUID.guidPrefix);
+    if (found != nullptr && found->m_guid == partGUID)
     {
-        if ((*pit)->m_guid == partGUID)
-        {
-            pdata = *pit;
-            participant_proxies_.erase(pit);
-            break;
-        }
+        pdata = found;
+        participant_proxies_by_prefix_.erase(partGUID.guidPrefix);
+        participant_proxies_.erase(std::find(participant_proxies_.begin(), participant_proxies_.end(), pdata));
     }
     this->mp_mutex->unlock();
 
@@ -963,6 +991,12 @@ bool PDP::remove_remote_participant(
         this->mp_EDP->removeRemoteEndpoints(pdata);
         this->removeRemoteEndpoints(pdata);
 
+        // Controllers of the participant may keep state for the remote participant
+        for (std::unique_ptr<FlowController>& controller : mp_RTPSParticipant->getFlowControllers())
+        {
+            controller->remove_remote_participant(partGUID.guidPrefix);
+        }
+
 #if HAVE_SECURITY
         mp_builtin->mp_participantImpl->security_manager().remove_participant(*pdata);
 #endif // if HAVE_SECURITY
@@ -1031,15 +1065,12 @@ void PDP::assert_remote_participant_liveliness(
 {
     std::lock_guard<std::recursive_mutex> guardPDP(*this->mp_mutex);
 
-    for (ParticipantProxyData* it : this->participant_proxies_)
+    ParticipantProxyData* it = find_participant_proxy(remote_guid);
+    if (it != nullptr)
     {
-        if (it->m_guid.guidPrefix == remote_guid)
-        {
-            // TODO Ricardo: Study if isAlive attribute is necessary.
-            it->isAlive = true;
-            it->assert_liveliness();
-            break;
-        }
+        // TODO Ricardo: Study if isAlive attribute is necessary.
+        it->isAlive = true;
+        it->assert_liveliness();
     }
 }
 
@@ -1165,11 +1196,37 @@ void PDP::set_next_announcement_interval()
     if (initial_announcements_.count > 0)
     {
         --initial_announcements_.count;
-        resend_participant_info_event_->update_interval(initial_announcements_.period);
+        update_announcement_interval(initial_announcements_.period);
+    }
+    else
+    {
+        update_announcement_interval(m_discovery.discovery_config.leaseDuration_announcementperiod);
+    }
+}
+
+void PDP::update_announcement_interval(
+        const Duration_t& period)
+{
+    if (announcement_jitter_ > 0.0)
+    {
+        std::uniform_real_distribution<double> factor(1.0 - announcement_jitter_, 1.0 + announcement_jitter_);
+        resend_participant_info_event_->update_interval_millisec(
+            TimeConv::Duration_t2MilliSecondsDouble(period) * factor(announcement_jitter_generator_));
     }
     else
     {
-        resend_participant_info_event_->update_interval(m_discovery.discovery_config.leaseDuration_announcementperiod);
+        resend_participant_info_event_->update_interval(period);
+    }
+}
+
+void PDP::bring_forward_announcement(
+        double max_delay_ms)
+{
+    if (resend_participant_info_event_->getRemainingTimeMilliSec() > max_delay_ms)
+    {
+        resend_participant_info_event_->cancel_timer();
+        resend_participant_info_event_->update_interval_millisec(max_delay_ms);
+        resend_participant_info_event_->restart_timer();
     }
 }
 
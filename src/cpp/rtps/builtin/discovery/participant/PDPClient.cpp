@@ -249,8 +249,7 @@ bool PDPClient::createPDPEndpoints()
     watt.times.nackResponseDelay = pdp_nack_response_delay;
     watt.times.nackSupressionDuration = pdp_nack_supression_duration;
 
-    if (mp_RTPSParticipant->getRTPSParticipantAttributes().throughputController.bytesPerPeriod != UINT32_MAX &&
-            mp_RTPSParticipant->getRTPSParticipantAttributes().throughputController.periodMillisecs != 0)
+    if (!mp_RTPSParticipant->getFlowControllers().empty())
     {
         watt.mode = ASYNCHRONOUS_WRITER;
     }
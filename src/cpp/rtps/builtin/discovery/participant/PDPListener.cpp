@@ -108,14 +108,10 @@ void PDPListener::onNewCacheChangeAdded(
             guid = temp_participant_data_.m_guid;
 
             // Check if participant already exists (updated info)
-            ParticipantProxyData* pdata = nullptr;
-            for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
+            ParticipantProxyData* pdata = parent_pdp_->find_participant_proxy(guid.guidPrefix);
+            if (pdata != nullptr && pdata->m_guid != guid)
             {
-                if (guid == it->m_guid)
-                {
-                    pdata = it;
-                    break;
-                }
+                pdata = nullptr;
             }
 
             auto status = (pdata == nullptr) ? ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT :
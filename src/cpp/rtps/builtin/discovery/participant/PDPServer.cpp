@@ -214,8 +214,7 @@ bool PDPServer::createPDPEndpoints()
     watt.times.nackResponseDelay = pdp_nack_response_delay;
     watt.times.nackSupressionDuration = pdp_nack_supression_duration;
 
-    if (mp_RTPSParticipant->getRTPSParticipantAttributes().throughputController.bytesPerPeriod != UINT32_MAX &&
-            mp_RTPSParticipant->getRTPSParticipantAttributes().throughputController.periodMillisecs != 0)
+    if (!mp_RTPSParticipant->getFlowControllers().empty())
     {
         watt.mode = ASYNCHRONOUS_WRITER;
     }
@@ -722,13 +721,10 @@ bool PDPServer::addRelayedChangeToHistory(
         lock.unlock();
         std::lock_guard<std::recursive_mutex> pdp_lock(*getMutex());
 
-        for (ParticipantProxyData* pp : participant_proxies_)
+        if (find_participant_proxy(sid.writer_guid().guidPrefix) != nullptr)
         {
-            if (sid.writer_guid().guidPrefix == pp->m_guid.guidPrefix)
-            {
-                // already also in the database
-                return false;
-            }
+            // already also in the database
+            return false;
         }
         // Writer history and proxies are not in sync, this may happen if a participant is dropped been alived because the
         // trimming mechanism may not had time enough to remove all its samples.
@@ -1273,17 +1269,9 @@ bool PDPServer::remove_remote_participant(
     {
         std::lock_guard<std::recursive_mutex> lock(*mp_mutex);
 
-        for (ResourceLimitedVector<ParticipantProxyData*>::iterator pit = participant_proxies_.begin();
-                pit != participant_proxies_.end(); ++pit)
-        {
-            if ((*pit)->m_guid == partGUID)
-            {
-                pdata = *pit;
-                break;
-            }
-        }
+        pdata = find_participant_proxy(partGUID.guidPrefix);
 
-        if ( nullptr == pdata )
+        if ( nullptr == pdata || pdata->m_guid != partGUID )
         {
             return false;
         }
@@ -17,12 +17,16 @@
  *
  */
 
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <mutex>
 
 #include <fastrtps/utils/TimedMutex.hpp>
 
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/builtin/BuiltinProtocols.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
 
@@ -102,9 +106,38 @@ bool PDPServer2::init(
         return false;
     }
 
-    std::vector<nlohmann::json> backup_queue;
+    // Matching of the dirty topics may be shared among several threads on servers with many clients
+    const std::string* matching_threads = PropertyPolicyHelper::find_property(
+        part->getRTPSParticipantAttributes().properties, "fastdds.discovery_server.matching_threads");
+    if (matching_threads != nullptr)
+    {
+        discovery_db_.matching_threads(static_cast<uint32_t>(std::strtoul(matching_threads->c_str(), nullptr, 10)),
+                part->getRTPSParticipantAttributes().discovery_server_matching_threads);
+    }
+
+    // Writers are only forwarded to the remote servers with readers on their topics
+    const std::string* topic_routing = PropertyPolicyHelper::find_property(
+        part->getRTPSParticipantAttributes().properties, "fastdds.discovery_server.topic_routing");
+    if (topic_routing != nullptr)
+    {
+        discovery_db_.topic_routing(*topic_routing == "true");
+    }
+
+    std::vector<ddb::JournalRecord> backup_queue;
     if (durability_ == TRANSIENT)
     {
+        // The snapshot of the backup is stored once the journal reaches this size, or the size of the last snapshot
+        const std::string* compaction_size = PropertyPolicyHelper::find_property(
+            part->getRTPSParticipantAttributes().properties, "fastdds.discovery_server.backup_compaction_size");
+        if (compaction_size != nullptr)
+        {
+            backup_compaction_size_ = static_cast<size_t>(std::strtoull(compaction_size->c_str(), nullptr, 10));
+        }
+
+        const std::string* json_export = PropertyPolicyHelper::find_property(
+            part->getRTPSParticipantAttributes().properties, "fastdds.discovery_server.backup_json_export");
+        backup_json_export_ = json_export != nullptr && *json_export == "true";
+
         nlohmann::json backup_json;
         // If the DS is BACKUP, try to restore DDB from file
         discovery_db().backup_in_progress(true);
@@ -114,10 +147,13 @@ bool PDPServer2::init(
             {
                 logInfo(RTPS_PDP_SERVER, "DiscoveryDataBase restored correctly");
             }
+            // The restored state is stored again on the first backup
+            backup_compaction_pending_ = true;
         }
         else
         {
-            logInfo(RTPS_PDP_SERVER, "Error reading backup file. Corrupted or unmissing file, restarting from scratch");
+            logInfo(RTPS_PDP_SERVER,
+                    "Error reading backup snapshot. Corrupted or unmissing file, restoring only the journal");
         }
 
         discovery_db().backup_in_progress(false);
@@ -137,7 +173,7 @@ bool PDPServer2::init(
     getRTPSParticipant()->enableReader(edp->publications_reader_.first);
 
     // Initialize server dedicated thread.
-    resource_event_thread_.init_thread();
+    resource_event_thread_.init_thread(getRTPSParticipant()->getAttributes().timed_events_thread);
 
     /*
         Given the fact that a participant is either a client or a server the
@@ -157,10 +193,11 @@ bool PDPServer2::init(
     ping_->restart_timer();
 
     // Restoring the queue must be done after starting the routine
-    if (durability_ == TRANSIENT)
+    if (durability_ == TRANSIENT && !backup_queue.empty())
     {
-        // This vector is empty till backup queue is implemented
         process_backup_restore_queue(backup_queue);
+        // The replayed changes are written again to the journal, so they are compacted on the first backup
+        backup_compaction_pending_ = true;
     }
 
     return true;
@@ -520,14 +557,21 @@ std::string PDPServer2::get_reader_persistence_file_name() const
 std::string PDPServer2::get_ddb_persistence_file_name() const
 {
     std::ostringstream filename = get_persistence_file_name_();
-    filename << ".json";
+    filename << ".db";
     return filename.str();
 }
 
 std::string PDPServer2::get_ddb_queue_persistence_file_name() const
 {
     std::ostringstream filename = get_persistence_file_name_();
-    filename << "_queue.json";
+    filename << "_queue.db";
+    return filename.str();
+}
+
+std::string PDPServer2::get_ddb_json_file_name() const
+{
+    std::ostringstream filename = get_persistence_file_name_();
+    filename << ".json";
     return filename.str();
 }
 
@@ -1383,41 +1427,19 @@ void PDPServer2::send_announcement(
 
 bool PDPServer2::read_backup(
         nlohmann::json& ddb_json,
-        std::vector<nlohmann::json>& /* new_changes */)
+        std::vector<ddb::JournalRecord>& new_changes)
 {
-    std::ifstream myfile;
-    bool ret = true;
-    try
-    {
-        myfile.open(get_ddb_persistence_file_name(), std::ios_base::in);
-        // read json object
-        myfile >> ddb_json;
-        myfile.close();
-    }
-    catch (const std::exception& /* e */)
+    bool ret = ddb::read_snapshot(get_ddb_persistence_file_name(), get_ddb_json_file_name(), ddb_json,
+                    backup_snapshot_size_);
+
+    // The journal is replayed even without a snapshot. It only has the changes arrived since the last snapshot was
+    // stored, so the entities which did not change since then are lost, but the rest are restored.
+    // A record that could not be read is the one being written when the server stopped
+    if (!ddb::restore_journal(get_ddb_queue_persistence_file_name(), new_changes))
     {
-        ret = false;
+        logWarning(RTPS_PDP_SERVER, "Backup journal ends with an incomplete change, ignoring it");
     }
 
-    // TODO uncomment this part when recover queues is finish
-    // try{
-    //     myfile.open(get_ddb_queue_persistence_file_name(), std::ios_base::in);
-
-    //     std::string line;
-    //     while (std::getline(myfile, line))
-    //     {
-    //         nlohmann::json change_json = nlohmann::json::parse(line);
-
-    //         // Read every change, and store it in json format in a vector
-    //         new_changes.push_back(change_json);
-    //     }
-
-    //     myfile.close();
-    // }
-    // catch(const std::exception& e)
-    // {
-    //     return ret;
-    // }
     return ret;
 }
 
@@ -1567,150 +1589,127 @@ bool PDPServer2::process_backup_discovery_database_restore(
 }
 
 bool PDPServer2::process_backup_restore_queue(
-        std::vector<nlohmann::json>& /* new_changes */)
+        std::vector<ddb::JournalRecord>& new_changes)
 {
-    // fastrtps::rtps::SampleIdentity sample_identity_aux;
-    // fastrtps::rtps::InstanceHandle_t instance_handle_aux;
-    // uint32_t length;
-
-    // EDPServer2* edp = static_cast<EDPServer2*>(mp_EDP);
-    // EDPServerPUBListener2* edp_pub_listener = static_cast<EDPServerPUBListener2*>(edp->publications_listener_);
-    // EDPServerSUBListener2* edp_sub_listener = static_cast<EDPServerSUBListener2*>(edp->subscriptions_listener_);
-
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock(mp_PDPReader->getMutex());
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
-    // std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
-
-    // TODO uncomment this funcionality and update with pools when queue functionality is implemented
-    // try
-    // {
-    //     // Read every change and push it to the listener that it belongs
-    //     for (nlohmann::json& json_change : new_changes)
-    //     {
-    //         // std::cout << json_change << std::endl;
-    //         fastrtps::rtps::CacheChange_t* change_aux;
-    //         length = json_change["serialized_payload"]["length"].get<std::uint32_t>();
-    //         (std::istringstream) json_change["sample_identity"].get<std::string>() >> sample_identity_aux;
-    //         (std::istringstream) json_change["instance_handle"].get<std::string>() >> instance_handle_aux;
-
-    //         // Belongs to own server
-    //         if (sample_identity_aux.writer_guid() == mp_PDPWriter->getGuid())
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!mp_PDPWriterHistory->reserve_Cache(&change_aux, length))
-    //                             [this]() -> uint32_t
-    //                             {
-    //                                 return mp_PDP->builtin_attributes().readerPayloadSize;
-    //                             },
-    //                             &change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     mp_listener->onNewCacheChangeAdded(mp_PDPReader, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_writer_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //         // It came from outside
-    //         else
-    //         {
-    //             if (discovery_db_.is_participant(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!mp_PDPReaderHistory->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     mp_listener->onNewCacheChangeAdded(mp_PDPReader, change_aux);
-    //                 }
-
-    //             }
-    //             else if (discovery_db_.is_writer(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->publications_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
-    //                 }
-    //             }
-    //             else if (discovery_db_.is_reader(iHandle2GUID(instance_handle_aux)))
-    //             {
-    //                 if (!edp->subscriptions_reader_.second->reserve_Cache(&change_aux, length))
-    //                 {
-    //                     logError(RTPS_PDP_SERVER, "Error creating CacheChange");
-    //                     // TODO release changes and exit
-    //                 }
-    //                 else
-    //                 {
-    //                     ddb::from_json(json_change, *change_aux);
-    //                     edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
-    //                 }
-    //             }
-    //         }
-    //     }
-    // }
-    // catch (std::ios_base::failure&)
-    // {
-    //     // TODO clean changes in case it has been an error
-    //     logError(DISCOVERY_DATABASE, "QUEUE BACKUP CORRUPTED");
-    //     return false;
-    // }
+    EDPServer2* edp = static_cast<EDPServer2*>(mp_EDP);
+    EDPServerPUBListener2* edp_pub_listener = static_cast<EDPServerPUBListener2*>(edp->publications_listener_);
+    EDPServerSUBListener2* edp_sub_listener = static_cast<EDPServerSUBListener2*>(edp->subscriptions_listener_);
+
+    // These mutexes are necessary to send messages to the listeners
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock(mp_PDPReader->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
+
+    // Each record is deserialized first to know the reader it belongs to, and the size of its payload
+    fastrtps::rtps::CacheChange_t change_in;
+
+    // Read every change and push it to the listener that it belongs
+    for (ddb::JournalRecord& record : new_changes)
+    {
+        if (!ddb::from_journal_record(record, change_in))
+        {
+            logError(DISCOVERY_DATABASE, "QUEUE BACKUP CORRUPTED");
+            return false;
+        }
+
+        fastrtps::rtps::RTPSReader* reader = nullptr;
+        fastrtps::rtps::ReaderHistory* history = nullptr;
+        fastrtps::rtps::ReaderListener* listener = nullptr;
+        if (discovery_db_.is_participant(&change_in))
+        {
+            reader = mp_PDPReader;
+            history = mp_PDPReaderHistory;
+            listener = mp_listener;
+        }
+        else if (discovery_db_.is_writer(&change_in))
+        {
+            reader = edp->publications_reader_.first;
+            history = edp->publications_reader_.second;
+            listener = edp_pub_listener;
+        }
+        else if (discovery_db_.is_reader(&change_in))
+        {
+            reader = edp->subscriptions_reader_.first;
+            history = edp->subscriptions_reader_.second;
+            listener = edp_sub_listener;
+        }
+        else
+        {
+            logWarning(RTPS_PDP_SERVER, "Backup journal change " << change_in.instanceHandle << " is not a DATA");
+            continue;
+        }
+
+        fastrtps::rtps::CacheChange_t* change_aux;
+        if (!reader->reserveCache(&change_aux, change_in.serializedPayload.length))
+        {
+            logError(RTPS_PDP_SERVER, "Error creating CacheChange");
+            continue;
+        }
+        change_aux->copy(&change_in);
+        change_aux->receptionTimestamp = change_in.receptionTimestamp;
+
+        // The listeners take the change from the history of the reader, as if it had just been received
+        if (!history->received_change(change_aux, 0))
+        {
+            reader->releaseCache(change_aux);
+            continue;
+        }
+        listener->onNewCacheChangeAdded(reader, change_aux);
+    }
+
     return true;
 }
 
 void PDPServer2::process_backup_store()
 {
-    logInfo(DISCOVERY_DATABASE, "Dump DDB in json backup");
+    // Every change since the last snapshot is in the journal, so a new snapshot is only needed to keep the journal
+    // from growing without limit
+    size_t journal_size = discovery_db_.backup_journal_size();
+    if (!backup_compaction_pending_ &&
+            (journal_size == 0 || journal_size < std::max(backup_compaction_size_, backup_snapshot_size_)))
+    {
+        return;
+    }
 
-    // This will erase the last backup stored
-    std::ofstream backup_json_file;
-    backup_json_file.open(get_ddb_persistence_file_name(), std::ios_base::out);
+    logInfo(DISCOVERY_DATABASE, "Dump DDB in binary backup");
 
     // Set j with the json from database dump
     nlohmann::json j;
     discovery_db().to_json(j);
-    // setw makes pretty print for json
-    backup_json_file << std::setw(4) << j << std::endl;
-    backup_json_file.close();
+    std::vector<uint8_t> snapshot = nlohmann::json::to_cbor(j);
+
+    // The snapshot is written to a temporary file first, so the last one is kept if the server stops meanwhile
+    std::string file_name = get_ddb_persistence_file_name();
+    std::string tmp_file_name = file_name + ".tmp";
+    std::ofstream backup_file;
+    backup_file.open(tmp_file_name, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+    backup_file.write(reinterpret_cast<const char*>(snapshot.data()), snapshot.size());
+    backup_file.close();
+    if (!backup_file)
+    {
+        logError(RTPS_PDP_SERVER, "Error writing the backup of the DiscoveryDataBase");
+        return;
+    }
+#if defined(_WIN32)
+    // rename does not replace existing files on Windows
+    std::remove(file_name.c_str());
+#endif // if defined(_WIN32)
+    if (std::rename(tmp_file_name.c_str(), file_name.c_str()) != 0)
+    {
+        logError(RTPS_PDP_SERVER, "Error replacing the backup of the DiscoveryDataBase");
+        return;
+    }
+    backup_snapshot_size_ = snapshot.size();
+    backup_compaction_pending_ = false;
+
+    if (backup_json_export_)
+    {
+        std::ofstream backup_json_file;
+        backup_json_file.open(get_ddb_json_file_name(), std::ios_base::out);
+        // setw makes pretty print for json
+        backup_json_file << std::setw(4) << j << std::endl;
+        backup_json_file.close();
+    }
 
     // Clear queue ddb backup
     discovery_db_.clean_backup();
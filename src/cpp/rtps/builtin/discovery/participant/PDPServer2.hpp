@@ -27,6 +27,7 @@
 
 #include "../database/DiscoveryDataFilter.hpp"
 #include "../database/DiscoveryDataBase.hpp"
+#include "../database/backup/SharedBackupFunctions.hpp"
 #include "./DServerEvent2.hpp"
 
 namespace eprosima {
@@ -136,12 +137,15 @@ public:
     //! Get filename for reader persistence database file
     std::string get_reader_persistence_file_name() const;
 
-    //! Get filename for discovery database file
+    //! Get filename for discovery database snapshot file
     std::string get_ddb_persistence_file_name() const;
 
-    //! Get filename for discovery database file
+    //! Get filename for discovery database journal file
     std::string get_ddb_queue_persistence_file_name() const;
 
+    //! Get filename for discovery database json export file
+    std::string get_ddb_json_file_name() const;
+
     /*
      * Wakes up the DServerRoutineEvent2 for new matching or trimming
      * By default the server execute the routine instantly
@@ -236,26 +240,29 @@ protected:
     bool process_backup_discovery_database_restore(
             nlohmann::json& ddb_json);
 
-    // Restore the backup file with the changes that were added to the DDB queues (and so acked)
+    // Restore the backup journal with the changes that were added to the DDB queues (and so acked)
     // It reserves memory for the changes depending the pool, and send them by the listener to the DDB
     // This method must be called with the DDB variable backup_in_progress as false
     bool process_backup_restore_queue(
-            std::vector<nlohmann::json>& new_changes);
+            std::vector<ddb::JournalRecord>& new_changes);
 
-    // Reads the two backup files and stores each json objects in both arguments
-    // The first argument has the json object to restore the DDB
-    // The second argument has the json vector object to restore the changes that must be sent again to the queue
+    // Reads the two backup files and stores their content in both arguments
+    // The first argument has the json object to restore the DDB, read from the binary snapshot
+    // The second argument has the records of the journal, with the changes that must be sent again to the queue
+    // Returns whether there was a snapshot to read
     bool read_backup(
             nlohmann::json& ddb_json,
-            std::vector<nlohmann::json>& new_changes);
+            std::vector<ddb::JournalRecord>& new_changes);
 
     std::vector<fastrtps::rtps::GuidPrefix_t> servers_prefixes();
 
     // General file name for the prefix of every backup file
     std::ostringstream get_persistence_file_name_() const;
 
-    // Erase the last file and store the backup info of the actual state of the DDB
-    // Erase the content of the file with the changes in the queues
+    // Erase the last snapshot and store the backup info of the actual state of the DDB
+    // Erase the content of the journal with the changes in the queues
+    // The snapshot is only stored once the journal grows larger than it, so the cost of storing it is proportional
+    // to the changes received
     // This method must be called after the whole DDB routine process has been finished and with the DDB
     // queues empty. If not, there will be some information that could be lost. For this, the lock_incoming_data()
     // from DDB must be called during this process
@@ -282,6 +289,18 @@ private:
     //! TRANSIENT or TRANSIENT_LOCAL durability;
     fastrtps::rtps::DurabilityKind_t durability_;
 
+    //! Minimum size of the backup journal to store a new snapshot
+    size_t backup_compaction_size_ = 1024 * 1024;
+
+    //! Size of the last backup snapshot
+    size_t backup_snapshot_size_ = 0;
+
+    //! Whether the next backup store must write the snapshot, whatever the size of the journal
+    bool backup_compaction_pending_ = false;
+
+    //! Whether the snapshot is also exported in json format
+    bool backup_json_export_ = false;
+
 };
 
 } // namespace rtps
@@ -105,15 +105,11 @@ void PDPServerListener::onNewCacheChangeAdded(
             reader->getMutex().unlock();
 
             // Check if participant already exists (updated info)
-            ParticipantProxyData* pdata = nullptr;
             std::unique_lock<std::recursive_mutex> lock(*parent_pdp_->getMutex());
-            for (ParticipantProxyData* it : parent_pdp_->participant_proxies_)
+            ParticipantProxyData* pdata = parent_pdp_->find_participant_proxy(guid.guidPrefix);
+            if (pdata != nullptr && pdata->m_guid != guid)
             {
-                if (guid == it->m_guid)
-                {
-                    pdata = it;
-                    break;
-                }
+                pdata = nullptr;
             }
 
             auto status = (pdata == nullptr) ? ParticipantDiscoveryInfo::DISCOVERED_PARTICIPANT :
@@ -37,6 +37,8 @@
 
 #include <fastdds/rtps/history/WriterHistory.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 
 #include <fastdds/dds/builtin/typelookup/TypeLookupManager.hpp>
 
@@ -45,9 +47,11 @@
 
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
+#include <rtps/flowcontrol/SharedFlowController.hpp>
 
 #include <fastdds/dds/log/Log.hpp>
 
+#include <cstdlib>
 #include <mutex>
 
 using namespace eprosima::fastrtps;
@@ -116,6 +120,25 @@ void PDPSimple::initializeParticipantProxyData(
 bool PDPSimple::init(
         RTPSParticipantImpl* part)
 {
+    // Periodic announcements may only carry the liveliness of the participant, which saves sending the whole
+    // DATA(p) to peers that already have it
+    const std::string* compact_announcements = PropertyPolicyHelper::find_property(
+        part->getRTPSParticipantAttributes().properties, "fastdds.compact_announcements");
+    if (compact_announcements != nullptr)
+    {
+        compact_announcements_ = static_cast<uint32_t>(std::strtoul(compact_announcements->c_str(), nullptr, 10));
+        compact_announcements_left_ = compact_announcements_;
+    }
+
+    // Newly discovered participants may wait a bit for the DATA(p) of this one, so a single announcement answers
+    // all the participants discovered meanwhile
+    const std::string* response_suppression = PropertyPolicyHelper::find_property(
+        part->getRTPSParticipantAttributes().properties, "fastdds.discovery.response_suppression_ms");
+    if (response_suppression != nullptr)
+    {
+        response_suppression_ms_ = std::strtod(response_suppression->c_str(), nullptr);
+    }
+
     // The DATA(p) must be processed after EDP endpoint creation
     if (!PDP::initPDP(part))
     {
@@ -213,9 +236,18 @@ void PDPSimple::announceParticipantState(
         bool dispose,
         WriteParams& wp)
 {
+    // A change on the local data is serialized into a new change, which is sent to everybody when added
+    bool local_data_changed = m_hasChangedLocalPDP.load();
+
     PDP::announceParticipantState(new_change, dispose, wp);
 
-    if (!(dispose || new_change))
+    if (!dispose)
+    {
+        // Every participant discovered so far receives the DATA(p)
+        response_pending_.store(false);
+    }
+
+    if (!(dispose || new_change || local_data_changed))
     {
         StatelessWriter* pW = dynamic_cast<StatelessWriter*>(mp_PDPWriter);
 
@@ -230,6 +262,50 @@ void PDPSimple::announceParticipantState(
     }
 }
 
+void PDPSimple::announce_participant_periodically()
+{
+    // Newly discovered participants receive the DATA(p) when their SPDP reader is matched, so the already known
+    // ones only need most of the periodic announcements to keep this participant alive
+    if ((compact_announcements_left_ > 0) && !initial_announcements_pending() && !response_pending_.load() &&
+            !m_hasChangedLocalPDP.load())
+    {
+        StatelessWriter* pW = dynamic_cast<StatelessWriter*>(mp_PDPWriter);
+        if (pW != nullptr)
+        {
+            --compact_announcements_left_;
+            send_compact_announcement(pW);
+            return;
+        }
+    }
+
+    compact_announcements_left_ = compact_announcements_;
+    announceParticipantState(false);
+}
+
+void PDPSimple::send_compact_announcement(
+        StatelessWriter* writer)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(writer->getMutex());
+
+    SequenceNumber_t first_seq = writer->get_seq_num_min();
+    SequenceNumber_t last_seq = writer->get_seq_num_max();
+    if (first_seq == c_SequenceNumber_Unknown || last_seq == c_SequenceNumber_Unknown)
+    {
+        writer->unsent_changes_reset();
+        return;
+    }
+
+    try
+    {
+        RTPSMessageGroup group(mp_RTPSParticipant, writer, *writer);
+        group.add_heartbeat(first_seq, last_seq, ++compact_announcement_count_, true, false);
+    }
+    catch (const RTPSMessageGroup::timeout&)
+    {
+        logError(RTPS_PDP, "Max blocking time reached");
+    }
+}
+
 bool PDPSimple::createPDPEndpoints()
 {
     logInfo(RTPS_PDP, "Beginning");
@@ -302,8 +378,7 @@ bool PDPSimple::createPDPEndpoints()
     watt.endpoint.remoteLocatorList = m_discovery.initialPeersList;
     watt.matched_readers_allocation = allocation.participants;
 
-    if (mp_RTPSParticipant->getRTPSParticipantAttributes().throughputController.bytesPerPeriod != UINT32_MAX &&
-            mp_RTPSParticipant->getRTPSParticipantAttributes().throughputController.periodMillisecs != 0)
+    if (!mp_RTPSParticipant->getFlowControllers().empty() || discovery_flow_controller_)
     {
         watt.mode = ASYNCHRONOUS_WRITER;
     }
@@ -312,6 +387,12 @@ bool PDPSimple::createPDPEndpoints()
     if (mp_RTPSParticipant->createWriter(&wout, watt, writer_payload_pool_, mp_PDPWriterHistory, nullptr,
             c_EntityId_SPDPWriter, true))
     {
+        if (discovery_flow_controller_)
+        {
+            wout->add_flow_controller(std::unique_ptr<FlowController>(
+                        new SharedFlowController(discovery_flow_controller_, wout, watt)));
+        }
+
 #if HAVE_SECURITY
         mp_RTPSParticipant->set_endpoint_rtps_protection_supports(wout, false);
 #endif // if HAVE_SECURITY
@@ -380,9 +461,20 @@ void PDPSimple::assignRemoteEndpoints(
         temp_reader_data_.set_remote_locators(pdata->metatraffic_locators, network, use_multicast_locators);
         temp_reader_data_.m_qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
         temp_reader_data_.m_qos.m_durability.kind = TRANSIENT_LOCAL_DURABILITY_QOS;
+        if (response_suppression_ms_ > 0.0)
+        {
+            // A volatile reader is not sent the DATA(p) right away. It will be sent on the next announcement.
+            temp_reader_data_.m_qos.m_durability.kind = VOLATILE_DURABILITY_QOS;
+            response_pending_.store(true);
+        }
         mp_PDPWriter->matched_reader_add(temp_reader_data_);
     }
 
+    if (response_pending_.load())
+    {
+        bring_forward_announcement(response_suppression_ms_);
+    }
+
 #if HAVE_SECURITY
     // Validate remote participant
     mp_RTPSParticipant->security_manager().discovered_participant(*pdata);
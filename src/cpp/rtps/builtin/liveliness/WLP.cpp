@@ -256,8 +256,7 @@ bool WLP::createEndpoints()
     watt.endpoint.topicKind = WITH_KEY;
     watt.endpoint.durabilityKind = TRANSIENT_LOCAL;
     watt.endpoint.reliabilityKind = RELIABLE;
-    if (mp_participant->getRTPSParticipantAttributes().throughputController.bytesPerPeriod != UINT32_MAX &&
-            mp_participant->getRTPSParticipantAttributes().throughputController.periodMillisecs != 0)
+    if (!mp_participant->getFlowControllers().empty())
     {
         watt.mode = ASYNCHRONOUS_WRITER;
     }
@@ -358,8 +357,7 @@ bool WLP::createSecureEndpoints()
     watt.endpoint.topicKind = WITH_KEY;
     watt.endpoint.durabilityKind = TRANSIENT_LOCAL;
     watt.endpoint.reliabilityKind = RELIABLE;
-    if (mp_participant->getRTPSParticipantAttributes().throughputController.bytesPerPeriod != UINT32_MAX &&
-            mp_participant->getRTPSParticipantAttributes().throughputController.periodMillisecs != 0)
+    if (!mp_participant->getFlowControllers().empty())
     {
         watt.mode = ASYNCHRONOUS_WRITER;
     }
@@ -0,0 +1,189 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DestinationShaper.hpp
+ */
+
+#ifndef RTPS_FLOWCONTROL_DESTINATIONSHAPER_HPP
+#define RTPS_FLOWCONTROL_DESTINATIONSHAPER_HPP
+
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <rtps/flowcontrol/TokenBucket.hpp>
+
+#include <cstdint>
+#include <map>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Paces the bytes sent to each remote participant with its own token bucket.
+ *
+ * A slow link to one participant only delays the data sent to that participant, instead of consuming the
+ * bandwidth shared with the rest of destinations. Buckets are created the first time data is sent to a
+ * destination, full, and refilled at the same rate.
+ */
+class DestinationShaper
+{
+public:
+
+    using clock = TokenBucket::clock;
+
+    /**
+     * Constructor.
+     *
+     * @param bytes_per_second Refill rate of the bucket of each destination. 0 means shaping is disabled.
+     * @param burst_size Maximum number of bytes that can be sent at once to a destination.
+     */
+    DestinationShaper(
+            uint64_t bytes_per_second,
+            uint32_t burst_size)
+        : bytes_per_second_(bytes_per_second)
+        , burst_size_(burst_size)
+    {
+    }
+
+    /**
+     * Try to send a block of bytes to a destination.
+     *
+     * When the block cannot be sent, its size is accounted as deferred for the destination.
+     *
+     * @param destination Prefix of the remote participant.
+     * @param bytes Size of the block to send.
+     * @param now Current time.
+     * @return true when the block can be sent, false otherwise.
+     */
+    bool try_send(
+            const GuidPrefix_t& destination,
+            uint32_t bytes,
+            const clock::time_point& now = clock::now())
+    {
+        Destination& dest = get(destination, now);
+        if (dest.bucket.try_consume(bytes, now))
+        {
+            dest.sent_bytes += bytes;
+            return true;
+        }
+
+        dest.deferred_bytes += bytes;
+        return false;
+    }
+
+    /**
+     * Account for a block of bytes deferred without trying to send it.
+     *
+     * @param destination Prefix of the remote participant.
+     * @param bytes Size of the block deferred.
+     */
+    void defer(
+            const GuidPrefix_t& destination,
+            uint32_t bytes)
+    {
+        get(destination, clock::now()).deferred_bytes += bytes;
+    }
+
+    /**
+     * Time to wait until a block of bytes could be sent to a destination.
+     *
+     * @param destination Prefix of the remote participant.
+     * @param bytes Size of the block to send.
+     * @param now Current time.
+     * @return time until the block could be sent, zero if it can be sent now.
+     */
+    clock::duration time_until_available(
+            const GuidPrefix_t& destination,
+            uint32_t bytes,
+            const clock::time_point& now = clock::now())
+    {
+        auto it = destinations_.find(destination);
+        if (it == destinations_.end())
+        {
+            return clock::duration::zero();
+        }
+        return it->second.bucket.time_until_available(bytes, now);
+    }
+
+    /**
+     * Forget the state kept for a destination.
+     *
+     * @param destination Prefix of the remote participant.
+     */
+    void remove_destination(
+            const GuidPrefix_t& destination)
+    {
+        destinations_.erase(destination);
+    }
+
+    //! @return Number of bytes sent to a destination.
+    uint64_t sent_bytes(
+            const GuidPrefix_t& destination) const
+    {
+        auto it = destinations_.find(destination);
+        return (it == destinations_.end()) ? 0u : it->second.sent_bytes;
+    }
+
+    //! @return Number of bytes that could not be sent to a destination when they were first tried.
+    uint64_t deferred_bytes(
+            const GuidPrefix_t& destination) const
+    {
+        auto it = destinations_.find(destination);
+        return (it == destinations_.end()) ? 0u : it->second.deferred_bytes;
+    }
+
+private:
+
+    struct Destination
+    {
+        Destination(
+                uint64_t bytes_per_second,
+                uint32_t burst_size,
+                const clock::time_point& now)
+            : bucket(bytes_per_second, burst_size, now)
+        {
+        }
+
+        TokenBucket bucket;
+        uint64_t sent_bytes = 0;
+        uint64_t deferred_bytes = 0;
+    };
+
+    Destination& get(
+            const GuidPrefix_t& destination,
+            const clock::time_point& now)
+    {
+        auto it = destinations_.find(destination);
+        if (it == destinations_.end())
+        {
+            it = destinations_.emplace(destination, Destination(bytes_per_second_, burst_size_, now)).first;
+        }
+        return it->second;
+    }
+
+    //! Refill rate of the buckets
+    uint64_t bytes_per_second_;
+
+    //! Size of the buckets
+    uint32_t burst_size_;
+
+    //! State of each destination
+    std::map<GuidPrefix_t, Destination> destinations_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif  // RTPS_FLOWCONTROL_DESTINATIONSHAPER_HPP
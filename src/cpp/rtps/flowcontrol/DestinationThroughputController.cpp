@@ -0,0 +1,217 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DestinationThroughputController.cpp
+ */
+
+#include <rtps/flowcontrol/DestinationThroughputController.h>
+
+#include <fastdds/rtps/resources/AsyncWriterThread.h>
+#include <fastdds/rtps/writer/ReaderProxy.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+#include <rtps/participant/RTPSParticipantImpl.h>
+#include <asio.hpp>
+#include <asio/steady_timer.hpp>
+
+#include <algorithm>
+#include <cassert>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+static uint64_t bytes_per_second(
+        const ThroughputControllerDescriptor& descriptor)
+{
+    return (0 == descriptor.periodMillisecs) ? 0u :
+           static_cast<uint64_t>(descriptor.bytesPerPeriod) * 1000u / descriptor.periodMillisecs;
+}
+
+static uint32_t item_size(
+        const CacheChange_t* change,
+        FragmentNumber_t fragNum)
+{
+    if (fragNum != 0)
+    {
+        return (fragNum + 1) != change->getFragmentCount() ?
+               change->getFragmentSize() : change->serializedPayload.length - (fragNum * change->getFragmentSize());
+    }
+    return change->serializedPayload.length;
+}
+
+DestinationThroughputController::DestinationThroughputController(
+        const ThroughputControllerDescriptor& descriptor,
+        RTPSParticipantImpl* associatedParticipant)
+    : mAssociatedParticipant(associatedParticipant)
+    , mShaper(bytes_per_second(descriptor), descriptor.bytesPerPeriod)
+{
+}
+
+void DestinationThroughputController::operator ()(
+        RTPSWriterCollector<ReaderLocator*>& /*changesToSend*/)
+{
+    // Stateless writers do not know the participant each locator belongs to
+}
+
+void DestinationThroughputController::operator ()(
+        RTPSWriterCollector<ReaderProxy*>& changesToSend)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mMutex);
+
+    auto it = changesToSend.items().begin();
+    if (it == changesToSend.items().end())
+    {
+        return;
+    }
+
+    const GUID_t writer_guid = it->cacheChange->writerGUID;
+    auto now = DestinationShaper::clock::now();
+    auto wake_up_delay = DestinationShaper::clock::duration::max();
+
+    // Destinations refused on this call keep being refused, so the changes are received in order
+    std::set<GuidPrefix_t> refused;
+
+    while (it != changesToSend.items().end())
+    {
+        assert(it->cacheChange != nullptr);
+        uint32_t dataLength = item_size(it->cacheChange, it->fragmentNumber);
+
+        // Readers of the same participant usually get the data on a single message, so it is only charged once
+        std::set<GuidPrefix_t> charged;
+        std::set<GuidPrefix_t> deferred;
+
+        std::vector<ReaderProxy*>& readers = it->remoteReaders;
+        auto last = std::remove_if(readers.begin(), readers.end(), [&](ReaderProxy* reader)
+                        {
+                            const GuidPrefix_t& destination = reader->guid().guidPrefix;
+                            if (charged.count(destination) > 0)
+                            {
+                                return false;
+                            }
+
+                            if (refused.count(destination) > 0)
+                            {
+                                if (deferred.insert(destination).second)
+                                {
+                                    mShaper.defer(destination, dataLength);
+                                }
+                                return true;
+                            }
+
+                            if (mShaper.try_send(destination, dataLength, now))
+                            {
+                                charged.insert(destination);
+                                return false;
+                            }
+
+                            refused.insert(destination);
+                            deferred.insert(destination);
+                            wake_up_delay = std::min(wake_up_delay,
+                                    mShaper.time_until_available(destination, dataLength, now));
+                            return true;
+                        });
+        readers.erase(last, readers.end());
+
+        if (readers.empty())
+        {
+            it = changesToSend.items().erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    if (!refused.empty())
+    {
+        ScheduleWakeUp(writer_guid, wake_up_delay);
+    }
+}
+
+void DestinationThroughputController::disable()
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mMutex);
+    mAssociatedParticipant = nullptr;
+}
+
+void DestinationThroughputController::register_writer(
+        RTPSWriter* writer,
+        const WriterAttributes& /*attributes*/)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mMutex);
+    mWriters[writer->getGuid()] = writer;
+}
+
+void DestinationThroughputController::unregister_writer(
+        RTPSWriter* writer)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mMutex);
+    mWriters.erase(writer->getGuid());
+    mPendingWakeUps.erase(writer->getGuid());
+}
+
+void DestinationThroughputController::remove_remote_participant(
+        const GuidPrefix_t& participant_prefix)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mMutex);
+    mShaper.remove_destination(participant_prefix);
+}
+
+uint64_t DestinationThroughputController::deferred_bytes(
+        const GuidPrefix_t& destination)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mMutex);
+    return mShaper.deferred_bytes(destination);
+}
+
+void DestinationThroughputController::ScheduleWakeUp(
+        const GUID_t& writerGuid,
+        DestinationShaper::clock::duration delay)
+{
+    if (!mPendingWakeUps.insert(writerGuid).second)
+    {
+        return;
+    }
+
+    std::shared_ptr<asio::steady_timer> throwawayTimer(std::make_shared<asio::steady_timer>(
+                *FlowController::ControllerService));
+    auto wake_up = [throwawayTimer, this, writerGuid]
+                (const asio::error_code& error)
+            {
+                if ((error != asio::error::operation_aborted) &&
+                        FlowController::IsListening(this))
+                {
+                    std::unique_lock<std::recursive_mutex> scopedLock(mMutex);
+                    throwawayTimer->cancel();
+
+                    // Writers are unregistered before being destroyed, so the pointers are valid
+                    if (mPendingWakeUps.erase(writerGuid) > 0 && mAssociatedParticipant)
+                    {
+                        auto writer = mWriters.find(writerGuid);
+                        if (writer != mWriters.end())
+                        {
+                            mAssociatedParticipant->async_thread().wake_up(writer->second);
+                        }
+                    }
+                }
+            };
+
+    throwawayTimer->expires_from_now(delay);
+    throwawayTimer->async_wait(wake_up);
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,102 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DestinationThroughputController.h
+ */
+
+#ifndef RTPS_FLOWCONTROL_DESTINATIONTHROUGHPUTCONTROLLER_H
+#define RTPS_FLOWCONTROL_DESTINATIONTHROUGHPUTCONTROLLER_H
+
+#include <rtps/flowcontrol/FlowController.h>
+#include <rtps/flowcontrol/DestinationShaper.hpp>
+#include <fastdds/rtps/flowcontrol/ThroughputControllerDescriptor.h>
+
+#include <map>
+#include <set>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSWriter;
+class RTPSParticipantImpl;
+
+/**
+ * Filter that paces the data sent to each remote participant independently.
+ *
+ * Each remote participant has its own bandwidth of bytesPerPeriod bytes every periodMillisecs milliseconds, so a
+ * destination behind a slow link does not consume the bandwidth available for the rest of destinations.
+ * Readers whose participant has run out of bandwidth are removed from the changes to send, and the writer is
+ * woken up when the bandwidth of the destination is available again.
+ *
+ * Only changes of stateful writers are shaped, as stateless writers do not know the destination of each change.
+ */
+class DestinationThroughputController : public FlowController
+{
+public:
+
+    DestinationThroughputController(
+            const ThroughputControllerDescriptor& descriptor,
+            RTPSParticipantImpl* associatedParticipant);
+
+    virtual void operator ()(
+            RTPSWriterCollector<ReaderLocator*>& changesToSend) override;
+    virtual void operator ()(
+            RTPSWriterCollector<ReaderProxy*>& changesToSend) override;
+
+    virtual void disable() override;
+
+    virtual void register_writer(
+            RTPSWriter* writer,
+            const WriterAttributes& attributes) override;
+
+    virtual void unregister_writer(
+            RTPSWriter* writer) override;
+
+    virtual void remove_remote_participant(
+            const GuidPrefix_t& participant_prefix) override;
+
+    //! @return Number of bytes that could not be sent to a remote participant when they were first tried.
+    uint64_t deferred_bytes(
+            const GuidPrefix_t& destination);
+
+private:
+
+    /*
+     * Schedules writer "writerGuid" to be woken up after the given time, if it is not already scheduled.
+     */
+    void ScheduleWakeUp(
+            const GUID_t& writerGuid,
+            DestinationShaper::clock::duration delay);
+
+    std::recursive_mutex mMutex;
+
+    RTPSParticipantImpl* mAssociatedParticipant;
+
+    //! Token bucket of each remote participant
+    DestinationShaper mShaper;
+
+    //! Writers of the participant using this controller
+    std::map<GUID_t, RTPSWriter*> mWriters;
+
+    //! Writers with a wake up already scheduled
+    std::set<GUID_t> mPendingWakeUps;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif  // RTPS_FLOWCONTROL_DESTINATIONTHROUGHPUTCONTROLLER_H
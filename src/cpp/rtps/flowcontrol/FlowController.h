@@ -31,6 +31,8 @@ namespace rtps{
 
 class ReaderLocator;
 class ReaderProxy;
+class RTPSWriter;
+class WriterAttributes;
 
 /**
  * Flow Controllers take a vector of cache changes (by reference) and return a filtered
@@ -50,6 +52,34 @@ class FlowController
 
         virtual void disable() = 0;
 
+        /**
+         * Called when a writer that will use this controller is created.
+         * Only used on controllers shared by the writers of a participant.
+         */
+        virtual void register_writer(
+                RTPSWriter* /*writer*/,
+                const WriterAttributes& /*attributes*/)
+        {
+        }
+
+        /**
+         * Called when a writer that uses this controller is being destroyed.
+         * The controller should not access the writer after this call.
+         */
+        virtual void unregister_writer(
+                RTPSWriter* /*writer*/)
+        {
+        }
+
+        /**
+         * Called when a remote participant is removed, so the state kept for it can be released.
+         * Only used on controllers shared by the writers of a participant.
+         */
+        virtual void remove_remote_participant(
+                const GuidPrefix_t& /*participant_prefix*/)
+        {
+        }
+
         virtual ~FlowController();
         FlowController();
 
@@ -0,0 +1,321 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FlowControllerScheduler.hpp
+ */
+
+#ifndef RTPS_FLOWCONTROL_FLOWCONTROLLERSCHEDULER_HPP
+#define RTPS_FLOWCONTROL_FLOWCONTROLLERSCHEDULER_HPP
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/Time_t.h>
+#include <fastdds/rtps/flowcontrol/ThroughputControllerDescriptor.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Decides which of the writers sharing a throughput controller may use its bandwidth.
+ *
+ * Writers that could not send all their changes are recorded as blocked until the bandwidth of the controller is
+ * refreshed. While there are blocked writers, the policy decides whether another writer may use the remaining
+ * bandwidth before them, and the order in which they are woken up on the refresh.
+ */
+class FlowControllerScheduler
+{
+public:
+
+    //! Value returned by share() when the writer is not limited by the scheduler.
+    static constexpr uint32_t unlimited = std::numeric_limits<uint32_t>::max();
+
+    /**
+     * Constructor.
+     *
+     * @param policy Scheduling policy.
+     * @param bytes_per_period Bandwidth of the controller.
+     */
+    FlowControllerScheduler(
+            FlowControllerSchedulerPolicy policy,
+            uint32_t bytes_per_period)
+        : policy_(policy)
+        , bytes_per_period_(bytes_per_period)
+    {
+    }
+
+    /**
+     * Register the scheduling parameters of a writer.
+     *
+     * Writers not registered are scheduled with priority 0 and an infinite send deadline.
+     *
+     * @param writer_guid GUID of the writer.
+     * @param priority Priority of the writer. Lower values are served first.
+     * @param send_deadline Maximum time since a sample is written until it should be sent.
+     */
+    void register_writer(
+            const GUID_t& writer_guid,
+            int32_t priority,
+            const Duration_t& send_deadline)
+    {
+        WriterInfo& info = writers_[writer_guid];
+        info.priority = priority;
+        info.send_deadline_ns = (send_deadline == c_TimeInfinite) ? infinite_deadline : send_deadline.to_ns();
+    }
+
+    /**
+     * Forget a writer.
+     *
+     * @param writer_guid GUID of the writer.
+     */
+    void unregister_writer(
+            const GUID_t& writer_guid)
+    {
+        writers_.erase(writer_guid);
+        blocked_.erase(
+            std::remove_if(blocked_.begin(), blocked_.end(), [&writer_guid](const Blocked& b)
+            {
+                return b.writer_guid == writer_guid;
+            }),
+            blocked_.end());
+    }
+
+    /**
+     * Deadline of a change of a writer.
+     *
+     * @param writer_guid GUID of the writer.
+     * @param source_timestamp Source timestamp of the change.
+     * @return Time in nanoseconds when the change should have been sent.
+     */
+    int64_t deadline(
+            const GUID_t& writer_guid,
+            const Time_t& source_timestamp) const
+    {
+        auto it = writers_.find(writer_guid);
+        if (it == writers_.end() || infinite_deadline == it->second.send_deadline_ns)
+        {
+            return infinite_deadline;
+        }
+
+        int64_t timestamp = source_timestamp.to_ns();
+        return (timestamp > infinite_deadline - it->second.send_deadline_ns) ?
+               infinite_deadline : timestamp + it->second.send_deadline_ns;
+    }
+
+    /**
+     * Number of bytes a writer may send now, given the writers blocked.
+     *
+     * @param writer_guid GUID of the writer.
+     * @param deadline Deadline of the first change the writer wants to send.
+     * @return 0 when the writer should wait for the blocked writers, unlimited when it is not limited by the
+     * scheduler.
+     */
+    uint32_t share(
+            const GUID_t& writer_guid,
+            int64_t deadline) const
+    {
+        switch (policy_)
+        {
+            case FlowControllerSchedulerPolicy::ROUND_ROBIN:
+            {
+                size_t n_others = std::count_if(blocked_.begin(), blocked_.end(), [&writer_guid](const Blocked& b)
+                                {
+                                    return b.writer_guid != writer_guid;
+                                });
+                if (0u == n_others)
+                {
+                    return unlimited;
+                }
+
+                uint32_t fair_share = static_cast<uint32_t>(bytes_per_period_ / (n_others + 1u));
+                uint32_t in_use = bytes_in_use(writer_guid);
+                return (fair_share > in_use) ? fair_share - in_use : 0u;
+            }
+
+            case FlowControllerSchedulerPolicy::HIGH_PRIORITY:
+            {
+                int32_t own_priority = priority(writer_guid);
+                for (const Blocked& b : blocked_)
+                {
+                    if (b.writer_guid != writer_guid && priority(b.writer_guid) < own_priority)
+                    {
+                        return 0u;
+                    }
+                }
+                return unlimited;
+            }
+
+            case FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST:
+            {
+                for (const Blocked& b : blocked_)
+                {
+                    if (b.writer_guid != writer_guid && b.deadline < deadline)
+                    {
+                        return 0u;
+                    }
+                }
+                return unlimited;
+            }
+
+            case FlowControllerSchedulerPolicy::FIFO:
+            default:
+                return unlimited;
+        }
+    }
+
+    /**
+     * Account for bytes sent by a writer, until they are restored.
+     *
+     * @param writer_guid GUID of the writer.
+     * @param bytes Number of bytes sent.
+     */
+    void bytes_sent(
+            const GUID_t& writer_guid,
+            uint32_t bytes)
+    {
+        auto it = writers_.find(writer_guid);
+        if (it != writers_.end())
+        {
+            it->second.bytes_in_use += bytes;
+        }
+    }
+
+    /**
+     * Account for bytes of a writer restored to the bandwidth of the controller.
+     *
+     * @param writer_guid GUID of the writer.
+     * @param bytes Number of bytes restored.
+     */
+    void bytes_restored(
+            const GUID_t& writer_guid,
+            uint32_t bytes)
+    {
+        auto it = writers_.find(writer_guid);
+        if (it != writers_.end())
+        {
+            it->second.bytes_in_use = (bytes > it->second.bytes_in_use) ? 0u : it->second.bytes_in_use - bytes;
+        }
+    }
+
+    /**
+     * Record a writer that could not send all its changes.
+     *
+     * @param writer_guid GUID of the writer.
+     * @param deadline Deadline of the first change the writer could not send.
+     */
+    void writer_blocked(
+            const GUID_t& writer_guid,
+            int64_t deadline)
+    {
+        for (Blocked& b : blocked_)
+        {
+            if (b.writer_guid == writer_guid)
+            {
+                b.deadline = std::min(b.deadline, deadline);
+                return;
+            }
+        }
+
+        blocked_.push_back({writer_guid, deadline});
+    }
+
+    /**
+     * Take the writers blocked, in the order they should be woken up.
+     *
+     * @return GUIDs of the writers blocked. The list of blocked writers is cleared.
+     */
+    std::vector<GUID_t> take_blocked_writers()
+    {
+        // Blocked writers are kept in arrival order, which is the one used by FIFO and ROUND_ROBIN
+        if (FlowControllerSchedulerPolicy::HIGH_PRIORITY == policy_)
+        {
+            std::stable_sort(blocked_.begin(), blocked_.end(), [this](const Blocked& a, const Blocked& b)
+                    {
+                        return priority(a.writer_guid) < priority(b.writer_guid);
+                    });
+        }
+        else if (FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST == policy_)
+        {
+            std::stable_sort(blocked_.begin(), blocked_.end(), [](const Blocked& a, const Blocked& b)
+                    {
+                        return a.deadline < b.deadline;
+                    });
+        }
+
+        std::vector<GUID_t> ret;
+        ret.reserve(blocked_.size());
+        for (const Blocked& b : blocked_)
+        {
+            ret.push_back(b.writer_guid);
+        }
+        blocked_.clear();
+        return ret;
+    }
+
+    //! Deadline of changes that should be sent at some point.
+    static constexpr int64_t infinite_deadline = std::numeric_limits<int64_t>::max();
+
+private:
+
+    struct WriterInfo
+    {
+        int32_t priority = 0;
+        int64_t send_deadline_ns = infinite_deadline;
+        uint32_t bytes_in_use = 0;
+    };
+
+    struct Blocked
+    {
+        GUID_t writer_guid;
+        int64_t deadline;
+    };
+
+    int32_t priority(
+            const GUID_t& writer_guid) const
+    {
+        auto it = writers_.find(writer_guid);
+        return (it == writers_.end()) ? 0 : it->second.priority;
+    }
+
+    uint32_t bytes_in_use(
+            const GUID_t& writer_guid) const
+    {
+        auto it = writers_.find(writer_guid);
+        return (it == writers_.end()) ? 0u : it->second.bytes_in_use;
+    }
+
+    //! Scheduling policy
+    FlowControllerSchedulerPolicy policy_;
+
+    //! Bandwidth of the controller
+    uint32_t bytes_per_period_;
+
+    //! Scheduling parameters of the writers
+    std::map<GUID_t, WriterInfo> writers_;
+
+    //! Writers waiting for the bandwidth to be refreshed, in arrival order
+    std::vector<Blocked> blocked_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif  // RTPS_FLOWCONTROL_FLOWCONTROLLERSCHEDULER_HPP
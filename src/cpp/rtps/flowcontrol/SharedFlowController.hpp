@@ -0,0 +1,88 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedFlowController.hpp
+ */
+
+#ifndef RTPS_FLOWCONTROL_SHAREDFLOWCONTROLLER_HPP
+#define RTPS_FLOWCONTROL_SHAREDFLOWCONTROLLER_HPP
+
+#include <rtps/flowcontrol/FlowController.h>
+
+#include <memory>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Lets a writer use a controller shared with a subset of the writers of the participant, like the discovery ones.
+ *
+ * Writers own the controllers added to them, so each one of them gets one of these, forwarding to the shared
+ * controller, which is only destroyed after all of them.
+ */
+class SharedFlowController : public FlowController
+{
+public:
+
+    /**
+     * Constructor. Registers the writer on the shared controller.
+     *
+     * @param controller Controller shared by several writers.
+     * @param writer Writer using this object.
+     * @param attributes Attributes of the writer.
+     */
+    SharedFlowController(
+            const std::shared_ptr<FlowController>& controller,
+            RTPSWriter* writer,
+            const WriterAttributes& attributes)
+        : controller_(controller)
+        , writer_(writer)
+    {
+        controller_->register_writer(writer_, attributes);
+    }
+
+    void operator ()(
+            RTPSWriterCollector<ReaderLocator*>& changesToSend) override
+    {
+        (*controller_)(changesToSend);
+    }
+
+    void operator ()(
+            RTPSWriterCollector<ReaderProxy*>& changesToSend) override
+    {
+        (*controller_)(changesToSend);
+    }
+
+    void disable() override
+    {
+        if (writer_ != nullptr)
+        {
+            controller_->unregister_writer(writer_);
+            writer_ = nullptr;
+        }
+    }
+
+private:
+
+    std::shared_ptr<FlowController> controller_;
+    RTPSWriter* writer_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // RTPS_FLOWCONTROL_SHAREDFLOWCONTROLLER_HPP
@@ -14,12 +14,14 @@
 
 #include <rtps/flowcontrol/ThroughputController.h>
 
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/resources/AsyncWriterThread.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
 #include <asio.hpp>
 #include <asio/steady_timer.hpp>
 #include <cassert>
+#include <cstdlib>
 
 
 namespace eprosima {
@@ -34,6 +36,7 @@ ThroughputController::ThroughputController(
     , mPeriodMillisecs(descriptor.periodMillisecs)
     , mAssociatedParticipant(nullptr)
     , mAssociatedWriter(associatedWriter)
+    , mScheduler(descriptor.scheduler, descriptor.bytesPerPeriod)
 {
 }
 
@@ -45,6 +48,7 @@ ThroughputController::ThroughputController(
     , mPeriodMillisecs(descriptor.periodMillisecs)
     , mAssociatedParticipant(associatedParticipant)
     , mAssociatedWriter(nullptr)
+    , mScheduler(descriptor.scheduler, descriptor.bytesPerPeriod)
 {
 }
 
@@ -69,23 +73,64 @@ void ThroughputController::disable()
     mAssociatedParticipant = nullptr;
 }
 
+void ThroughputController::register_writer(
+        RTPSWriter* writer,
+        const WriterAttributes& attributes)
+{
+    int32_t priority = 0;
+    const std::string* priority_property = PropertyPolicyHelper::find_property(attributes.endpoint.properties,
+                    "fastdds.sfc.priority");
+    if (priority_property != nullptr)
+    {
+        priority = static_cast<int32_t>(std::strtol(priority_property->c_str(), nullptr, 10));
+    }
+
+    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+    mWriters[writer->getGuid()] = writer;
+    mScheduler.register_writer(writer->getGuid(), priority, attributes.send_deadline);
+}
+
+void ThroughputController::unregister_writer(
+        RTPSWriter* writer)
+{
+    std::unique_lock<std::recursive_mutex> scopedLock(mThroughputControllerMutex);
+    mWriters.erase(writer->getGuid());
+    mScheduler.unregister_writer(writer->getGuid());
+}
+
 template<typename Collector>
 void ThroughputController::process_nts(Collector& changesToSend)
 {
-    uint32_t size_to_restore = 0;
     auto it = changesToSend.items().begin();
+    if (it == changesToSend.items().end())
+    {
+        return;
+    }
+
+    // All the changes come from the same writer
+    const GUID_t writer_guid = it->cacheChange->writerGUID;
+    uint32_t share = mScheduler.share(writer_guid, mScheduler.deadline(writer_guid, it->cacheChange->sourceTimestamp));
+
+    uint32_t size_to_restore = 0;
     while (
         it != changesToSend.items().end() &&
-        process_change_nts_(it->cacheChange, it->sequenceNumber, it->fragmentNumber, &size_to_restore))
+        process_change_nts_(it->cacheChange, it->sequenceNumber, it->fragmentNumber, share, &size_to_restore))
     {
         ++it;
     }
 
+    // Writers sharing the controller are woken up on the next refresh, in the order decided by the scheduler
+    if (it != changesToSend.items().end() && mAssociatedParticipant != nullptr && mAccumulatedPayloadSize > 0)
+    {
+        mScheduler.writer_blocked(writer_guid, mScheduler.deadline(writer_guid, it->cacheChange->sourceTimestamp));
+    }
+
     changesToSend.items().erase(it, changesToSend.items().end());
 
     if (size_to_restore > 0)
     {
-        ScheduleRefresh(size_to_restore);
+        mScheduler.bytes_sent(writer_guid, size_to_restore);
+        ScheduleRefresh(size_to_restore, writer_guid);
     }
 }
 
@@ -93,6 +138,7 @@ bool ThroughputController::process_change_nts_(
         CacheChange_t* change,
         const SequenceNumber_t& /*seqNum*/,
         const FragmentNumber_t fragNum,
+        uint32_t share,
         uint32_t* accumulated_size)
 {
     assert(change != nullptr);
@@ -105,7 +151,10 @@ bool ThroughputController::process_change_nts_(
                 change->getFragmentSize() : change->serializedPayload.length - (fragNum * change->getFragmentSize());
     }
 
-    if ((mAccumulatedPayloadSize + dataLength) <= mBytesPerPeriod)
+    // The scheduler always lets through the first change when the writer has some share of the bandwidth
+    bool within_share = (0 == *accumulated_size) ? (share > 0) : (*accumulated_size + dataLength <= share);
+
+    if (within_share && (mAccumulatedPayloadSize + dataLength) <= mBytesPerPeriod)
     {
         mAccumulatedPayloadSize += dataLength;
         *accumulated_size += dataLength;
@@ -116,11 +165,12 @@ bool ThroughputController::process_change_nts_(
 }
 
 void ThroughputController::ScheduleRefresh(
-        uint32_t sizeToRestore)
+        uint32_t sizeToRestore,
+        const GUID_t& writerGuid)
 {
     std::shared_ptr<asio::steady_timer> throwawayTimer(std::make_shared<asio::steady_timer>(
                 *FlowController::ControllerService));
-    auto refresh = [throwawayTimer, this, sizeToRestore]
+    auto refresh = [throwawayTimer, this, sizeToRestore, writerGuid]
                 (const asio::error_code& error)
             {
                 if ((error != asio::error::operation_aborted) &&
@@ -130,6 +180,7 @@ void ThroughputController::ScheduleRefresh(
                     throwawayTimer->cancel();
                     mAccumulatedPayloadSize = sizeToRestore > mAccumulatedPayloadSize ?
                         0 : mAccumulatedPayloadSize - sizeToRestore;
+                    mScheduler.bytes_restored(writerGuid, sizeToRestore);
 
                     if (mAssociatedWriter)
                     {
@@ -137,11 +188,14 @@ void ThroughputController::ScheduleRefresh(
                     }
                     else if (mAssociatedParticipant)
                     {
-                        std::unique_lock<std::recursive_mutex> lock(*mAssociatedParticipant->getParticipantMutex());
-                        for (auto it = mAssociatedParticipant->userWritersListBegin();
-                                it != mAssociatedParticipant->userWritersListEnd(); ++it)
+                        // Writers are unregistered before being destroyed, so the pointers are valid
+                        for (const GUID_t& guid : mScheduler.take_blocked_writers())
                         {
-                            mAssociatedParticipant->async_thread().wake_up(*it);
+                            auto writer = mWriters.find(guid);
+                            if (writer != mWriters.end())
+                            {
+                                mAssociatedParticipant->async_thread().wake_up(writer->second);
+                            }
                         }
                     }
                 }
@@ -16,8 +16,10 @@
 #define THROUGHPUT_CONTROLLER_H
 
 #include <rtps/flowcontrol/FlowController.h>
+#include <rtps/flowcontrol/FlowControllerScheduler.hpp>
 #include <fastdds/rtps/flowcontrol/ThroughputControllerDescriptor.h>
 
+#include <map>
 #include <thread>
 
 namespace eprosima {
@@ -32,6 +34,9 @@ class RTPSParticipantImpl;
  * It refreshes after a given time in MS, in a staggered way (e.g. if it clears
  * 500kb at t=0 and 800 kb at t=10, it will refresh 500kb at t = 0 + period, and
  * then fully refresh at t = 10 + period).
+ *
+ * When shared by the writers of a participant, the order in which writers use the bandwidth is decided by the
+ * scheduler policy of the descriptor.
  */
 class ThroughputController : public FlowController
 {
@@ -51,6 +56,13 @@ public:
 
     virtual void disable() override;
 
+    virtual void register_writer(
+            RTPSWriter* writer,
+            const WriterAttributes& attributes) override;
+
+    virtual void unregister_writer(
+            RTPSWriter* writer) override;
+
 private:
 
     template<typename Collector>
@@ -60,6 +72,7 @@ private:
             CacheChange_t* change,
             const SequenceNumber_t& seqNum,
             const FragmentNumber_t fragNum,
+            uint32_t share,
             uint32_t* accumulated_size);
 
     uint32_t mBytesPerPeriod;
@@ -70,12 +83,18 @@ private:
     RTPSParticipantImpl* mAssociatedParticipant;
     RTPSWriter* mAssociatedWriter;
 
+    //! Decides the order in which the writers of the participant use the bandwidth
+    FlowControllerScheduler mScheduler;
+    //! Writers of the participant using this controller
+    std::map<GUID_t, RTPSWriter*> mWriters;
+
     /*
      * Schedules the filter to be refreshed in period ms. When it does, its capacity
-     * will be partially restored, by "sizeToRestore" bytes.
+     * will be partially restored, by "sizeToRestore" bytes, sent by writer "writerGuid".
      */
     void ScheduleRefresh(
-            uint32_t sizeToRestore);
+            uint32_t sizeToRestore,
+            const GUID_t& writerGuid);
 };
 
 } // namespace rtps
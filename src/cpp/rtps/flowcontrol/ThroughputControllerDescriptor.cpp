@@ -18,11 +18,17 @@ namespace eprosima{
 namespace fastrtps{
 namespace rtps{
 
-ThroughputControllerDescriptor::ThroughputControllerDescriptor(): bytesPerPeriod(UINT32_MAX), periodMillisecs(0)
+ThroughputControllerDescriptor::ThroughputControllerDescriptor()
+    : bytesPerPeriod(UINT32_MAX)
+    , periodMillisecs(0)
+    , scheduler(FlowControllerSchedulerPolicy::FIFO)
 {
 }
 
-ThroughputControllerDescriptor::ThroughputControllerDescriptor(uint32_t size, uint32_t time): bytesPerPeriod(size), periodMillisecs(time)
+ThroughputControllerDescriptor::ThroughputControllerDescriptor(uint32_t size, uint32_t time)
+    : bytesPerPeriod(size)
+    , periodMillisecs(time)
+    , scheduler(FlowControllerSchedulerPolicy::FIFO)
 {
 }
 
@@ -0,0 +1,178 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TokenBucket.hpp
+ */
+
+#ifndef RTPS_FLOWCONTROL_TOKENBUCKET_HPP
+#define RTPS_FLOWCONTROL_TOKENBUCKET_HPP
+
+#include <chrono>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Token bucket used to pace the bytes sent through a link.
+ *
+ * The bucket is refilled at a constant rate of bytes per second, up to a maximum burst size.
+ * Sending a block of bytes requires the bucket to hold that amount of tokens. Blocks bigger than the burst size
+ * are allowed when the bucket is full, leaving it in debt, so they are never blocked forever.
+ *
+ * A bucket with a rate of 0 bytes per second is disabled, and lets everything through.
+ */
+class TokenBucket
+{
+public:
+
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * Constructor.
+     *
+     * @param bytes_per_second Refill rate of the bucket. 0 means pacing is disabled.
+     * @param burst_size Maximum number of tokens the bucket can hold.
+     * @param now Time when the bucket starts full.
+     */
+    TokenBucket(
+            uint64_t bytes_per_second,
+            uint32_t burst_size,
+            const clock::time_point& now = clock::now())
+        : bytes_per_second_(bytes_per_second)
+        , burst_size_(static_cast<int64_t>(burst_size))
+        , tokens_(static_cast<int64_t>(burst_size))
+        , last_refill_(now)
+    {
+    }
+
+    /**
+     * Whether this bucket is pacing the traffic.
+     */
+    bool is_enabled() const
+    {
+        return bytes_per_second_ > 0;
+    }
+
+    /**
+     * Try to take the tokens needed to send a block of bytes.
+     *
+     * @param bytes Size of the block to send.
+     * @param now Current time.
+     * @return true when the block can be sent, false otherwise.
+     */
+    bool try_consume(
+            uint32_t bytes,
+            const clock::time_point& now = clock::now())
+    {
+        if (!is_enabled())
+        {
+            return true;
+        }
+
+        refill(now);
+        if (tokens_ < required_tokens(bytes))
+        {
+            return false;
+        }
+
+        tokens_ -= static_cast<int64_t>(bytes);
+        return true;
+    }
+
+    /**
+     * Time to wait until a block of bytes could be sent.
+     *
+     * @param bytes Size of the block to send.
+     * @param now Current time.
+     * @return time until enough tokens are available, zero if they are already available.
+     */
+    clock::duration time_until_available(
+            uint32_t bytes,
+            const clock::time_point& now = clock::now())
+    {
+        if (!is_enabled())
+        {
+            return clock::duration::zero();
+        }
+
+        refill(now);
+        int64_t missing = required_tokens(bytes) - tokens_;
+        if (missing <= 0)
+        {
+            return clock::duration::zero();
+        }
+
+        // Round up, so tokens are available when the time has elapsed
+        uint64_t nanoseconds = (static_cast<uint64_t>(missing) * 1000000000ull + bytes_per_second_ - 1u) /
+                bytes_per_second_;
+        return std::chrono::duration_cast<clock::duration>(std::chrono::nanoseconds(nanoseconds));
+    }
+
+private:
+
+    int64_t required_tokens(
+            uint32_t bytes) const
+    {
+        return (static_cast<int64_t>(bytes) < burst_size_) ? static_cast<int64_t>(bytes) : burst_size_;
+    }
+
+    void refill(
+            const clock::time_point& now)
+    {
+        if (now <= last_refill_)
+        {
+            return;
+        }
+
+        int64_t missing = burst_size_ - tokens_;
+        uint64_t elapsed_ns = static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - last_refill_).count());
+        if (missing <= 0 || elapsed_ns >= static_cast<uint64_t>(missing) * 1000000000ull / bytes_per_second_)
+        {
+            tokens_ = burst_size_;
+            last_refill_ = now;
+            return;
+        }
+
+        uint64_t new_tokens = elapsed_ns * bytes_per_second_ / 1000000000ull;
+        if (new_tokens > 0)
+        {
+            // Only advance the time corresponding to the added tokens, so fractions of a token are not lost
+            tokens_ += static_cast<int64_t>(new_tokens);
+            last_refill_ += std::chrono::duration_cast<clock::duration>(
+                std::chrono::nanoseconds(new_tokens * 1000000000ull / bytes_per_second_));
+        }
+    }
+
+    //! Refill rate
+    uint64_t bytes_per_second_;
+
+    //! Maximum number of tokens
+    int64_t burst_size_;
+
+    //! Current number of tokens. May be negative after sending a block bigger than the burst size.
+    int64_t tokens_;
+
+    //! Time of last refill
+    clock::time_point last_refill_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif  // RTPS_FLOWCONTROL_TOKENBUCKET_HPP
@@ -25,6 +25,7 @@
 #include "./TopicPayloadPool_impl/DynamicReusable.hpp"
 
 #include <memory>
+#include <thread>
 
 namespace eprosima {
 namespace fastrtps {
@@ -44,33 +45,36 @@ bool TopicPayloadPool::do_get_payload(
 {
     PayloadNode* payload = nullptr;
 
-    std::unique_lock<std::mutex> lock(mutex_);
-    if (free_payloads_.empty())
+    // Payloads recently released are taken without locking
+    if (!cached_payloads_.try_pop(payload))
     {
-        payload = allocate(size); //Allocates a single payload
-        if (payload == nullptr)
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (free_payloads_.empty())
         {
-            lock.unlock();
-            cache_change.serializedPayload.data = nullptr;
-            cache_change.serializedPayload.max_size = 0;
-            cache_change.payload_owner(nullptr);
-            return false;
+            payload = allocate(size); //Allocates a single payload
+            if (payload == nullptr)
+            {
+                lock.unlock();
+                cache_change.serializedPayload.data = nullptr;
+                cache_change.serializedPayload.max_size = 0;
+                cache_change.payload_owner(nullptr);
+                return false;
+            }
+        }
+        else
+        {
+            payload = free_payloads_.back();
+            free_payloads_.pop_back();
         }
-    }
-    else
-    {
-        payload = free_payloads_.back();
-        free_payloads_.pop_back();
     }
 
-    // Resize if needed
+    // Resize if needed. The payload is not reachable from the pool while it is being resized.
     if (resizeable && size > payload->data_size())
     {
         if (!payload->resize(size))
         {
             // Failed to resize, but we can still keep it for later.
-            free_payloads_.push_back(payload);
-            lock.unlock();
+            return_payload_to_pool(payload);
             logError(RTPS_HISTORY, "Failed to resize the payload");
 
             cache_change.serializedPayload.data = nullptr;
@@ -78,9 +82,11 @@ bool TopicPayloadPool::do_get_payload(
             cache_change.payload_owner(nullptr);
             return false;
         }
+
+        // Reallocation may have moved the payload to another node
+        place_payload(payload);
     }
 
-    lock.unlock();
     payload->reference();
     cache_change.serializedPayload.data = payload->data();
     cache_change.serializedPayload.max_size = payload->data_size();
@@ -138,9 +144,7 @@ bool TopicPayloadPool::release_payload(
 
     if (PayloadNode::dereference(cache_change.serializedPayload.data))
     {
-        std::lock_guard<std::mutex> lock(mutex_);
-        PayloadNode* payload = all_payloads_.at(PayloadNode::data_index(cache_change.serializedPayload.data));
-        free_payloads_.push_back(payload);
+        return_payload_to_pool(PayloadNode::node(cache_change.serializedPayload.data));
     }
 
     cache_change.serializedPayload.length = 0;
@@ -151,6 +155,16 @@ bool TopicPayloadPool::release_payload(
     return true;
 }
 
+void TopicPayloadPool::return_payload_to_pool(
+        PayloadNode* payload)
+{
+    if (!cached_payloads_.try_push(payload))
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_payloads_.push_back(payload);
+    }
+}
+
 bool TopicPayloadPool::reserve_history(
         const PoolConfig& config,
         bool /*is_reader*/)
@@ -193,7 +207,7 @@ TopicPayloadPool::PayloadNode* TopicPayloadPool::do_allocate(
 
     try
     {
-        payload = new PayloadNode(size);
+        payload = new PayloadNode(size, numa_node_ != unknown_numa_node);
     }
     catch (std::bad_alloc& exception)
     {
@@ -201,11 +215,21 @@ TopicPayloadPool::PayloadNode* TopicPayloadPool::do_allocate(
         return nullptr;
     }
 
+    place_payload(payload);
     payload->data_index(static_cast<uint32_t>(all_payloads_.size()));
     all_payloads_.push_back(payload);
     return payload;
 }
 
+void TopicPayloadPool::place_payload(
+        PayloadNode* payload)
+{
+    if (numa_node_ != unknown_numa_node && !payload->bind_to_numa_node(numa_node_))
+    {
+        logInfo(RTPS_HISTORY, "Could not place payload on NUMA node " << numa_node_);
+    }
+}
+
 void TopicPayloadPool::update_maximum_size(
         const PoolConfig& config,
         bool is_reserve)
@@ -260,12 +284,29 @@ void TopicPayloadPool::reserve (
 bool TopicPayloadPool::shrink (
         uint32_t max_num_payloads)
 {
-    assert(payload_pool_allocated_size() - payload_pool_available_size() <= max_num_payloads);
-
     while (max_num_payloads < all_payloads_.size())
     {
-        PayloadNode* payload = free_payloads_.back();
-        free_payloads_.pop_back();
+        // Payloads may keep being released to the cache while shrinking. A payload whose release is in progress
+        // is already counted on the cache, but cannot be taken until it is completely pushed.
+        PayloadNode* payload = nullptr;
+        while (!cached_payloads_.try_pop(payload))
+        {
+            if (!free_payloads_.empty())
+            {
+                payload = free_payloads_.back();
+                free_payloads_.pop_back();
+                break;
+            }
+
+            if (0u == cached_payloads_.size())
+            {
+                logError(RTPS_HISTORY, "Cannot shrink the pool to " << max_num_payloads
+                                                                   << " payloads, as more of them are still in use");
+                return false;
+            }
+
+            std::this_thread::yield();
+        }
 
         // Find data in allPayloads, remove element, then delete it
         all_payloads_.at(payload->data_index()) = all_payloads_.back();
@@ -278,14 +319,15 @@ bool TopicPayloadPool::shrink (
 }
 
 std::unique_ptr<ITopicPayloadPool> TopicPayloadPool::get(
-        const BasicPoolConfig& config)
+        const BasicPoolConfig& config,
+        int32_t numa_node)
 {
     if (config.payload_initial_size == 0u)
     {
         return nullptr;
     }
 
-    ITopicPayloadPool* ret_val = nullptr;
+    TopicPayloadPool* ret_val = nullptr;
 
     switch (config.memory_policy)
     {
@@ -303,6 +345,11 @@ std::unique_ptr<ITopicPayloadPool> TopicPayloadPool::get(
             break;
     }
 
+    if (ret_val != nullptr)
+    {
+        ret_val->numa_node_ = numa_node;
+    }
+
     return std::unique_ptr<ITopicPayloadPool>(ret_val);
 }
 
@@ -25,6 +25,8 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <rtps/history/PoolConfig.h>
 #include <rtps/history/ITopicPayloadPool.h>
+#include <utils/collections/LockFreeBoundedQueue.hpp>
+#include <utils/numa.hpp>
 
 #include <atomic>
 #include <cstddef>
@@ -124,11 +126,20 @@ public:
 
     size_t payload_pool_available_size() const override
     {
-        return free_payloads_.size();
+        return free_payloads_.size() + cached_payloads_.size();
     }
 
+    /**
+     * @brief Create a pool for the given configuration.
+     *
+     * @param [in]  config     The pool configuration.
+     * @param [in]  numa_node  NUMA node where the payloads are placed, or unknown_numa_node to leave them
+     *                         wherever the thread allocating them runs. Payloads of pools placed on a node take
+     *                         whole pages, so they can be placed no matter their size.
+     */
     static std::unique_ptr<ITopicPayloadPool> get(
-            const BasicPoolConfig& config);
+            const BasicPoolConfig& config,
+            int32_t numa_node = unknown_numa_node);
 
 protected:
 
@@ -136,12 +147,18 @@ protected:
     {
     public:
 
+        /**
+         * @param size Size of the payload data.
+         * @param page_aligned Whether the buffer should be made of whole pages, so it can be placed on a NUMA node.
+         */
         explicit PayloadNode(
-                uint32_t size)
+                uint32_t size,
+                bool page_aligned = false)
+            : page_aligned_(page_aligned)
         {
             assert(size > 0);
 
-            buffer = (octet*)calloc(size + offsetof(NodeInfo, data), sizeof(octet));
+            buffer = allocate_buffer(size + offsetof(NodeInfo, data));
             if (buffer == nullptr)
             {
                 throw std::bad_alloc();
@@ -150,12 +167,13 @@ protected:
             // The atomic may need some initialization depending on the platform
             new (buffer) NodeInfo();
             data_size(size);
+            info().node = this;
         }
 
         ~PayloadNode()
         {
             info().~NodeInfo();
-            free(buffer);
+            free_buffer(buffer);
         }
 
         bool resize (
@@ -163,6 +181,27 @@ protected:
         {
             assert(size > data_size());
 
+            if (page_aligned_)
+            {
+                // The data fits on the pages already allocated
+                if (round_up_to_page_size(data_size() + data_offset) >= size + data_offset)
+                {
+                    data_size(size);
+                    return true;
+                }
+
+                octet* new_buffer = allocate_buffer(size + data_offset);
+                if (!new_buffer)
+                {
+                    return false;
+                }
+                memcpy(new_buffer, buffer, data_size() + data_offset);
+                free_buffer(buffer);
+                buffer = new_buffer;
+                data_size(size);
+                return true;
+            }
+
             octet* old_buffer = buffer;
             buffer = (octet*)realloc(buffer, size + data_offset);
             if (!buffer)
@@ -203,6 +242,12 @@ protected:
             return info(data).data_index;
         }
 
+        static PayloadNode* node(
+                octet* data)
+        {
+            return info(data).node;
+        }
+
         void data_index(
                 uint32_t index)
         {
@@ -214,6 +259,13 @@ protected:
             return info().data;
         }
 
+        bool bind_to_numa_node(
+                int32_t numa_node)
+        {
+            size_t size = data_size() + data_offset;
+            return bind_memory_to_numa_node(buffer, page_aligned_ ? round_up_to_page_size(size) : size, numa_node);
+        }
+
         void reference()
         {
             info().ref_counter.fetch_add(1, std::memory_order_relaxed);
@@ -243,14 +295,38 @@ protected:
             std::atomic<uint32_t> ref_counter{ 0 };
             uint32_t data_size = 0;
             uint32_t data_index = 0;
+            PayloadNode* node = nullptr;
             octet data[1];
         };
 
         octet* buffer = nullptr;
 
+        bool page_aligned_ = false;
+
         // Payload data comes after the metadata
         static constexpr size_t data_offset = offsetof(NodeInfo, data);
 
+        octet* allocate_buffer(
+                size_t size) const
+        {
+            return page_aligned_ ?
+                   static_cast<octet*>(allocate_page_aligned_memory(size)) :
+                   static_cast<octet*>(calloc(size, sizeof(octet)));
+        }
+
+        void free_buffer(
+                octet* old_buffer) const
+        {
+            if (page_aligned_)
+            {
+                free_page_aligned_memory(old_buffer);
+            }
+            else
+            {
+                free(old_buffer);
+            }
+        }
+
         NodeInfo& info() const
         {
             return *reinterpret_cast<NodeInfo*>(buffer);
@@ -280,6 +356,12 @@ protected:
     PayloadNode* do_allocate(
             uint32_t size);
 
+    /**
+     * Moves the memory of a payload to the NUMA node of the pool, if it has one.
+     */
+    void place_payload(
+            PayloadNode* payload);
+
     virtual void update_maximum_size(
             const PoolConfig& config,
             bool is_reserve);
@@ -341,15 +423,30 @@ protected:
             CacheChange_t& cache_change,
             bool resizeable);
 
+    /**
+     * Returns a payload no longer referenced to the pool.
+     *
+     * Does not take the mutex unless the cache of free payloads is full.
+     */
+    void return_payload_to_pool(
+            PayloadNode* payload);
+
     virtual MemoryManagementPolicy_t memory_policy() const = 0;
 
+    //! Number of free payloads that can be exchanged without taking the mutex
+    static constexpr size_t cached_payloads_capacity = 1024u;
+
     uint32_t max_pool_size_             = 0;  //< Maximum size of the pool
     uint32_t infinite_histories_count_  = 0;  //< Number of infinite histories reserved
     uint32_t finite_max_pool_size_      = 0;  //< Maximum size of the pool if no infinite histories were reserved
+    int32_t numa_node_                  = unknown_numa_node;  //< NUMA node where the payloads are placed
 
     std::vector<PayloadNode*> free_payloads_; //< Payloads that are free
     std::vector<PayloadNode*> all_payloads_;  //< All payloads
 
+    //! Payloads recently released, which are reused before the ones on free_payloads_
+    LockFreeBoundedQueue<PayloadNode*> cached_payloads_{cached_payloads_capacity};
+
     std::mutex mutex_;
 
 };
@@ -30,9 +30,10 @@ namespace rtps {
 
 std::shared_ptr<ITopicPayloadPool> TopicPayloadPoolRegistry::get(
         const std::string& topic_name,
-        const BasicPoolConfig& config)
+        const BasicPoolConfig& config,
+        int32_t numa_node)
 {
-    return detail::TopicPayloadPoolRegistry::instance().get(topic_name, config);
+    return detail::TopicPayloadPoolRegistry::instance().get(topic_name, config, numa_node);
 }
 
 void TopicPayloadPoolRegistry::release(
@@ -22,6 +22,7 @@
 #include <rtps/history/ITopicPayloadPool.h>
 
 #include <rtps/history/PoolConfig.h>
+#include <utils/numa.hpp>
 
 #include <memory>
 #include <string>
@@ -35,9 +36,18 @@ class TopicPayloadPoolRegistry
 
 public:
 
+    /**
+     * Get the pool shared by the endpoints of a topic with the same memory policy.
+     *
+     * @param topic_name Name of the topic.
+     * @param config Configuration of the pool.
+     * @param numa_node NUMA node where the payloads are placed. Endpoints on different nodes use different pools.
+     * @return The pool.
+     */
     static std::shared_ptr<ITopicPayloadPool> get(
             const std::string& topic_name,
-            const BasicPoolConfig& config);
+            const BasicPoolConfig& config,
+            int32_t numa_node = unknown_numa_node);
 
     static void release(
             std::shared_ptr<ITopicPayloadPool>& pool);
@@ -28,7 +28,7 @@ namespace rtps {
 namespace detail {
 
 /**
- * Proxy class that adds the topic name to a ITopicPayloadPool, so we can look-up
+ * Proxy class that adds the topic name and NUMA node to a ITopicPayloadPool, so we can look-up
  * the corresponding entry in the registry when releasing the pool.
  */
 class TopicPayloadPoolProxy : public ITopicPayloadPool
@@ -38,10 +38,12 @@ public:
 
     TopicPayloadPoolProxy(
             const std::string& topic_name,
-            const BasicPoolConfig& config)
+            const BasicPoolConfig& config,
+            int32_t numa_node)
         : topic_name_(topic_name)
         , policy_(config.memory_policy)
-        , inner_pool_(TopicPayloadPool::get(config))
+        , numa_node_(numa_node)
+        , inner_pool_(TopicPayloadPool::get(config, numa_node))
     {
     }
 
@@ -55,6 +57,11 @@ public:
         return policy_;
     }
 
+    int32_t numa_node() const
+    {
+        return numa_node_;
+    }
+
     bool get_payload(
             uint32_t size,
             CacheChange_t& cache_change) override
@@ -104,6 +111,7 @@ private:
 
     std::string topic_name_;
     MemoryManagementPolicy_t policy_;
+    int32_t numa_node_;
     std::unique_ptr<ITopicPayloadPool> inner_pool_;
 
 };
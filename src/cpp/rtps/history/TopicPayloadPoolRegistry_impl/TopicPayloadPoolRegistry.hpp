@@ -19,10 +19,11 @@
 #ifndef RTPS_HISTORY_TOPICPAYLOADPOOLREGISTRY_IMPL_TOPICPAYLOADPOOLREGISTRY_HPP
 #define RTPS_HISTORY_TOPICPAYLOADPOOLREGISTRY_IMPL_TOPICPAYLOADPOOLREGISTRY_HPP
 
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
-#include <unordered_map>
+#include <utility>
 
 namespace eprosima {
 namespace fastrtps {
@@ -48,26 +49,28 @@ public:
 
     std::shared_ptr<TopicPayloadPoolProxy> get(
             const std::string& topic_name,
-            const BasicPoolConfig& config)
+            const BasicPoolConfig& config,
+            int32_t numa_node)
     {
         std::lock_guard<std::mutex> lock(mutex_);
 
-        auto it = pool_map_.find(topic_name);
+        auto key = std::make_pair(topic_name, numa_node);
+        auto it = pool_map_.find(key);
         if (it == pool_map_.end())
         {
-            it = pool_map_.emplace(topic_name, TopicPayloadPoolRegistryEntry()).first;
+            it = pool_map_.emplace(key, TopicPayloadPoolRegistryEntry()).first;
         }
 
         switch (config.memory_policy)
         {
             case PREALLOCATED_MEMORY_MODE:
-                return do_get(it->second.pool_for_preallocated, topic_name, config);
+                return do_get(it->second.pool_for_preallocated, topic_name, config, numa_node);
             case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
-                return do_get(it->second.pool_for_preallocated_realloc, topic_name, config);
+                return do_get(it->second.pool_for_preallocated_realloc, topic_name, config, numa_node);
             case DYNAMIC_RESERVE_MEMORY_MODE:
-                return do_get(it->second.pool_for_dynamic, topic_name, config);
+                return do_get(it->second.pool_for_dynamic, topic_name, config, numa_node);
             case DYNAMIC_REUSABLE_MEMORY_MODE:
-                return do_get(it->second.pool_for_dynamic_reusable, topic_name, config);
+                return do_get(it->second.pool_for_dynamic_reusable, topic_name, config, numa_node);
         }
 
         return nullptr;
@@ -82,7 +85,7 @@ public:
         // This means we can release the pointer on the registry also.
         if (pool.use_count() == 2)
         {
-            auto it = pool_map_.find(pool->topic_name());
+            auto it = pool_map_.find(std::make_pair(pool->topic_name(), pool->numa_node()));
             assert(it != pool_map_.end());
             switch (pool->memory_policy())
             {
@@ -107,18 +110,20 @@ private:
     std::shared_ptr<TopicPayloadPoolProxy> do_get(
             std::shared_ptr<TopicPayloadPoolProxy>& ptr,
             const std::string& topic_name,
-            const BasicPoolConfig& config)
+            const BasicPoolConfig& config,
+            int32_t numa_node)
     {
         if (!ptr)
         {
-            ptr = std::make_shared<TopicPayloadPoolProxy>(topic_name, config);
+            ptr = std::make_shared<TopicPayloadPoolProxy>(topic_name, config, numa_node);
         }
 
         return ptr;
     }
 
     std::mutex mutex_;
-    std::unordered_map<std::string, TopicPayloadPoolRegistryEntry> pool_map_;
+    //! Topics can have a separate set of pools on each NUMA node
+    std::map<std::pair<std::string, int32_t>, TopicPayloadPoolRegistryEntry> pool_map_;
 
 };
 
@@ -132,6 +132,12 @@ ResourceEvent& RTPSParticipant::get_resource_event() const
     return mp_impl->getEventResource();
 }
 
+ResourceEvent& RTPSParticipant::get_resource_event(
+        const GUID_t& endpoint_guid) const
+{
+    return mp_impl->getEventResource(endpoint_guid);
+}
+
 WLP* RTPSParticipant::wlp() const
 {
     return mp_impl->wlp();
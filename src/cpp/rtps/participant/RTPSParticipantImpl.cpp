@@ -20,6 +20,7 @@
 #include <rtps/participant/RTPSParticipantImpl.h>
 
 #include <rtps/flowcontrol/ThroughputController.h>
+#include <rtps/flowcontrol/DestinationThroughputController.h>
 #include <rtps/persistence/PersistenceService.h>
 #include <rtps/history/BasicPayloadPool.hpp>
 
@@ -113,6 +114,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     , mp_builtinProtocols(nullptr)
     , mp_ResourceSemaphore(new Semaphore(0))
     , IdCounter(0)
+    , async_thread_(PParam.allocation.async_writer_threads, PParam.async_writers_thread)
     , type_check_fn_(nullptr)
 #if HAVE_SECURITY
     , m_security_manager(this)
@@ -129,6 +131,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
         UDPv4TransportDescriptor descriptor;
         descriptor.sendBufferSize = m_att.sendSocketBufferSize;
         descriptor.receiveBufferSize = m_att.listenSocketBufferSize;
+        descriptor.default_reception_threads = m_att.builtin_transports_reception_threads;
         m_network_Factory.RegisterTransport(&descriptor);
 
 #ifdef SHM_TRANSPORT_BUILTIN
@@ -140,6 +143,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
         shm_transport.segment_size(segment_size_udp_equivalent);
         // Use same default max_message_size on both UDP and SHM
         shm_transport.max_message_size(descriptor.max_message_size());
+        shm_transport.default_reception_threads = m_att.builtin_transports_reception_threads;
         has_shm_transport_ |= m_network_Factory.RegisterTransport(&shm_transport);
 #endif // ifdef SHM_TRANSPORT_BUILTIN
     }
@@ -199,13 +203,30 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     }
 
     mp_userParticipant->mp_impl = this;
-    mp_event_thr.init_thread();
+    mp_event_thr.init_thread(m_att.timed_events_thread);
+    for (size_t i = 1; i < m_att.allocation.event_threads.count; ++i)
+    {
+        endpoint_event_thr_.emplace_back(new ResourceEvent());
+        endpoint_event_thr_.back()->init_thread(m_att.timed_events_thread);
+    }
+    endpoint_event_mapping_.reset(new EndpointThreadMapping(endpoint_event_thr_.size() + 1u,
+            m_att.allocation.event_threads.isolate_builtin_endpoints));
 
     if (!networkFactoryHasRegisteredTransports())
     {
         return;
     }
 
+    // Per destination throughput controller, if the descriptor has valid values.
+    // It goes first, so the global controller only accounts for the data that will actually be sent.
+    if (PParam.destination_throughput_controller.bytesPerPeriod != UINT32_MAX &&
+            PParam.destination_throughput_controller.periodMillisecs != 0)
+    {
+        std::unique_ptr<FlowController> controller(new DestinationThroughputController(
+                    PParam.destination_throughput_controller, this));
+        m_controllers.push_back(std::move(controller));
+    }
+
     // Throughput controller, if the descriptor has valid values
     if (PParam.throughputController.bytesPerPeriod != UINT32_MAX && PParam.throughputController.periodMillisecs != 0)
     {
@@ -448,6 +469,13 @@ RTPSParticipantImpl::~RTPSParticipantImpl()
     delete mp_mutex;
 }
 
+ResourceEvent& RTPSParticipantImpl::getEventResource(
+        const GUID_t& endpoint_guid)
+{
+    size_t index = endpoint_event_mapping_->thread_for(endpoint_guid);
+    return (0u == index) ? mp_event_thr : *endpoint_event_thr_[index - 1u];
+}
+
 template <EndpointKind_t kind, octet no_key, octet with_key>
 bool RTPSParticipantImpl::preprocess_endpoint_attributes(
         const char* debug_label,
@@ -546,8 +574,7 @@ bool RTPSParticipantImpl::create_writer(
         return false;
     }
     if (((param.throughputController.bytesPerPeriod != UINT32_MAX && param.throughputController.periodMillisecs != 0) ||
-            (m_att.throughputController.bytesPerPeriod != UINT32_MAX &&
-            m_att.throughputController.periodMillisecs != 0))
+            !m_controllers.empty())
             && param.mode != ASYNCHRONOUS_WRITER)
     {
         logError(RTPS_PARTICIPANT,
@@ -632,6 +659,11 @@ bool RTPSParticipantImpl::create_writer(
     }
     *writer_out = SWriter;
 
+    for (std::unique_ptr<FlowController>& controller : m_controllers)
+    {
+        controller->register_writer(SWriter, param);
+    }
+
     // If the terminal throughput controller has proper user defined values, instantiate it
     if (param.throughputController.bytesPerPeriod != UINT32_MAX && param.throughputController.periodMillisecs != 0)
     {
@@ -1315,7 +1347,9 @@ bool RTPSParticipantImpl::deleteUserEndpoint(
         }
     }
     //	std::lock_guard<std::recursive_mutex> guardEndpoint(*p_endpoint->getMutex());
+    GUID_t endpoint_guid = p_endpoint->getGuid();
     delete(p_endpoint);
+    endpoint_event_mapping_->release(endpoint_guid);
     return true;
 }
 
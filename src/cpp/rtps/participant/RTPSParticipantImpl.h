@@ -26,6 +26,8 @@
 #include <mutex>
 #include <atomic>
 #include <chrono>
+#include <memory>
+#include <vector>
 #include <fastrtps/utils/Semaphore.h>
 
 #if defined(_WIN32)
@@ -49,6 +51,7 @@
 
 #include "../messages/RTPSMessageGroup_t.hpp"
 #include "../messages/SendBuffersManager.hpp"
+#include "../resources/EndpointThreadMapping.hpp"
 
 #if HAVE_SECURITY
 #include <fastdds/rtps/Endpoint.h>
@@ -246,6 +249,14 @@ public:
         return mp_event_thr;
     }
 
+    /**
+     * Get the Event Resource processing the timed events of an endpoint.
+     * @param endpoint_guid GUID of the endpoint.
+     * @return Reference to the Event Resource assigned to the endpoint.
+     */
+    ResourceEvent& getEventResource(
+            const GUID_t& endpoint_guid);
+
     /**
      * Send a message to several locations
      * @param msg Message to send.
@@ -459,6 +470,10 @@ private:
     // ResourceSend* mp_send_thr;
     //! Event Resource
     ResourceEvent mp_event_thr;
+    //! Additional Event Resources for the events of endpoints
+    std::vector<std::unique_ptr<ResourceEvent>> endpoint_event_thr_;
+    //! Event Resource of each endpoint, being 0 mp_event_thr and the rest the ones on endpoint_event_thr_
+    std::unique_ptr<EndpointThreadMapping> endpoint_event_mapping_;
     //! BuiltinProtocols of this RTPSParticipant
     BuiltinProtocols* mp_builtinProtocols;
     //!Semaphore to wait for the listen thread creation.
@@ -0,0 +1,280 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IntraprocessDeliveryQueue.cpp
+ */
+
+#include <rtps/reader/IntraprocessDeliveryQueue.hpp>
+
+#include <fastdds/rtps/history/IPayloadPool.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <utils/threading.hpp>
+
+#include <algorithm>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+IntraprocessDeliveryQueue::IntraprocessDeliveryQueue(
+        RTPSReader* reader,
+        uint32_t capacity)
+    : reader_(reader)
+    , pending_messages_(capacity)
+    , free_messages_(capacity)
+    , messages_(new Message[pending_messages_.capacity()])
+    , processed_messages_(0)
+    , running_(true)
+    , sleeping_(false)
+    , refused_messages_(0)
+{
+    for (size_t i = 0; i < pending_messages_.capacity(); ++i)
+    {
+        free_messages_.try_push(&messages_[i]);
+    }
+
+    thread_ = std::thread(&IntraprocessDeliveryQueue::run, this);
+}
+
+IntraprocessDeliveryQueue::~IntraprocessDeliveryQueue()
+{
+    stop();
+
+    // Release the payloads of the messages not processed
+    for (size_t i = 0; i < pending_messages_.capacity(); ++i)
+    {
+        discard(messages_[i]);
+    }
+}
+
+void IntraprocessDeliveryQueue::stop()
+{
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        running_.store(false);
+        cv_.notify_one();
+    }
+
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+bool IntraprocessDeliveryQueue::push_data(
+        CacheChange_t* change)
+{
+    Message* message = acquire_message();
+    if (nullptr == message)
+    {
+        return false;
+    }
+
+    // The payload is shared with the writer when both use the same pool
+    message->change.copy_not_memcpy(change);
+    IPayloadPool* payload_owner = change->payload_owner();
+    if (nullptr == payload_owner ||
+            !payload_owner->get_payload(change->serializedPayload, payload_owner, message->change))
+    {
+        free_messages_.try_push(message);
+        return false;
+    }
+
+    message->kind = Kind::DATA;
+    publish_message(message);
+    return true;
+}
+
+bool IntraprocessDeliveryQueue::push_gap(
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& gap_start,
+        const SequenceNumber_t& gap_end)
+{
+    Message* message = acquire_message();
+    if (nullptr == message)
+    {
+        return false;
+    }
+
+    message->kind = Kind::GAP;
+    message->writer_guid = writer_guid;
+    message->first_sn = gap_start;
+    message->last_sn = gap_end;
+    publish_message(message);
+    return true;
+}
+
+bool IntraprocessDeliveryQueue::push_heartbeat(
+        const GUID_t& writer_guid,
+        uint32_t count,
+        const SequenceNumber_t& first_sn,
+        const SequenceNumber_t& last_sn,
+        bool liveliness)
+{
+    Message* message = acquire_message();
+    if (nullptr == message)
+    {
+        return false;
+    }
+
+    message->kind = Kind::HEARTBEAT;
+    message->writer_guid = writer_guid;
+    message->count = count;
+    message->first_sn = first_sn;
+    message->last_sn = last_sn;
+    message->liveliness = liveliness;
+    publish_message(message);
+    return true;
+}
+
+IntraprocessDeliveryQueue::Message* IntraprocessDeliveryQueue::acquire_message()
+{
+    if (!running_.load(std::memory_order_relaxed))
+    {
+        return nullptr;
+    }
+
+    Message* message = nullptr;
+    if (!free_messages_.try_pop(message))
+    {
+        // The delivery thread has not processed the messages already queued
+        refused_messages_.fetch_add(1u, std::memory_order_relaxed);
+        return nullptr;
+    }
+    return message;
+}
+
+void IntraprocessDeliveryQueue::publish_message(
+        Message* message)
+{
+    // Never full, as there are as many messages as room on the queue
+    pending_messages_.try_push(message);
+
+    // Pairs with the fence of the delivery thread before checking the queue and going to sleep
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleeping_.load(std::memory_order_relaxed) && sleeping_.exchange(false))
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        cv_.notify_one();
+    }
+}
+
+bool IntraprocessDeliveryQueue::pop_and_process()
+{
+    Message* message = nullptr;
+    if (!pending_messages_.try_pop(message))
+    {
+        return false;
+    }
+
+    process(*message);
+    free_messages_.try_push(message);
+    return true;
+}
+
+void IntraprocessDeliveryQueue::process(
+        Message& message)
+{
+    const GUID_t& writer_guid = (Kind::DATA == message.kind) ? message.change.writerGUID : message.writer_guid;
+    if (Kind::NONE != message.kind &&
+            std::find(processed_writers_.begin(), processed_writers_.end(), writer_guid) == processed_writers_.end())
+    {
+        processed_writers_.push_back(writer_guid);
+    }
+
+    switch (message.kind)
+    {
+        case Kind::DATA:
+            reader_->processDataMsg(&message.change);
+            break;
+
+        case Kind::GAP:
+            reader_->processGapMsg(message.writer_guid, message.first_sn, SequenceNumberSet_t(message.last_sn));
+            break;
+
+        case Kind::HEARTBEAT:
+            reader_->processHeartbeatMsg(message.writer_guid, message.count, message.first_sn, message.last_sn,
+                    true, message.liveliness);
+            break;
+
+        case Kind::NONE:
+        default:
+            break;
+    }
+
+    discard(message);
+}
+
+void IntraprocessDeliveryQueue::discard(
+        Message& message)
+{
+    IPayloadPool* payload_owner = message.change.payload_owner();
+    if (nullptr != payload_owner)
+    {
+        payload_owner->release_payload(message.change);
+    }
+    message.kind = Kind::NONE;
+}
+
+void IntraprocessDeliveryQueue::report_processed_writers()
+{
+    for (const GUID_t& writer_guid : processed_writers_)
+    {
+        reader_->intraprocess_messages_processed(writer_guid);
+    }
+    processed_writers_.clear();
+    processed_messages_ = 0;
+}
+
+void IntraprocessDeliveryQueue::run()
+{
+    apply_thread_settings_to_current_thread("intraprocess delivery", fastdds::rtps::ThreadSettings());
+
+    while (running_.load())
+    {
+        if (pop_and_process())
+        {
+            // Do not delay acknowledgements forever when the writers keep the queue busy
+            if (++processed_messages_ >= pending_messages_.capacity())
+            {
+                report_processed_writers();
+            }
+            continue;
+        }
+
+        report_processed_writers();
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        sleeping_.store(true);
+
+        // Pairs with the fence of the writers after publishing a message
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (0u != pending_messages_.size())
+        {
+            sleeping_.store(false);
+            continue;
+        }
+
+        cv_.wait(lock, [this]()
+                {
+                    return !sleeping_.load() || !running_.load();
+                });
+        sleeping_.store(false);
+    }
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
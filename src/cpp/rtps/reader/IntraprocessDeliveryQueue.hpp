@@ -0,0 +1,189 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file IntraprocessDeliveryQueue.hpp
+ */
+
+#ifndef RTPS_READER_INTRAPROCESSDELIVERYQUEUE_HPP
+#define RTPS_READER_INTRAPROCESSDELIVERYQUEUE_HPP
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+
+#include <utils/collections/LockFreeBoundedQueue.hpp>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class RTPSReader;
+
+/**
+ * Delivers the messages of writers on the same process to a reader on a thread of its own.
+ *
+ * Writers push DATA, GAP and HEARTBEAT messages on a bounded lock-free queue, and never take the mutex of the
+ * reader, so a reader with a slow listener does not stall the thread publishing the data. Messages are
+ * preallocated, and are taken from a lock-free queue of free ones before being filled. Changes are not
+ * serialized again: the queue keeps a copy of their metadata sharing the payload of the writer, when its payload
+ * pool allows it.
+ *
+ * Messages are processed by the reader in the order they were pushed by each writer. Once the queue is drained,
+ * or after processing as many messages as its capacity, the reader is told which writers had messages processed,
+ * so it can acknowledge them. Changes queued are only acknowledged at that point.
+ */
+class IntraprocessDeliveryQueue
+{
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param reader Reader receiving the messages.
+     * @param capacity Maximum number of messages waiting to be processed. Rounded up to a power of two.
+     */
+    IntraprocessDeliveryQueue(
+            RTPSReader* reader,
+            uint32_t capacity);
+
+    /**
+     * Destructor. Stops the delivery thread and discards the messages not processed.
+     */
+    ~IntraprocessDeliveryQueue();
+
+    /**
+     * Stops the delivery thread. Messages pushed afterwards are refused.
+     *
+     * Should be called before the reader starts being destroyed.
+     */
+    void stop();
+
+    /**
+     * Push a DATA message.
+     *
+     * @param change Change to deliver. It is not accessed after this call returns.
+     * @return true when the change was queued, false when the queue is full or the payload could not be shared.
+     */
+    bool push_data(
+            CacheChange_t* change);
+
+    /**
+     * Push a GAP message covering sequence numbers [gap_start, gap_end).
+     *
+     * @return true when the message was queued, false when the queue is full.
+     */
+    bool push_gap(
+            const GUID_t& writer_guid,
+            const SequenceNumber_t& gap_start,
+            const SequenceNumber_t& gap_end);
+
+    /**
+     * Push a HEARTBEAT message.
+     *
+     * @return true when the message was queued, false when the queue is full.
+     */
+    bool push_heartbeat(
+            const GUID_t& writer_guid,
+            uint32_t count,
+            const SequenceNumber_t& first_sn,
+            const SequenceNumber_t& last_sn,
+            bool liveliness);
+
+    //! @return Maximum number of messages waiting to be processed.
+    uint32_t capacity() const
+    {
+        return static_cast<uint32_t>(pending_messages_.capacity());
+    }
+
+    //! @return Number of messages refused because the queue was full.
+    uint64_t refused_messages() const
+    {
+        return refused_messages_.load(std::memory_order_relaxed);
+    }
+
+private:
+
+    enum class Kind : uint8_t
+    {
+        NONE,
+        DATA,
+        GAP,
+        HEARTBEAT
+    };
+
+    struct Message
+    {
+        Kind kind = Kind::NONE;
+        CacheChange_t change;
+        GUID_t writer_guid;
+        SequenceNumber_t first_sn;
+        SequenceNumber_t last_sn;
+        uint32_t count = 0;
+        bool liveliness = false;
+    };
+
+    Message* acquire_message();
+
+    void publish_message(
+            Message* message);
+
+    bool pop_and_process();
+
+    void process(
+            Message& message);
+
+    void discard(
+            Message& message);
+
+    void report_processed_writers();
+
+    void run();
+
+    RTPSReader* reader_;
+
+    //! Messages pushed by the writers, in order
+    LockFreeBoundedQueue<Message*> pending_messages_;
+    //! Messages ready to be filled by the writers
+    LockFreeBoundedQueue<Message*> free_messages_;
+    //! Storage of all the messages, as many as the capacity of the queues
+    std::unique_ptr<Message[]> messages_;
+
+    //! Writers with messages processed since the last report to the reader. Only used by the delivery thread.
+    std::vector<GUID_t> processed_writers_;
+    //! Messages processed since the last report to the reader. Only used by the delivery thread.
+    size_t processed_messages_;
+
+    std::atomic<bool> running_;
+    std::atomic<bool> sleeping_;
+    std::atomic<uint64_t> refused_messages_;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif  // RTPS_READER_INTRAPROCESSDELIVERYQUEUE_HPP
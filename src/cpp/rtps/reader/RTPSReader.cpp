@@ -21,6 +21,7 @@
 
 #include <fastdds/dds/log/Log.hpp>
 
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/history/ReaderHistory.h>
 #include <fastdds/rtps/reader/ReaderListener.h>
 #include <fastdds/rtps/resources/ResourceEvent.h>
@@ -28,6 +29,7 @@
 #include <rtps/history/BasicPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
 #include <rtps/participant/RTPSParticipantImpl.h>
+#include <rtps/reader/IntraprocessDeliveryQueue.hpp>
 #include <rtps/reader/ReaderHistoryState.hpp>
 
 #include <foonathan/memory/namespace_alias.hpp>
@@ -35,6 +37,7 @@
 #include <typeinfo>
 #include <algorithm>
 #include <chrono>
+#include <cstdlib>
 
 namespace eprosima {
 namespace fastrtps {
@@ -61,7 +64,7 @@ RTPSReader::RTPSReader(
     std::shared_ptr<IPayloadPool> payload_pool;
     payload_pool = BasicPayloadPool::get(cfg, change_pool);
 
-    init(payload_pool, change_pool);
+    init(payload_pool, change_pool, att);
 }
 
 RTPSReader::RTPSReader(
@@ -96,12 +99,13 @@ RTPSReader::RTPSReader(
     , liveliness_kind_(att.liveliness_kind_)
     , liveliness_lease_duration_(att.liveliness_lease_duration)
 {
-    init(payload_pool, change_pool);
+    init(payload_pool, change_pool, att);
 }
 
 void RTPSReader::init(
         const std::shared_ptr<IPayloadPool>& payload_pool,
-        const std::shared_ptr<IChangePool>& change_pool)
+        const std::shared_ptr<IChangePool>& change_pool,
+        const ReaderAttributes& att)
 {
     payload_pool_ = payload_pool;
     change_pool_ = change_pool;
@@ -114,9 +118,29 @@ void RTPSReader::init(
     mp_history->mp_reader = this;
     mp_history->mp_mutex = &mp_mutex;
 
+    // Messages from writers on the same process are processed on a thread of their own when a queue is configured
+    const std::string* queue_size = PropertyPolicyHelper::find_property(att.endpoint.properties,
+                    "fastdds.intraprocess_queue.size");
+    if (queue_size != nullptr)
+    {
+        uint32_t capacity = static_cast<uint32_t>(std::strtoul(queue_size->c_str(), nullptr, 10));
+        if (capacity > 0)
+        {
+            intraprocess_queue_.reset(new IntraprocessDeliveryQueue(this, capacity));
+        }
+    }
+
     logInfo(RTPS_READER, "RTPSReader created correctly");
 }
 
+void RTPSReader::stop_intraprocess_delivery()
+{
+    if (intraprocess_queue_)
+    {
+        intraprocess_queue_->stop();
+    }
+}
+
 RTPSReader::~RTPSReader()
 {
     logInfo(RTPS_READER, "Removing reader " << this->getGuid().entityId; );
@@ -86,6 +86,7 @@ void StatefulPersistentReader::init(
 
 StatefulPersistentReader::~StatefulPersistentReader()
 {
+    stop_intraprocess_delivery();
     delete persistence_;
 }
 
@@ -45,6 +45,7 @@ using namespace eprosima::fastrtps::rtps;
 StatefulReader::~StatefulReader()
 {
     logInfo(RTPS_READER, "StatefulReader destructor.");
+    stop_intraprocess_delivery();
 
     // Only is_alive_ assignment needs to be protected, as
     // matched_writers_ and matched_writers_pool_ are only used
@@ -641,6 +642,39 @@ bool StatefulReader::processGapMsg(
     return false;
 }
 
+void StatefulReader::intraprocess_messages_processed(
+        const GUID_t& writer_guid)
+{
+    std::unique_lock<RecursiveTimedMutex> lock(mp_mutex);
+
+    WriterProxy* writer = nullptr;
+    if (!is_alive_ || !findWriterProxy(writer_guid, &writer) || !writer->is_on_same_process())
+    {
+        return;
+    }
+
+    // Changes received are positively acknowledged, and the missing ones are requested again
+    SequenceNumberSet_t sns(writer->available_changes_max() + 1);
+    writer->missing_changes().for_each(
+        [&sns](const SequenceNumber_t& seq)
+        {
+            sns.add(seq);
+        });
+
+    uint32_t acknack_count = ++acknack_count_;
+    GUID_t reader_guid = m_guid;
+
+    // Avoid deadlocks with writers calling the reader
+    lock.unlock();
+
+    RTPSWriter* writer_ptr = RTPSDomainImpl::find_local_writer(writer_guid);
+    if (writer_ptr)
+    {
+        bool result;
+        writer_ptr->process_acknack(writer_guid, reader_guid, acknack_count, sns, true, result);
+    }
+}
+
 bool StatefulReader::acceptMsgFrom(
         const GUID_t& writerId,
         WriterProxy** wp) const
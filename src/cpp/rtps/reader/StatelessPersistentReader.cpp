@@ -86,6 +86,7 @@ void StatelessPersistentReader::init(
 
 StatelessPersistentReader::~StatelessPersistentReader()
 {
+    stop_intraprocess_delivery();
     delete persistence_;
 }
 
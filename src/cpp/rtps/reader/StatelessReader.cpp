@@ -39,6 +39,7 @@ using namespace eprosima::fastrtps::rtps;
 StatelessReader::~StatelessReader()
 {
     logInfo(RTPS_READER, "Removing reader " << m_guid);
+    stop_intraprocess_delivery();
 }
 
 StatelessReader::StatelessReader(
@@ -89,7 +89,7 @@ WriterProxy::WriterProxy(
     , locators_entry_(loc_alloc.max_unicast_locators, loc_alloc.max_multicast_locators)
 {
     //Create Events
-    ResourceEvent& event_manager = reader_->getRTPSParticipant()->getEventResource();
+    ResourceEvent& event_manager = reader_->getRTPSParticipant()->getEventResource(reader_->getGuid());
     auto heartbeat_lambda = [this]() -> bool
             {
                 perform_heartbeat_response();
@@ -14,28 +14,91 @@
 
 #include <fastdds/rtps/resources/AsyncWriterThread.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
+#include <rtps/resources/EndpointThreadMapping.hpp>
+#include <utils/threading.hpp>
 
+#include <atomic>
+#include <condition_variable>
 #include <mutex>
-#include <algorithm>
-#include <cassert>
-#include <stdexcept>
+#include <thread>
 
 using namespace eprosima::fastrtps::rtps;
 
+struct AsyncWriterThread::Worker
+{
+    //! List of asynchronous writers.
+    AsyncInterestTree interest_tree;
+
+    //! Protects the creation of the thread and its sleeping state.
+    std::mutex mutex;
+    std::condition_variable cv;
+    eprosima::fastrtps::Thread thread;
+
+    std::atomic<bool> started{false};
+    std::atomic<bool> running{true};
+    std::atomic<bool> run_scheduled{false};
+    std::atomic<bool> sleeping{false};
+
+    std::atomic<uint32_t> last_queue_depth{0};
+    std::atomic<uint32_t> max_queue_depth{0};
+    std::atomic<uint64_t> processed_writers{0};
+};
+
+AsyncWriterThread::AsyncWriterThread(
+        const AsyncWriterThreadsAllocationAttributes& allocation,
+        const fastdds::rtps::ThreadSettings& thread_settings)
+    : thread_settings_(thread_settings)
+{
+    size_t count = allocation.count > 0u ? allocation.count : 1u;
+    workers_.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        workers_.emplace_back(new Worker());
+    }
+    mapping_.reset(new EndpointThreadMapping(count, allocation.isolate_builtin_endpoints));
+}
+
 AsyncWriterThread::~AsyncWriterThread()
 {
-    std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_);
-    running_ = false;
-    run_scheduled_ = false;
-    cv_.notify_all();
-    if (thread_)
+    for (auto& worker : workers_)
+    {
+        {
+            std::lock_guard<std::mutex> guard(worker->mutex);
+            worker->running = false;
+            worker->cv.notify_all();
+        }
+
+        if (worker->thread.joinable())
+        {
+            worker->thread.join();
+        }
+    }
+}
+
+AsyncWriterThread::ThreadStatistics AsyncWriterThread::get_statistics(
+        size_t thread_index) const
+{
+    ThreadStatistics ret;
+    if (thread_index < workers_.size())
     {
-        lock.unlock();
-        thread_->join();
-        lock.lock();
-        delete thread_;
-        thread_ = nullptr;
+        const Worker& worker = *workers_[thread_index];
+        ret.last_queue_depth = worker.last_queue_depth.load(std::memory_order_relaxed);
+        ret.max_queue_depth = worker.max_queue_depth.load(std::memory_order_relaxed);
+        ret.processed_writers = worker.processed_writers.load(std::memory_order_relaxed);
     }
+    return ret;
+}
+
+size_t AsyncWriterThread::thread_of(
+        const RTPSWriter* writer)
+{
+    return mapping_->thread_for(writer->getGuid());
+}
+
+AsyncWriterThread::Worker& AsyncWriterThread::worker_for(
+        const RTPSWriter* writer)
+{
+    return *workers_[thread_of(writer)];
 }
 
 /*!
@@ -43,42 +106,22 @@ AsyncWriterThread::~AsyncWriterThread()
  * @param writer Asynchronous writer to be removed.
  * @return Result of the operation.
  */
-void AsyncWriterThread::unregister_writer(RTPSWriter* writer)
+void AsyncWriterThread::unregister_writer(
+        RTPSWriter* writer)
 {
-    if(interestTree_.unregister_interest(writer))
-    {
-        std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_);
-        running_ = false;
-        run_scheduled_ = false;
-        cv_.notify_all();
-        if (thread_)
-        {
-            lock.unlock();
-            thread_->join();
-            lock.lock();
-            delete thread_;
-            thread_ = nullptr;
-        }
-    }
+    // The active queue is locked while its writers are being processed, so the writer is not in use when this
+    // returns, and the thread can be kept alive for the rest of writers.
+    worker_for(writer).interest_tree.unregister_interest(writer);
+    mapping_->release(writer->getGuid());
 }
 
 void AsyncWriterThread::wake_up(
         RTPSWriter* interested_writer)
 {
-    if (interestTree_.register_interest(interested_writer))
+    Worker& worker = worker_for(interested_writer);
+    if (worker.interest_tree.register_interest(interested_writer))
     {
-        std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_);
-        run_scheduled_ = true;
-        // If thread not running, start it.
-        if (thread_ == nullptr)
-        {
-            running_ = true;
-            thread_ = new std::thread(&AsyncWriterThread::run, this);
-        }
-        else
-        {
-            cv_.notify_all();
-        }
+        wake_up(worker);
     }
 }
 
@@ -86,53 +129,81 @@ void AsyncWriterThread::wake_up(
         RTPSWriter* interested_writer,
         const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
 {
-    if (interestTree_.register_interest(interested_writer, max_blocking_time))
+    Worker& worker = worker_for(interested_writer);
+    if (worker.interest_tree.register_interest(interested_writer, max_blocking_time))
     {
-        std::unique_lock<RecursiveTimedMutex> lock(condition_variable_mutex_, std::defer_lock);
+        wake_up(worker);
+    }
+}
+
+void AsyncWriterThread::wake_up(
+        Worker& worker)
+{
+    worker.run_scheduled = true;
 
-        if (lock.try_lock_until(max_blocking_time))
+    // If thread not running, start it.
+    if (!worker.started.load(std::memory_order_acquire))
+    {
+        std::lock_guard<std::mutex> guard(worker.mutex);
+        if (!worker.started.load(std::memory_order_relaxed) && worker.running)
         {
-            run_scheduled_ = true;
-            // If thread not running, start it.
-            if (thread_ == nullptr)
-            {
-                running_ = true;
-                thread_ = new std::thread(&AsyncWriterThread::run, this);
-            }
-            else
-            {
-                cv_.notify_all();
-            }
+            Worker* worker_ptr = &worker;
+            worker.thread = eprosima::create_thread([this, worker_ptr]()
+                            {
+                                run(*worker_ptr);
+                            }, thread_settings_, "async writers");
+            worker.started.store(true, std::memory_order_release);
         }
+        return;
+    }
+
+    // The mutex is only taken when the thread is waiting. Otherwise it will see run_scheduled before going to
+    // sleep, as both flags are sequentially consistent.
+    if (worker.sleeping)
+    {
+        std::lock_guard<std::mutex> guard(worker.mutex);
+        worker.cv.notify_one();
     }
 }
 
-void AsyncWriterThread::run()
+void AsyncWriterThread::run(
+        Worker& worker)
 {
-    std::unique_lock<RecursiveTimedMutex> cond_guard(condition_variable_mutex_);
-    while(running_)
+    AsyncInterestTree& interest_tree = worker.interest_tree;
+    while (worker.running)
     {
-        if(run_scheduled_)
+        if (worker.run_scheduled.exchange(false))
         {
-            run_scheduled_ = false;
-            cond_guard.unlock();
-            interestTree_.swap();
+            interest_tree.swap();
 
-            interestTree_.mMutexActive.lock();
-            RTPSWriter* curr = interestTree_.next_active_nts();
+            uint32_t queue_depth = 0;
+            interest_tree.mMutexActive.lock();
+            RTPSWriter* curr = interest_tree.next_active_nts();
 
             while (curr)
             {
+                ++queue_depth;
                 curr->send_any_unsent_changes();
-                curr = interestTree_.next_active_nts();
+                curr = interest_tree.next_active_nts();
             }
-            interestTree_.mMutexActive.unlock();
+            interest_tree.mMutexActive.unlock();
 
-            cond_guard.lock();
+            worker.last_queue_depth.store(queue_depth, std::memory_order_relaxed);
+            if (queue_depth > worker.max_queue_depth.load(std::memory_order_relaxed))
+            {
+                worker.max_queue_depth.store(queue_depth, std::memory_order_relaxed);
+            }
+            worker.processed_writers.fetch_add(queue_depth, std::memory_order_relaxed);
         }
         else
         {
-            cv_.wait(cond_guard);
+            std::unique_lock<std::mutex> guard(worker.mutex);
+            worker.sleeping = true;
+            while (worker.running && !worker.run_scheduled)
+            {
+                worker.cv.wait(guard);
+            }
+            worker.sleeping = false;
         }
     }
 }
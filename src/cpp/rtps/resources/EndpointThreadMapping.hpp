@@ -0,0 +1,145 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file EndpointThreadMapping.hpp
+ */
+
+#ifndef RTPS_RESOURCES_ENDPOINTTHREADMAPPING_HPP
+#define RTPS_RESOURCES_ENDPOINTTHREADMAPPING_HPP
+
+#include <fastdds/rtps/common/Guid.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Assigns endpoints to the threads of a pool, so everything about an endpoint is done on the same thread.
+ *
+ * An endpoint takes the thread with fewest endpoints the first time it asks for one, and keeps it until it is
+ * released. Endpoint keys are not used, as readers and writers share them, so keys of writers alone are not
+ * evenly distributed.
+ *
+ * Builtin endpoints may be isolated on the first thread, which is then only used by them.
+ */
+class EndpointThreadMapping
+{
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param num_threads Number of threads of the pool. At least one is assumed.
+     * @param isolate_builtin_endpoints Whether builtin endpoints are kept apart on the first thread. Ignored with
+     *                                  a single thread.
+     */
+    EndpointThreadMapping(
+            size_t num_threads,
+            bool isolate_builtin_endpoints)
+        : endpoints_per_thread_(std::max<size_t>(num_threads, 1u), 0u)
+        , isolate_builtin_endpoints_(isolate_builtin_endpoints && num_threads > 1u)
+    {
+    }
+
+    //! @return Number of threads of the pool.
+    size_t thread_count() const
+    {
+        return endpoints_per_thread_.size();
+    }
+
+    /**
+     * Get the thread of an endpoint, assigning one the first time.
+     *
+     * @param endpoint_guid GUID of the endpoint.
+     * @return Index of the thread, lower than thread_count().
+     */
+    size_t thread_for(
+            const GUID_t& endpoint_guid)
+    {
+        if (1u == endpoints_per_thread_.size() || (isolate_builtin_endpoints_ && endpoint_guid.is_builtin()))
+        {
+            return 0u;
+        }
+
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = assigned_threads_.find(endpoint_guid);
+        if (it != assigned_threads_.end())
+        {
+            return it->second;
+        }
+
+        // Lowest index among the least loaded, so endpoints created in a row go round the threads
+        auto first = endpoints_per_thread_.begin() + (isolate_builtin_endpoints_ ? 1 : 0);
+        size_t index = static_cast<size_t>(
+            std::min_element(first, endpoints_per_thread_.end()) - endpoints_per_thread_.begin());
+        ++endpoints_per_thread_[index];
+        assigned_threads_.emplace(endpoint_guid, index);
+        return index;
+    }
+
+    /**
+     * Forget an endpoint which is being removed, so its thread takes new endpoints again.
+     *
+     * @param endpoint_guid GUID of the endpoint.
+     */
+    void release(
+            const GUID_t& endpoint_guid)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = assigned_threads_.find(endpoint_guid);
+        if (it != assigned_threads_.end())
+        {
+            --endpoints_per_thread_[it->second];
+            assigned_threads_.erase(it);
+        }
+    }
+
+    /**
+     * @param thread_index Index of the thread, lower than thread_count().
+     * @return Number of endpoints assigned to the thread, without the isolated builtin ones.
+     */
+    size_t endpoint_count(
+            size_t thread_index) const
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return endpoints_per_thread_.at(thread_index);
+    }
+
+private:
+
+    //! Number of endpoints assigned to each thread
+    std::vector<size_t> endpoints_per_thread_;
+
+    //! Thread of each endpoint
+    std::unordered_map<GUID_t, size_t> assigned_threads_;
+
+    //! Whether builtin endpoints are kept apart on the first thread
+    bool isolate_builtin_endpoints_;
+
+    //! Protects the assignments
+    mutable std::mutex mutex_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // RTPS_RESOURCES_ENDPOINTTHREADMAPPING_HPP
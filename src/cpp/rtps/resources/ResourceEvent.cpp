@@ -21,7 +21,9 @@
 #include <fastdds/dds/log/Log.hpp>
 
 #include "TimedEventImpl.h"
+#include <utils/threading.hpp>
 
+#include <algorithm>
 #include <cassert>
 #include <thread>
 
@@ -29,11 +31,11 @@ namespace eprosima {
 namespace fastrtps {
 namespace rtps {
 
-static bool event_compare(
-        TimedEventImpl* lhs,
-        TimedEventImpl* rhs)
+bool ResourceEvent::event_compare(
+        const TimedEventImpl* lhs,
+        const TimedEventImpl* rhs)
 {
-    return lhs->next_trigger_time() < rhs->next_trigger_time();
+    return lhs->heap_trigger_time_ < rhs->heap_trigger_time_;
 }
 
 ResourceEvent::~ResourceEvent()
@@ -80,21 +82,21 @@ void ResourceEvent::unregister_timer(
                 });
 
     bool should_notify = false;
-    std::vector<TimedEventImpl*>::iterator it;
 
     // Remove from pending
-    it = std::find(pending_timers_.begin(), pending_timers_.end(), event);
-    if (it != pending_timers_.end())
+    if (event->is_pending_)
     {
+        auto it = std::find(pending_timers_.begin(), pending_timers_.end(), event);
+        assert(it != pending_timers_.end());
         pending_timers_.erase(it);
+        event->is_pending_ = false;
         should_notify = true;
     }
 
     // Remove from active
-    it = std::find(active_timers_.begin(), active_timers_.end(), event);
-    if (it != active_timers_.end())
+    if (event->heap_index_ != TimedEventImpl::invalid_heap_index)
     {
-        active_timers_.erase(it);
+        heap_remove(event);
         should_notify = true;
     }
 
@@ -139,8 +141,9 @@ void ResourceEvent::notify(
 bool ResourceEvent::register_timer_nts(
         TimedEventImpl* event)
 {
-    if (std::find(pending_timers_.begin(), pending_timers_.end(), event) == pending_timers_.end())
+    if (!event->is_pending_)
     {
+        event->is_pending_ = true;
         pending_timers_.push_back(event);
         return true;
     }
@@ -166,7 +169,7 @@ void ResourceEvent::event_service()
         std::chrono::steady_clock::time_point next_trigger =
                 active_timers_.empty() ?
                 current_time_ + std::chrono::seconds(1) :
-                active_timers_[0]->next_trigger_time();
+                active_timers_[0]->heap_trigger_time_;
 
         cv_.wait_until(lock, next_trigger);
 
@@ -176,9 +179,99 @@ void ResourceEvent::event_service()
     }
 }
 
-void ResourceEvent::sort_timers()
+void ResourceEvent::heap_push(
+        TimedEventImpl* event)
+{
+    event->heap_index_ = active_timers_.size();
+    active_timers_.push_back(event);
+    heap_sift_up(event->heap_index_);
+}
+
+void ResourceEvent::heap_remove(
+        TimedEventImpl* event)
+{
+    size_t index = event->heap_index_;
+    size_t last = active_timers_.size() - 1;
+    event->heap_index_ = TimedEventImpl::invalid_heap_index;
+
+    // Move last element to the position of the removed one, and restore heap order
+    if (index != last)
+    {
+        active_timers_[index] = active_timers_[last];
+        active_timers_[index]->heap_index_ = index;
+        active_timers_.pop_back();
+        heap_update(active_timers_[index]);
+    }
+    else
+    {
+        active_timers_.pop_back();
+    }
+}
+
+void ResourceEvent::heap_update(
+        TimedEventImpl* event)
+{
+    if (!heap_sift_up(event->heap_index_))
+    {
+        heap_sift_down(event->heap_index_);
+    }
+}
+
+bool ResourceEvent::heap_sift_up(
+        size_t index)
+{
+    TimedEventImpl* event = active_timers_[index];
+    size_t initial_index = index;
+
+    while (index > 0)
+    {
+        size_t parent = (index - 1) / 2;
+        if (!event_compare(event, active_timers_[parent]))
+        {
+            break;
+        }
+
+        active_timers_[index] = active_timers_[parent];
+        active_timers_[index]->heap_index_ = index;
+        index = parent;
+    }
+
+    active_timers_[index] = event;
+    event->heap_index_ = index;
+    return index != initial_index;
+}
+
+void ResourceEvent::heap_sift_down(
+        size_t index)
 {
-    std::sort(active_timers_.begin(), active_timers_.end(), event_compare);
+    TimedEventImpl* event = active_timers_[index];
+    size_t size = active_timers_.size();
+
+    while (true)
+    {
+        size_t child = 2 * index + 1;
+        if (child >= size)
+        {
+            break;
+        }
+
+        if (child + 1 < size && event_compare(active_timers_[child + 1], active_timers_[child]))
+        {
+            ++child;
+        }
+
+        if (!event_compare(active_timers_[child], event))
+        {
+            break;
+        }
+
+        active_timers_[index] = active_timers_[child];
+        active_timers_[index]->heap_index_ = index;
+        index = child;
+    }
+
+    active_timers_[index] = event;
+    event->heap_index_ = index;
 }
 
 void ResourceEvent::update_current_time()
@@ -191,75 +284,74 @@ void ResourceEvent::do_timer_actions()
     std::chrono::steady_clock::time_point cancel_time =
             current_time_ + std::chrono::hours(24);
 
-    bool did_something = false;
-
     // Process pending orders
     {
         std::lock_guard<TimedMutex> lock(mutex_);
         for (TimedEventImpl* tp : pending_timers_)
         {
-            // Remove item from active timers
-            auto current_pos = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-            current_pos = std::find(current_pos, active_timers_.end(), tp);
-            if (current_pos != active_timers_.end())
-            {
-                active_timers_.erase(current_pos);
-            }
+            tp->is_pending_ = false;
 
             // Update timer info
             if (tp->update(current_time_, cancel_time))
             {
-                // Timer has to be activated: add to active timers
-                std::vector<TimedEventImpl*>::iterator low_bound;
-
-                // Insert on correct position
-                low_bound = std::lower_bound(active_timers_.begin(), active_timers_.end(), tp, event_compare);
-                active_timers_.emplace(low_bound, tp);
+                // Timer has to be activated: add to active timers or update its position
+                tp->heap_trigger_time_ = tp->next_trigger_time();
+                if (tp->heap_index_ == TimedEventImpl::invalid_heap_index)
+                {
+                    heap_push(tp);
+                }
+                else
+                {
+                    heap_update(tp);
+                }
+            }
+            else if (tp->heap_index_ != TimedEventImpl::invalid_heap_index)
+            {
+                // Timer was cancelled: remove from active timers
+                heap_remove(tp);
             }
         }
         pending_timers_.clear();
     }
 
-    // Trigger active timers
-    for (TimedEventImpl* tp : active_timers_)
+    // Take active timers that should be triggered. They are taken before calling any of them, so a timer
+    // restarting with a null interval is only triggered once per iteration.
+    due_timers_.clear();
+    while (!active_timers_.empty() && active_timers_[0]->heap_trigger_time_ <= current_time_)
     {
-        if (tp->next_trigger_time() <= current_time_)
-        {
-            did_something = true;
-            tp->trigger(current_time_, cancel_time);
-        }
-        else
-        {
-            break;
-        }
+        due_timers_.push_back(active_timers_[0]);
+        heap_remove(active_timers_[0]);
     }
 
-    // If an action was made, keep active_timers_ sorted
-    if (did_something)
+    // Trigger them, and keep the ones that have been restarted
+    for (TimedEventImpl* tp : due_timers_)
     {
-        sort_timers();
-        active_timers_.erase(
-            std::lower_bound(active_timers_.begin(), active_timers_.end(), nullptr,
-            [cancel_time](
-                TimedEventImpl* a,
-                TimedEventImpl* b)
-                    {
-                        (void)b;
-                        return a->next_trigger_time() < cancel_time;
-                    }),
-            active_timers_.end()
-            );
+        tp->trigger(current_time_, cancel_time);
+
+        std::chrono::steady_clock::time_point next_trigger = tp->next_trigger_time();
+        if (next_trigger < cancel_time)
+        {
+            tp->heap_trigger_time_ = next_trigger;
+            heap_push(tp);
+        }
     }
+    due_timers_.clear();
 }
 
-void ResourceEvent::init_thread()
+void ResourceEvent::init_thread(
+        const fastdds::rtps::ThreadSettings& thread_settings)
 {
     std::lock_guard<TimedMutex> lock(mutex_);
 
+    thread_settings_ = thread_settings;
+
     allow_vector_manipulation_ = false;
     resize_collections();
 
-    thread_ = std::thread(&ResourceEvent::event_service, this);
+    thread_ = create_std_thread([this]()
+                    {
+                        event_service();
+                    }, thread_settings_, "event");
 }
 
 } /* namespace rtps */
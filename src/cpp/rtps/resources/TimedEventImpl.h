@@ -45,6 +45,8 @@ class TimedEventImpl
 {
     using Callback = std::function<bool ()>;
 
+    friend class ResourceEvent;
+
 public:
 
     enum StateCode
@@ -167,6 +169,18 @@ private:
 
     //! Protects interval_microsec_ and next_trigger_time_
     std::mutex mutex_;
+
+    //! Value used when the event is not on the active timers heap of ResourceEvent.
+    static constexpr size_t invalid_heap_index = static_cast<size_t>(-1);
+
+    //! Position on the active timers heap of ResourceEvent. Only accessed by ResourceEvent.
+    size_t heap_index_ = invalid_heap_index;
+
+    //! Copy of next_trigger_time_ used to order the active timers heap. Only accessed by ResourceEvent.
+    std::chrono::steady_clock::time_point heap_trigger_time_;
+
+    //! Whether the event is on the pending timers collection of ResourceEvent. Only accessed by ResourceEvent.
+    bool is_pending_ = false;
 };
 
 } // namespace rtps
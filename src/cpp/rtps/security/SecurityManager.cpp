@@ -1033,8 +1033,7 @@ bool SecurityManager::create_participant_stateless_message_writer()
     watt.endpoint.topicKind = NO_KEY;
     watt.matched_readers_allocation = participant_->getRTPSParticipantAttributes().allocation.participants;
 
-    if (participant_->getRTPSParticipantAttributes().throughputController.bytesPerPeriod != UINT32_MAX &&
-            participant_->getRTPSParticipantAttributes().throughputController.periodMillisecs != 0)
+    if (!participant_->getFlowControllers().empty())
     {
         watt.mode = ASYNCHRONOUS_WRITER;
     }
@@ -1190,8 +1189,7 @@ bool SecurityManager::create_participant_volatile_message_secure_writer()
     watt.matched_readers_allocation = participant_->getRTPSParticipantAttributes().allocation.participants;
     // TODO(Ricardo) Study keep_all
 
-    if (participant_->getRTPSParticipantAttributes().throughputController.bytesPerPeriod != UINT32_MAX &&
-            participant_->getRTPSParticipantAttributes().throughputController.periodMillisecs != 0)
+    if (!participant_->getFlowControllers().empty())
     {
         watt.mode = ASYNCHRONOUS_WRITER;
     }
@@ -21,6 +21,7 @@
 #include <fastrtps/utils/System.h>
 #include <fastdds/rtps/transport/TCPChannelResourceBasic.h>
 #include <fastdds/rtps/transport/TCPAcceptorBasic.h>
+#include <utils/threading.hpp>
 #if TLS_FOUND
 #include <fastdds/rtps/transport/TCPChannelResourceSecure.h>
 #include <fastdds/rtps/transport/TCPAcceptorSecure.h>
@@ -97,6 +98,7 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator=(const TCPTransportDesc
 
     maxMessageSize = t.maxMessageSize;
     maxInitialPeersRange = t.maxInitialPeersRange;
+    default_reception_threads = t.default_reception_threads;
     sendBufferSize = t.sendBufferSize;
     receiveBufferSize = t.receiveBufferSize;
     TTL = t.TTL;
@@ -1157,8 +1159,10 @@ void TCPTransportInterface::SocketAccepted(
             channel->set_options(configuration());
             std::weak_ptr<TCPChannelResource> channel_weak_ptr = channel;
             std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-            channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                        channel_weak_ptr, rtcp_manager_weak_ptr));
+            channel->thread(create_std_thread([this, channel_weak_ptr, rtcp_manager_weak_ptr]()
+                    {
+                        perform_listen_operation(channel_weak_ptr, rtcp_manager_weak_ptr);
+                    }, configuration()->default_reception_threads, "TCP reception"));
 
             logInfo(RTCP, " Accepted connection (local: " << IPLocator::to_string(locator)
                     << ", remote: " << channel->remote_endpoint().address()
@@ -1203,8 +1207,10 @@ void TCPTransportInterface::SecureSocketAccepted(
             secure_channel->set_options(configuration());
             std::weak_ptr<TCPChannelResource> channel_weak_ptr = secure_channel;
             std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-            secure_channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                        channel_weak_ptr, rtcp_manager_weak_ptr));
+            secure_channel->thread(create_std_thread([this, channel_weak_ptr, rtcp_manager_weak_ptr]()
+                    {
+                        perform_listen_operation(channel_weak_ptr, rtcp_manager_weak_ptr);
+                    }, configuration()->default_reception_threads, "TCP reception"));
 
             logInfo(RTCP, " Accepted connection (local: " << IPLocator::to_string(locator)
                     << ", remote: " << socket->lowest_layer().remote_endpoint().address()
@@ -1246,8 +1252,10 @@ void TCPTransportInterface::SocketConnected(
                     channel->set_options(configuration());
 
                     std::weak_ptr<RTCPMessageManager> rtcp_manager_weak_ptr = rtcp_message_manager_;
-                    channel->thread(std::thread(&TCPTransportInterface::perform_listen_operation, this,
-                                channel_weak_ptr, rtcp_manager_weak_ptr));
+                    channel->thread(create_std_thread([this, channel_weak_ptr, rtcp_manager_weak_ptr]()
+                            {
+                                perform_listen_operation(channel_weak_ptr, rtcp_manager_weak_ptr);
+                            }, configuration()->default_reception_threads, "TCP reception"));
                 }
             }
             else
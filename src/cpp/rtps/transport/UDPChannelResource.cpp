@@ -16,6 +16,7 @@
 #include <fastdds/rtps/transport/UDPTransportInterface.h>
 #include <fastdds/rtps/transport/UDPChannelResource.h>
 #include <fastdds/rtps/messages/MessageReceiver.h>
+#include <utils/threading.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -39,7 +40,10 @@ UDPChannelResource::UDPChannelResource(
     , interface_(sInterface)
     , transport_(transport)
 {
-    thread(std::thread(&UDPChannelResource::perform_listen_operation, this, locator));
+    thread(create_std_thread([this, locator]()
+            {
+                perform_listen_operation(locator);
+            }, transport->configuration()->default_reception_threads, "UDP reception"));
 }
 
 UDPChannelResource::~UDPChannelResource()
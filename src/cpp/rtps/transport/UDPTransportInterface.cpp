@@ -582,7 +582,7 @@ static bool check_and_invalidate(
     for (; index < entries.size(); ++index)
     {
         LocatorSelectorEntry* entry = entries[index];
-        if (entry->transport_should_process)
+        if (entry->transport_should_process && (entry->allow_multicast || entry->unicast.empty()))
         {
             for (const Locator_t& loc : entry->multicast)
             {
@@ -612,7 +612,9 @@ void UDPTransportInterface::select_locators(
             bool selected = false;
 
             // First try to find a multicast locator which is at least on another list.
-            for (size_t j = 0; j < entry->multicast.size() && !selected; ++j)
+            // Entries restricted to unicast only use multicast when they have no unicast locators.
+            bool can_use_multicast = entry->allow_multicast || entry->unicast.empty();
+            for (size_t j = 0; can_use_multicast && j < entry->multicast.size() && !selected; ++j)
             {
                 if (IsLocatorSupported(entry->multicast[j]))
                 {
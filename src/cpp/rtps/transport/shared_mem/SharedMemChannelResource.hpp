@@ -21,6 +21,7 @@
 
 #include <rtps/transport/shared_mem/SharedMemManager.hpp>
 #include <rtps/transport/shared_mem/SharedMemTransport.h>
+#include <utils/threading.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -37,12 +38,14 @@ public:
             const fastrtps::rtps::Locator_t& locator,
             TransportReceiverInterface* receiver,
             const std::string& dump_file,
+            const ThreadSettings& thread_settings,
             bool should_init_thread = true)
         : ChannelResource()
         , message_receiver_(receiver)
         , listener_(listener)
         , only_multicast_purpose_(false)
         , locator_(locator)
+        , thread_settings_(thread_settings)
     {
         if (!dump_file.empty())
         {
@@ -165,7 +168,10 @@ protected:
     void init_thread(
             const fastrtps::rtps::Locator_t& locator)
     {
-        this->thread(std::thread(&SharedMemChannelResource::perform_listen_operation, this, locator));
+        this->thread(create_std_thread([this, locator]()
+                {
+                    perform_listen_operation(locator);
+                }, thread_settings_, "SHM reception"));
     }
 
 
@@ -205,6 +211,7 @@ private:
 
     bool only_multicast_purpose_;
     fastrtps::rtps::Locator_t locator_;
+    ThreadSettings thread_settings_;
 
     SharedMemChannelResource(
             const SharedMemChannelResource&) = delete;
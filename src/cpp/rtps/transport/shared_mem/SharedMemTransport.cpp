@@ -319,7 +319,8 @@ SharedMemChannelResource* SharedMemTransport::CreateInputChannelResource(
             open_mode)->create_listener(),
         locator,
         receiver,
-        configuration_.rtps_dump_file());
+        configuration_.rtps_dump_file(),
+        configuration_.default_reception_threads);
 }
 
 bool SharedMemTransport::OpenOutputChannel(
@@ -0,0 +1,154 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HeartbeatBackoff.hpp
+ */
+
+#ifndef RTPS_WRITER_HEARTBEATBACKOFF_HPP
+#define RTPS_WRITER_HEARTBEATBACKOFF_HPP
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Computes the factor applied to the heartbeat period of a writer.
+ *
+ * Each periodic heartbeat sent doubles the period, up to a maximum factor, until the writer goes back to the
+ * configured period because new data has been sent or a reader has answered.
+ * This avoids sending the same heartbeat over and over to readers that do not answer.
+ *
+ * It also keeps statistics about the periodic heartbeats sent, and the ones saved with respect to a fixed period.
+ */
+class HeartbeatBackoff
+{
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param max_factor Maximum factor applied to the heartbeat period. Values below 2 disable the backoff.
+     */
+    explicit HeartbeatBackoff(
+            uint32_t max_factor)
+        : max_factor_(max_factor < 1u ? 1u : max_factor)
+    {
+    }
+
+    /**
+     * Whether the heartbeat period is adapted.
+     */
+    bool is_enabled() const
+    {
+        return max_factor_ > 1u;
+    }
+
+    /**
+     * Current factor applied to the heartbeat period.
+     */
+    uint32_t factor() const
+    {
+        return factor_;
+    }
+
+    /**
+     * Go back to the configured heartbeat period, i.e. when new data has been sent or a reader has answered.
+     *
+     * @return true when the factor has changed, false otherwise.
+     */
+    bool reset()
+    {
+        if (factor_ != 1u)
+        {
+            factor_ = 1u;
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Account for a new ACKNACK from a reader, going back to the configured heartbeat period when that reader
+     * still misses changes.
+     *
+     * Readers which have acknowledged every change answer each heartbeat too, so resetting on any ACKNACK would
+     * keep the period from backing off while other readers stay silent.
+     *
+     * @param reader_has_unacknowledged Whether the reader still has changes to acknowledge after the ACKNACK.
+     * @return true when the factor has changed, false otherwise.
+     */
+    bool acknack_received(
+            bool reader_has_unacknowledged)
+    {
+        return reader_has_unacknowledged && reset();
+    }
+
+    /**
+     * Account for a periodic heartbeat being sent, and compute the factor to use for the next period.
+     *
+     * @return true when the factor has changed, false otherwise.
+     */
+    bool heartbeat_sent()
+    {
+        ++heartbeats_sent_;
+        heartbeats_saved_ += factor_ - 1u;
+
+        if (factor_ < max_factor_)
+        {
+            factor_ = (factor_ > max_factor_ / 2u) ? max_factor_ : factor_ * 2u;
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Number of periodic heartbeats sent.
+     */
+    uint64_t heartbeats_sent() const
+    {
+        return heartbeats_sent_;
+    }
+
+    /**
+     * Number of periodic heartbeats that would have been sent with a fixed period, minus the ones sent.
+     */
+    uint64_t heartbeats_saved() const
+    {
+        return heartbeats_saved_;
+    }
+
+private:
+
+    //! Maximum factor
+    uint32_t max_factor_;
+
+    //! Current factor
+    uint32_t factor_ = 1u;
+
+    //! Number of periodic heartbeats sent
+    uint64_t heartbeats_sent_ = 0;
+
+    //! Number of periodic heartbeats saved
+    uint64_t heartbeats_saved_ = 0;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif  // RTPS_WRITER_HEARTBEATBACKOFF_HPP
@@ -293,10 +293,24 @@ void RTPSWriter::compute_selected_guids()
 
 void RTPSWriter::update_cached_info_nts()
 {
+    // Locators of the entries may have been updated
+    locator_selector_.entries_changed();
     locator_selector_.reset(true);
     mp_RTPSParticipant->network_factory().select_locators(locator_selector_);
 }
 
+bool RTPSWriter::select_all_readers_nts()
+{
+    locator_selector_.reset(true);
+    if (locator_selector_.selection_is_valid())
+    {
+        return false;
+    }
+
+    mp_RTPSParticipant->network_factory().select_locators(locator_selector_);
+    return true;
+}
+
 bool RTPSWriter::destinations_have_changed() const
 {
     return false;
@@ -59,7 +59,7 @@ ReaderProxy::ReaderProxy(
     , last_acknack_count_(0)
     , last_nackfrag_count_(0)
 {
-    nack_supression_event_ = new TimedEvent(writer_->getRTPSParticipant()->getEventResource(),
+    nack_supression_event_ = new TimedEvent(writer_->getRTPSParticipant()->getEventResource(writer_->getGuid()),
                     [&]() -> bool
                     {
                         writer_->perform_nack_supression(guid());
@@ -67,7 +67,7 @@ ReaderProxy::ReaderProxy(
                     },
                     TimeConv::Time_t2MilliSecondsDouble(times.nackSupressionDuration));
 
-    initial_heartbeat_event_ = new TimedEvent(writer_->getRTPSParticipant()->getEventResource(),
+    initial_heartbeat_event_ = new TimedEvent(writer_->getRTPSParticipant()->getEventResource(writer_->getGuid()),
                     [&]() -> bool
                     {
                         writer_->intraprocess_heartbeat(this);
@@ -293,6 +293,25 @@ bool ReaderProxy::change_is_unsent(
     return chit->getStatus() == UNSENT;
 }
 
+bool ReaderProxy::unsent_fragments_for_change(
+        const SequenceNumber_t& seq_num,
+        FragmentNumberSet_t& unsent_fragments) const
+{
+    if (seq_num <= changes_low_mark_ || changes_for_reader_.empty())
+    {
+        return false;
+    }
+
+    ChangeConstIterator chit = find_change(seq_num);
+    if (chit == changes_for_reader_.end() || chit->getStatus() != UNSENT)
+    {
+        return false;
+    }
+
+    unsent_fragments = chit->getUnsentFragments();
+    return true;
+}
+
 void ReaderProxy::acked_changes_set(
         const SequenceNumber_t& seq_num)
 {
@@ -25,6 +25,8 @@
 
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/flowcontrol/FlowController.h>
+#include <rtps/flowcontrol/TokenBucket.hpp>
+#include <rtps/writer/HeartbeatBackoff.hpp>
 #include <rtps/history/BasicPayloadPool.hpp>
 
 #include <fastdds/rtps/messages/RTPSMessageCreator.h>
@@ -35,6 +37,7 @@
 #include <fastdds/rtps/resources/TimedEvent.h>
 
 #include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 
 #include <fastdds/dds/log/Log.hpp>
 #include <fastrtps/utils/TimeConversion.h>
@@ -45,10 +48,13 @@
 #include <rtps/RTPSDomainImpl.hpp>
 #include <rtps/history/CacheChangePool.h>
 #include <rtps/messages/RTPSGapBuilder.hpp>
+#include <rtps/reader/IntraprocessDeliveryQueue.hpp>
 #include <rtps/writer/RTPSWriterCollector.h>
 
 #include "../builtin/discovery/database/DiscoveryDataBase.hpp"
 
+#include <algorithm>
+#include <cstdlib>
 #include <mutex>
 #include <vector>
 #include <stdexcept>
@@ -205,13 +211,13 @@ void StatefulWriter::init(
 {
     const RTPSParticipantAttributes& part_att = pimpl->getRTPSParticipantAttributes();
 
-    periodic_hb_event_ = new TimedEvent(pimpl->getEventResource(), [&]() -> bool
+    periodic_hb_event_ = new TimedEvent(pimpl->getEventResource(m_guid), [&]() -> bool
                     {
                         return send_periodic_heartbeat();
                     },
                     TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod));
 
-    nack_response_event_ = new TimedEvent(pimpl->getEventResource(), [&]() -> bool
+    nack_response_event_ = new TimedEvent(pimpl->getEventResource(m_guid), [&]() -> bool
                     {
                         perform_nack_response();
                         return false;
@@ -220,7 +226,7 @@ void StatefulWriter::init(
 
     if (disable_positive_acks_)
     {
-        ack_event_ = new TimedEvent(pimpl->getEventResource(), [&]() -> bool
+        ack_event_ = new TimedEvent(pimpl->getEventResource(m_guid), [&]() -> bool
                         {
                             return ack_timer_expired();
                         },
@@ -231,6 +237,65 @@ void StatefulWriter::init(
     {
         matched_readers_pool_.push_back(new ReaderProxy(m_times, part_att.allocation.locators, this));
     }
+
+    // Pacing of fragments is configured through endpoint properties
+    const std::string* pacing_rate = PropertyPolicyHelper::find_property(att.endpoint.properties,
+                    "fastdds.fragment_pacing.bytes_per_second");
+    if (pacing_rate != nullptr)
+    {
+        uint64_t bytes_per_second = std::strtoull(pacing_rate->c_str(), nullptr, 10);
+        uint32_t burst_size = RTPSMessageGroup::get_max_fragment_payload_size();
+        const std::string* pacing_burst = PropertyPolicyHelper::find_property(att.endpoint.properties,
+                        "fastdds.fragment_pacing.burst_size");
+        if (pacing_burst != nullptr)
+        {
+            burst_size = static_cast<uint32_t>(std::strtoul(pacing_burst->c_str(), nullptr, 10));
+        }
+
+        if (bytes_per_second > 0 && burst_size > 0)
+        {
+            if (ASYNCHRONOUS_WRITER != att.mode)
+            {
+                logWarning(RTPS_WRITER, "Fragment pacing is only applied on asynchronous writers");
+            }
+            else
+            {
+                fragment_pacing_.reset(new TokenBucket(bytes_per_second, burst_size));
+                fragment_pacing_event_ = new TimedEvent(pimpl->getEventResource(m_guid), [&]() -> bool
+                                {
+                                    mp_RTPSParticipant->async_thread().wake_up(this);
+                                    return false;
+                                }, 0);
+            }
+        }
+    }
+
+    // Heartbeat period is adapted when readers do not answer, up to a maximum factor
+    uint32_t max_heartbeat_factor = 1u;
+    const std::string* heartbeat_backoff = PropertyPolicyHelper::find_property(att.endpoint.properties,
+                    "fastdds.heartbeat_backoff.max_factor");
+    if (heartbeat_backoff != nullptr)
+    {
+        max_heartbeat_factor = static_cast<uint32_t>(std::strtoul(heartbeat_backoff->c_str(), nullptr, 10));
+    }
+    heartbeat_backoff_.reset(new HeartbeatBackoff(max_heartbeat_factor));
+
+    // Repairs are only sent through multicast when enough readers of a multicast group requested them
+    const std::string* multicast_threshold = PropertyPolicyHelper::find_property(att.endpoint.properties,
+                    "fastdds.multicast_repair_threshold");
+    if (multicast_threshold != nullptr)
+    {
+        double threshold = std::strtod(multicast_threshold->c_str(), nullptr);
+        if (threshold < 0.0 || threshold > 1.0)
+        {
+            logWarning(RTPS_WRITER, "Ignoring multicast repair threshold " << *multicast_threshold <<
+                    ". It should be a fraction between 0 and 1");
+        }
+        else
+        {
+            multicast_threshold_ = threshold;
+        }
+    }
 }
 
 StatefulWriter::~StatefulWriter()
@@ -242,6 +307,11 @@ StatefulWriter::~StatefulWriter()
         controller->disable();
     }
 
+    for (std::unique_ptr<FlowController>& controller : mp_RTPSParticipant->getFlowControllers())
+    {
+        controller->unregister_writer(this);
+    }
+
     if (disable_positive_acks_)
     {
         delete(ack_event_);
@@ -254,6 +324,12 @@ StatefulWriter::~StatefulWriter()
         nack_response_event_ = nullptr;
     }
 
+    if (fragment_pacing_event_ != nullptr)
+    {
+        delete(fragment_pacing_event_);
+        fragment_pacing_event_ = nullptr;
+    }
+
     mp_RTPSParticipant->async_thread().unregister_writer(this);
 
     // After unregistering writer from AsyncWriterThread, delete all flow_controllers because they register the writer in
@@ -422,6 +498,7 @@ void StatefulWriter::unsent_change_added_to_history(
 
                 if (there_are_remote_readers_)
                 {
+                    reset_heartbeat_period_nts();
                     periodic_hb_event_->restart_timer(max_blocking_time);
                 }
 
@@ -492,6 +569,19 @@ bool StatefulWriter::intraprocess_delivery(
         {
             change->write_params.sample_identity(change->write_params.related_sample_identity());
         }
+
+        IntraprocessDeliveryQueue* queue = reader->intraprocess_queue();
+        if (nullptr != queue)
+        {
+            // The change is acknowledged by the reader once processed. If it could not be queued, the reader will
+            // request it again after processing a later heartbeat.
+            if (!queue->push_data(change))
+            {
+                logInfo(RTPS_WRITER, "Intraprocess queue of " << reader_proxy->guid() << " refused a change");
+            }
+            return false;
+        }
+
         return reader->processDataMsg(change);
     }
     return false;
@@ -504,6 +594,17 @@ bool StatefulWriter::intraprocess_gap(
     RTPSReader* reader = reader_proxy->local_reader();
     if (reader)
     {
+        IntraprocessDeliveryQueue* queue = reader->intraprocess_queue();
+        if (nullptr != queue)
+        {
+            // As with changes, the gap is acknowledged by the reader once processed
+            if (!queue->push_gap(m_guid, seq_num, seq_num + 1))
+            {
+                logInfo(RTPS_WRITER, "Intraprocess queue of " << reader_proxy->guid() << " refused a gap");
+            }
+            return false;
+        }
+
         return reader->processGapMsg(m_guid, seq_num, SequenceNumberSet_t(seq_num + 1));
     }
 
@@ -537,8 +638,11 @@ bool StatefulWriter::intraprocess_heartbeat(
                 (liveliness || reader_proxy->has_changes()))
         {
             incrementHBCount();
-            if (true == (returned_value =
-                    reader->processHeartbeatMsg(m_guid, m_heartbeatCount, first_seq, last_seq, true, liveliness)))
+            IntraprocessDeliveryQueue* queue = reader->intraprocess_queue();
+            returned_value = queue ?
+                    queue->push_heartbeat(m_guid, m_heartbeatCount, first_seq, last_seq, liveliness) :
+                    reader->processHeartbeatMsg(m_guid, m_heartbeatCount, first_seq, last_seq, true, liveliness);
+            if (returned_value)
             {
                 if (reader_proxy->durability_kind() < TRANSIENT_LOCAL ||
                         this->getAttributes().durabilityKind < TRANSIENT_LOCAL)
@@ -546,7 +650,16 @@ bool StatefulWriter::intraprocess_heartbeat(
                     SequenceNumber_t first_relevant = reader_proxy->first_relevant_sequence_number();
                     if (first_seq < first_relevant)
                     {
-                        reader->processGapMsg(m_guid, first_seq, SequenceNumberSet_t(first_relevant));
+                        if (queue)
+                        {
+                            // Irrelevant changes are not kept for the reader, so the gap is repeated on the next
+                            // heartbeat when it cannot be queued now
+                            returned_value = queue->push_gap(m_guid, first_seq, first_relevant);
+                        }
+                        else
+                        {
+                            reader->processGapMsg(m_guid, first_seq, SequenceNumberSet_t(first_relevant));
+                        }
                     }
                 }
             }
@@ -612,6 +725,7 @@ void StatefulWriter::send_any_unsent_changes()
 
     if (activateHeartbeatPeriod)
     {
+        reset_heartbeat_period_nts();
         periodic_hb_event_->restart_timer();
     }
 
@@ -860,9 +974,10 @@ void StatefulWriter::send_all_unsent_changes(
         static constexpr uint32_t implicit_flow_controller_size = RTPSMessageGroup::get_max_fragment_payload_size();
 
         NetworkFactory& network = mp_RTPSParticipant->network_factory();
-        locator_selector_.reset(true);
-        network.select_locators(locator_selector_);
-        compute_selected_guids();
+        if (select_all_readers_nts())
+        {
+            compute_selected_guids();
+        }
 
         bool acknack_required = next_all_acked_notify_sequence_ < get_seq_num_min();
 
@@ -880,6 +995,8 @@ void StatefulWriter::send_all_unsent_changes(
 
         RTPSGapBuilder gap_builder(group);
         uint32_t total_sent_size = 0;
+        bool must_wake_up = false;
+        uint32_t paced_fragment_size = 0;
 
         History::iterator cit;
         for (cit = mp_history->changesBegin();
@@ -912,6 +1029,8 @@ void StatefulWriter::send_all_unsent_changes(
                 }
             }
 
+            apply_multicast_threshold_nts();
+
             if (locator_selector_.state_has_changed())
             {
                 gap_builder.flush();
@@ -926,6 +1045,18 @@ void StatefulWriter::send_all_unsent_changes(
                 {
                     gap_builder.add(seq);
                 }
+                else if ((*cit)->getFragmentSize() > 0)
+                {
+                    // Only the fragments pending for the selected readers are sent
+                    bool fragments_pending = false;
+                    if (!send_unsent_fragments_nts_(group, *cit, inline_qos, lastBytesProcessed, total_sent_size,
+                            activateHeartbeatPeriod, fragments_pending))
+                    {
+                        paced_fragment_size = (*cit)->getFragmentSize();
+                        break;
+                    }
+                    must_wake_up |= fragments_pending;
+                }
                 else
                 {
                     bool sent_ok = send_data_or_fragments(group, *cit, inline_qos, sent_fun);
@@ -960,11 +1091,16 @@ void StatefulWriter::send_all_unsent_changes(
 
         group.flush_and_reset();
 
-        locator_selector_.reset(true);
-        network.select_locators(locator_selector_);
-        compute_selected_guids();
+        if (select_all_readers_nts())
+        {
+            compute_selected_guids();
+        }
 
-        if (cit != mp_history->changesEnd())
+        if (paced_fragment_size > 0)
+        {
+            schedule_fragment_pacing_nts_(paced_fragment_size);
+        }
+        else if (must_wake_up || cit != mp_history->changesEnd())
         {
             mp_RTPSParticipant->async_thread().wake_up(this);
         }
@@ -994,9 +1130,10 @@ void StatefulWriter::send_unsent_changes_with_flow_control(
     bool heartbeat_has_been_sent = false;
 
     NetworkFactory& network = mp_RTPSParticipant->network_factory();
-    locator_selector_.reset(true);
-    network.select_locators(locator_selector_);
-    compute_selected_guids();
+    if (select_all_readers_nts())
+    {
+        compute_selected_guids();
+    }
 
     RTPSMessageGroup group(mp_RTPSParticipant, this, *this);
 
@@ -1005,9 +1142,10 @@ void StatefulWriter::send_unsent_changes_with_flow_control(
 
     // Reset the state of locator_selector to select all readers
     group.flush_and_reset();
-    locator_selector_.reset(true);
-    network.select_locators(locator_selector_);
-    compute_selected_guids();
+    if (select_all_readers_nts())
+    {
+        compute_selected_guids();
+    }
 
     for (ReaderProxy* remoteReader : matched_readers_)
     {
@@ -1074,6 +1212,8 @@ void StatefulWriter::send_unsent_changes_with_flow_control(
                 expectsInlineQos |= remoteReader->expects_inline_qos();
             }
 
+            apply_multicast_threshold_nts();
+
             if (locator_selector_.state_has_changed())
             {
                 group.flush_and_reset();
@@ -1163,9 +1303,139 @@ void StatefulWriter::send_unsent_changes_with_flow_control(
         logError(RTPS_WRITER, "Max blocking time reached");
     }
 
-    locator_selector_.reset(true);
-    network.select_locators(locator_selector_);
-    compute_selected_guids();
+    if (select_all_readers_nts())
+    {
+        compute_selected_guids();
+    }
+}
+
+bool StatefulWriter::send_unsent_fragments_nts_(
+        RTPSMessageGroup& group,
+        CacheChange_t* change,
+        bool inline_qos,
+        uint32_t& last_bytes_processed,
+        uint32_t& sent_size,
+        bool& activateHeartbeatPeriod,
+        bool& fragments_pending)
+{
+    SequenceNumber_t seq = change->sequenceNumber;
+    uint32_t fragment_size = change->getFragmentSize();
+    uint32_t fragment_count = change->getFragmentCount();
+    bool tmp_bool = false;
+
+    // Join the fragments pending for every reader this change should be sent to.
+    // Windows of each reader may start on different fragments, so the lowest base is used.
+    FragmentNumberSet_t pending_fragments;
+    FragmentNumberSet_t reader_fragments;
+    bool base_found = false;
+    for (ReaderProxy* remoteReader : matched_readers_)
+    {
+        if (!remoteReader->is_local_reader() && remoteReader->unsent_fragments_for_change(seq, reader_fragments) &&
+                (!base_found || reader_fragments.base() < pending_fragments.base()))
+        {
+            pending_fragments.base(reader_fragments.base());
+            base_found = true;
+        }
+    }
+
+    for (ReaderProxy* remoteReader : matched_readers_)
+    {
+        if (!remoteReader->is_local_reader() && remoteReader->unsent_fragments_for_change(seq, reader_fragments))
+        {
+            reader_fragments.for_each([&pending_fragments](
+                        FragmentNumber_t frag)
+                    {
+                        pending_fragments.add(frag);
+                    });
+        }
+    }
+
+    if (pending_fragments.empty())
+    {
+        // No fragment is pending on the windows, so the change is considered as sent
+        for (ReaderProxy* remoteReader : matched_readers_)
+        {
+            if (!remoteReader->is_local_reader() && remoteReader->change_is_unsent(seq, tmp_bool))
+            {
+                remoteReader->set_change_to_status(seq, UNDERWAY, true);
+                activateHeartbeatPeriod |= remoteReader->is_reliable();
+            }
+        }
+        return true;
+    }
+
+    bool sent_ok = true;
+    FragmentNumber_t max_fragment = pending_fragments.max();
+    for (FragmentNumber_t frag = pending_fragments.base(); sent_ok && frag <= max_fragment; ++frag)
+    {
+        if (!pending_fragments.is_set(frag))
+        {
+            continue;
+        }
+
+        uint32_t frag_length = (frag != fragment_count) ?
+                fragment_size : change->serializedPayload.length - ((frag - 1) * fragment_size);
+
+        if (fragment_pacing_ && !fragment_pacing_->try_consume(frag_length))
+        {
+            return false;
+        }
+
+        sent_ok = group.add_data_frag(*change, frag, inline_qos);
+        if (!sent_ok)
+        {
+            // The fragments not sent are still unsent on the windows, so the asynchronous writer retries them
+            logError(RTPS_WRITER, "Error sending fragment (" << seq << ", " << frag << ")");
+            fragments_pending = true;
+            break;
+        }
+
+        sent_size += frag_length;
+
+        // Heartbeat piggyback.
+        send_heartbeat_piggyback_nts_(nullptr, group, last_bytes_processed);
+
+        for (ReaderProxy* remoteReader : matched_readers_)
+        {
+            if (!remoteReader->is_local_reader() && remoteReader->change_is_unsent(seq, tmp_bool))
+            {
+                bool all_fragments_sent = false;
+                if (remoteReader->mark_fragment_as_sent_for_change(seq, frag, all_fragments_sent) &&
+                        all_fragments_sent)
+                {
+                    remoteReader->set_change_to_status(seq, UNDERWAY, true);
+                    if (remoteReader->is_reliable())
+                    {
+                        activateHeartbeatPeriod = true;
+                    }
+                }
+            }
+        }
+    }
+
+    // Windows may have slided, leaving fragments to be sent on a later call
+    if (sent_ok)
+    {
+        for (ReaderProxy* remoteReader : matched_readers_)
+        {
+            if (!remoteReader->is_local_reader() && remoteReader->change_is_unsent(seq, tmp_bool))
+            {
+                fragments_pending = true;
+                break;
+            }
+        }
+    }
+
+    return true;
+}
+
+void StatefulWriter::schedule_fragment_pacing_nts_(
+        uint32_t fragment_size)
+{
+    auto wait_time = fragment_pacing_->time_until_available(fragment_size);
+    double wait_ms = std::chrono::duration<double, std::milli>(wait_time).count();
+    fragment_pacing_event_->update_interval_millisec(wait_ms);
+    fragment_pacing_event_->restart_timer();
 }
 
 bool StatefulWriter::send_hole_gaps_to_group(
@@ -1241,6 +1511,8 @@ void StatefulWriter::select_all_readers_with_lowmark_below(
         }
     }
 
+    apply_multicast_threshold_nts();
+
     if (locator_selector_.state_has_changed())
     {
         group.flush_and_reset();
@@ -1249,6 +1521,71 @@ void StatefulWriter::select_all_readers_with_lowmark_below(
     }
 }
 
+void StatefulWriter::update_multicast_groups_nts()
+{
+    multicast_groups_.clear();
+    if (multicast_threshold_ <= 0.0)
+    {
+        return;
+    }
+
+    for (ReaderProxy* reader : matched_readers_)
+    {
+        if (reader->is_local_reader())
+        {
+            continue;
+        }
+
+        LocatorSelectorEntry* entry = reader->locator_selector_entry();
+        for (const Locator_t& locator : entry->multicast)
+        {
+            auto it = std::find_if(multicast_groups_.begin(), multicast_groups_.end(),
+                            [&locator](const MulticastGroup& group)
+                            {
+                                return group.locator == locator;
+                            });
+            if (it == multicast_groups_.end())
+            {
+                multicast_groups_.push_back(MulticastGroup{ locator, { entry } });
+            }
+            else
+            {
+                it->entries.push_back(entry);
+            }
+        }
+    }
+
+    // A multicast locator not shared with other readers is never selected
+    multicast_groups_.erase(std::remove_if(multicast_groups_.begin(), multicast_groups_.end(),
+            [](const MulticastGroup& group)
+            {
+                return group.entries.size() < 2;
+            }), multicast_groups_.end());
+}
+
+void StatefulWriter::apply_multicast_threshold_nts()
+{
+    for (const MulticastGroup& group : multicast_groups_)
+    {
+        size_t n_enabled = static_cast<size_t>(std::count_if(group.entries.begin(), group.entries.end(),
+                [](const LocatorSelectorEntry* entry)
+                {
+                    return entry->enabled;
+                }));
+
+        if (n_enabled > 0 && n_enabled < multicast_threshold_ * group.entries.size())
+        {
+            for (LocatorSelectorEntry* entry : group.entries)
+            {
+                if (entry->enabled)
+                {
+                    entry->allow_multicast = false;
+                }
+            }
+        }
+    }
+}
+
 /*
  * MATCHED_READER-RELATED METHODS
  */
@@ -1257,6 +1594,7 @@ void StatefulWriter::update_reader_info(
 {
     update_cached_info_nts();
     compute_selected_guids();
+    update_multicast_groups_nts();
 
     if (create_sender_resources)
     {
@@ -1472,6 +1810,7 @@ bool StatefulWriter::matched_reader_add(
 
         // Always activate heartbeat period. We need a confirmation of the reader.
         // The state has to be updated.
+        reset_heartbeat_period_nts();
         periodic_hb_event_->restart_timer();
     }
 
@@ -1802,6 +2141,7 @@ void StatefulWriter::updateTimes(
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     if (m_times.heartbeatPeriod != times.heartbeatPeriod)
     {
+        heartbeat_backoff_->reset();
         periodic_hb_event_->update_interval(times.heartbeatPeriod);
     }
     if (m_times.nackResponseDelay != times.nackResponseDelay)
@@ -1843,6 +2183,11 @@ bool StatefulWriter::send_periodic_heartbeat(
     std::lock_guard<RecursiveTimedMutex> guardW(mp_mutex);
 
     bool unacked_changes = false;
+    if (!liveliness)
+    {
+        unacked_changes = send_intraprocess_periodic_heartbeats_nts();
+    }
+
     if (m_separateSendingEnabled)
     {
         for (ReaderProxy* it : matched_readers_)
@@ -1853,6 +2198,11 @@ bool StatefulWriter::send_periodic_heartbeat(
                 unacked_changes = true;
             }
         }
+
+        if (unacked_changes && !liveliness)
+        {
+            periodic_heartbeat_sent_nts();
+        }
     }
     else if (!liveliness)
     {
@@ -1886,6 +2236,8 @@ bool StatefulWriter::send_periodic_heartbeat(
                 {
                     logError(RTPS_WRITER, "Max blocking time reached");
                 }
+
+                periodic_heartbeat_sent_nts();
             }
         }
     }
@@ -1914,6 +2266,62 @@ bool StatefulWriter::send_periodic_heartbeat(
     return unacked_changes;
 }
 
+void StatefulWriter::periodic_heartbeat_sent_nts()
+{
+    if (heartbeat_backoff_->heartbeat_sent())
+    {
+        periodic_hb_event_->update_interval_millisec(
+            TimeConv::Time_t2MilliSecondsDouble(m_times.heartbeatPeriod) * heartbeat_backoff_->factor());
+        logInfo(RTPS_WRITER, getGuid().entityId << " Heartbeat period factor set to " <<
+                heartbeat_backoff_->factor());
+    }
+}
+
+void StatefulWriter::reset_heartbeat_period_nts()
+{
+    if (heartbeat_backoff_->reset())
+    {
+        restart_heartbeat_period_nts();
+    }
+}
+
+void StatefulWriter::restart_heartbeat_period_nts()
+{
+    // The heartbeat already scheduled with the backed off period would still fire late
+    periodic_hb_event_->update_interval(m_times.heartbeatPeriod);
+    periodic_hb_event_->restart_timer();
+}
+
+uint64_t StatefulWriter::get_periodic_heartbeats_sent() const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    return heartbeat_backoff_->heartbeats_sent();
+}
+
+uint64_t StatefulWriter::get_periodic_heartbeats_saved() const
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    return heartbeat_backoff_->heartbeats_saved();
+}
+
+bool StatefulWriter::send_intraprocess_periodic_heartbeats_nts()
+{
+    bool unacked_changes = false;
+
+    for (ReaderProxy* it : matched_readers_)
+    {
+        // Only readers with an intraprocess queue acknowledge their changes after they are delivered
+        RTPSReader* reader = it->is_local_reader() ? it->local_reader() : nullptr;
+        if (nullptr != reader && nullptr != reader->intraprocess_queue() && it->has_unacknowledged())
+        {
+            intraprocess_heartbeat(it, false);
+            unacked_changes = true;
+        }
+    }
+
+    return unacked_changes;
+}
+
 void StatefulWriter::send_heartbeat_to_nts(
         ReaderProxy& remoteReaderProxy,
         bool liveliness,
@@ -2078,6 +2486,12 @@ bool StatefulWriter::process_acknack(
                     {
                         // Sequence numbers before Base are set as Acknowledged.
                         remote_reader->acked_changes_set(sn_set.base());
+
+                        // A reader answering while still missing changes gets the configured heartbeat period
+                        if (heartbeat_backoff_->acknack_received(remote_reader->has_unacknowledged()))
+                        {
+                            restart_heartbeat_period_nts();
+                        }
                         if (sn_set.base() > SequenceNumber_t(0, 0))
                         {
                             if (remote_reader->requested_changes_set(sn_set) || remote_reader->are_there_gaps())
@@ -37,6 +37,7 @@
 #include <rtps/history/BasicPayloadPool.hpp>
 #include <rtps/history/CacheChangePool.h>
 #include <rtps/RTPSDomainImpl.hpp>
+#include <rtps/reader/IntraprocessDeliveryQueue.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -152,6 +153,11 @@ StatelessWriter::~StatelessWriter()
         controller->disable();
     }
 
+    for (std::unique_ptr<FlowController>& controller : mp_RTPSParticipant->getFlowControllers())
+    {
+        controller->unregister_writer(this);
+    }
+
     mp_RTPSParticipant->async_thread().unregister_writer(this);
 
     // After unregistering writer from AsyncWriterThread, delete all flow_controllers because they register the writer in
@@ -352,7 +358,9 @@ bool StatelessWriter::intraprocess_delivery(
         {
             change->write_params.sample_identity(change->write_params.related_sample_identity());
         }
-        return reader->processDataMsg(change);
+
+        IntraprocessDeliveryQueue* queue = reader->intraprocess_queue();
+        return queue ? queue->push_data(change) : reader->processDataMsg(change);
     }
 
     return false;
@@ -490,10 +498,9 @@ void StatelessWriter::send_all_unsent_changes()
         {
             ignore_fixed_locators_ = false;
             late_joiner_guids_.clear();
-            locator_selector_.reset(true);
-            network.select_locators(locator_selector_);
+            bool selection_changed = select_all_readers_nts();
             remote_destinations = locator_selector_.selected_size() > 0 || !fixed_locators_.empty();
-            if (!has_builtin_guid())
+            if (selection_changed && !has_builtin_guid())
             {
                 compute_selected_guids();
             }
@@ -530,9 +537,8 @@ void StatelessWriter::send_all_unsent_changes()
 
     // Restore locator selector state
     ignore_fixed_locators_ = false;
-    locator_selector_.reset(true);
-    network.select_locators(locator_selector_);
-    if (!has_builtin_guid())
+    bool selection_changed = select_all_readers_nts();
+    if (selection_changed && !has_builtin_guid())
     {
         compute_selected_guids();
     }
@@ -623,9 +629,8 @@ void StatelessWriter::send_unsent_changes_with_flow_control()
                 {
                     ignore_fixed_locators_ = false;
                     late_joiner_guids_.clear();
-                    locator_selector_.reset(true);
-                    network.select_locators(locator_selector_);
-                    if (!has_builtin_guid())
+                    bool selection_changed = select_all_readers_nts();
+                    if (selection_changed && !has_builtin_guid())
                     {
                         compute_selected_guids();
                     }
@@ -669,9 +674,8 @@ void StatelessWriter::send_unsent_changes_with_flow_control()
 
     // Restore locator selector state
     ignore_fixed_locators_ = false;
-    locator_selector_.reset(true);
-    network.select_locators(locator_selector_);
-    if (!has_builtin_guid())
+    bool selection_changed = select_all_readers_nts();
+    if (selection_changed && !has_builtin_guid())
     {
         compute_selected_guids();
     }
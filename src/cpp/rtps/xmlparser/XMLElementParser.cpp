@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 //
+#include <cstdlib>
 #include <cstring>
 #include <regex>
 #include <tinyxml2.h>
@@ -41,6 +42,8 @@ XMLP_ret XMLParser::getXMLParticipantAllocationAttributes(
                 <xs:element name="max_properties" type="uint32Type" minOccurs="0"/>
                 <xs:element name="max_user_data" type="uint32Type" minOccurs="0"/>
                 <xs:element name="max_partitions" type="uint32Type" minOccurs="0"/>
+                <xs:element name="event_threads" type="eventThreadsAllocationConfigType" minOccurs="0"/>
+                <xs:element name="async_writer_threads" type="asyncWriterThreadsAllocationConfigType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -118,6 +121,23 @@ XMLP_ret XMLParser::getXMLParticipantAllocationAttributes(
             }
             allocation.data_limits.max_partitions = tmp;
         }
+        else if (strcmp(name, EVENT_THREADS) == 0)
+        {
+            // event_threads - eventThreadsAllocationConfigType
+            if (XMLP_ret::XML_OK != getXMLEventThreadsAllocationAttributes(p_aux0, allocation.event_threads, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, ASYNC_WRITER_THREADS) == 0)
+        {
+            // async_writer_threads - asyncWriterThreadsAllocationConfigType
+            if (XMLP_ret::XML_OK !=
+                    getXMLAsyncWriterThreadsAllocationAttributes(p_aux0, allocation.async_writer_threads, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'rtpsParticipantAllocationAttributesType'. Name: " << name);
@@ -225,6 +245,176 @@ XMLP_ret XMLParser::getXMLSendBuffersAllocationAttributes(
     return XMLP_ret::XML_OK;
 }
 
+XMLP_ret XMLParser::getXMLEventThreadsAllocationAttributes(
+        tinyxml2::XMLElement* elem,
+        rtps::EventThreadsAllocationAttributes& allocation,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="eventThreadsAllocationConfigType">
+            <xs:all minOccurs="0">
+                <xs:element name="count" type="uint32Type" minOccurs="0"/>
+                <xs:element name="isolate_builtin_endpoints" type="boolType" minOccurs="0"/>
+            </xs:all>
+        </xs:complexType>
+     */
+
+    tinyxml2::XMLElement* p_aux0 = nullptr;
+    const char* name = nullptr;
+    uint32_t tmp;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, COUNT) == 0)
+        {
+            // count - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &tmp, ident) || tmp == 0)
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            allocation.count = tmp;
+        }
+        else if (strcmp(name, ISOLATE_BUILTIN_ENDPOINTS) == 0)
+        {
+            // isolate_builtin_endpoints - boolType
+            bool tmp_bool = false;
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &tmp_bool, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            allocation.isolate_builtin_endpoints = tmp_bool;
+        }
+        else
+        {
+            logError(XMLPARSER, "Invalid element found into 'eventThreadsAllocationConfigType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
+XMLP_ret XMLParser::getXMLAsyncWriterThreadsAllocationAttributes(
+        tinyxml2::XMLElement* elem,
+        rtps::AsyncWriterThreadsAllocationAttributes& allocation,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="asyncWriterThreadsAllocationConfigType">
+            <xs:all minOccurs="0">
+                <xs:element name="count" type="uint32Type" minOccurs="0"/>
+                <xs:element name="isolate_builtin_endpoints" type="boolType" minOccurs="0"/>
+            </xs:all>
+        </xs:complexType>
+     */
+
+    tinyxml2::XMLElement* p_aux0 = nullptr;
+    const char* name = nullptr;
+    uint32_t tmp;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, COUNT) == 0)
+        {
+            // count - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &tmp, ident) || tmp == 0)
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            allocation.count = tmp;
+        }
+        else if (strcmp(name, ISOLATE_BUILTIN_ENDPOINTS) == 0)
+        {
+            // isolate_builtin_endpoints - boolType
+            bool tmp_bool = false;
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &tmp_bool, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            allocation.isolate_builtin_endpoints = tmp_bool;
+        }
+        else
+        {
+            logError(XMLPARSER, "Invalid element found into 'asyncWriterThreadsAllocationConfigType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
+XMLP_ret XMLParser::getXMLThreadSettings(
+        tinyxml2::XMLElement* elem,
+        fastdds::rtps::ThreadSettings& thread_settings,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="threadSettingsType">
+            <xs:all minOccurs="0">
+                <xs:element name="scheduling_policy" type="int32Type" minOccurs="0"/>
+                <xs:element name="priority" type="int32Type" minOccurs="0"/>
+                <xs:element name="affinity" type="stringType" minOccurs="0"/>
+                <xs:element name="stack_size" type="uint32Type" minOccurs="0"/>
+            </xs:all>
+        </xs:complexType>
+     */
+
+    tinyxml2::XMLElement* p_aux0 = nullptr;
+    const char* name = nullptr;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, SCHEDULING_POLICY) == 0)
+        {
+            // scheduling_policy - int32Type
+            int tmp = 0;
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &tmp, ident) || tmp < -1)
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            thread_settings.scheduling_policy = tmp;
+        }
+        else if (strcmp(name, PRIORITY) == 0)
+        {
+            // priority - int32Type
+            int tmp = 0;
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &tmp, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            thread_settings.priority = tmp;
+        }
+        else if (strcmp(name, AFFINITY) == 0)
+        {
+            // affinity - stringType, holding a decimal or hexadecimal mask
+            const char* text = p_aux0->GetText();
+            char* end = nullptr;
+            unsigned long long tmp = (nullptr == text) ? 0 : std::strtoull(text, &end, 0);
+            if (nullptr == text || end == text || *end != '\0' || nullptr != std::strchr(text, '-'))
+            {
+                logError(XMLPARSER, "<" << name << "> getXMLThreadSettings XML_ERROR!");
+                return XMLP_ret::XML_ERROR;
+            }
+            thread_settings.affinity = static_cast<uint64_t>(tmp);
+        }
+        else if (strcmp(name, STACK_SIZE) == 0)
+        {
+            // stack_size - uint32Type
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &thread_settings.stack_size, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else
+        {
+            logError(XMLPARSER, "Invalid element found into 'threadSettingsType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
 XMLP_ret XMLParser::getXMLDiscoverySettings(
         tinyxml2::XMLElement* elem,
         rtps::DiscoverySettings& settings,
@@ -707,6 +897,7 @@ XMLP_ret XMLParser::getXMLThroughputController(
             <xs:all minOccurs="0">
                 <xs:element name="bytesPerPeriod" type="uint32Type" minOccurs="0"/>
                 <xs:element name="periodMillisecs" type="uint32Type" minOccurs="0"/>
+                <xs:element name="scheduler" type="flowControllerSchedulerPolicyType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -732,6 +923,47 @@ XMLP_ret XMLParser::getXMLThroughputController(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, SCHEDULER) == 0)
+        {
+            // scheduler
+            /*
+                <xs:simpleType name="flowControllerSchedulerPolicyType">
+                    <xs:restriction base="xs:string">
+                        <xs:enumeration value="FIFO"/>
+                        <xs:enumeration value="ROUND_ROBIN"/>
+                        <xs:enumeration value="HIGH_PRIORITY"/>
+                        <xs:enumeration value="EARLIEST_DEADLINE_FIRST"/>
+                    </xs:restriction>
+                </xs:simpleType>
+             */
+            const char* text = p_aux0->GetText();
+            if (nullptr == text)
+            {
+                logError(XMLPARSER, "Node '" << SCHEDULER << "' without content");
+                return XMLP_ret::XML_ERROR;
+            }
+            if (strcmp(text, FIFO) == 0)
+            {
+                throughputController.scheduler = FlowControllerSchedulerPolicy::FIFO;
+            }
+            else if (strcmp(text, ROUND_ROBIN) == 0)
+            {
+                throughputController.scheduler = FlowControllerSchedulerPolicy::ROUND_ROBIN;
+            }
+            else if (strcmp(text, HIGH_PRIORITY) == 0)
+            {
+                throughputController.scheduler = FlowControllerSchedulerPolicy::HIGH_PRIORITY;
+            }
+            else if (strcmp(text, EARLIEST_DEADLINE_FIRST) == 0)
+            {
+                throughputController.scheduler = FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST;
+            }
+            else
+            {
+                logError(XMLPARSER, "Node '" << SCHEDULER << "' with bad content");
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'portType'. Name: " << name);
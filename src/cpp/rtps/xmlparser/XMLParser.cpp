@@ -292,6 +292,7 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="non_blocking_send" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxMessageSize" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxInitialPeersRange" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="default_reception_threads" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="interfaceWhiteList" type="stringListType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="wan_addr" type="stringType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="output_port" type="uint16Type" minOccurs="0" maxOccurs="1"/>
@@ -444,6 +445,7 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
                 <xs:element name="TTL" type="uint8Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxMessageSize" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxInitialPeersRange" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="default_reception_threads" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="interfaceWhiteList" type="addressListType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="wan_addr" type="stringType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="output_port" type="uint16Type" minOccurs="0" maxOccurs="1"/>
@@ -516,6 +518,14 @@ XMLP_ret XMLParser::parseXMLCommonTransportData(
             }
             pDesc->maxInitialPeersRange = uRange;
         }
+        else if (strcmp(name, DEFAULT_RECEPTION_THREADS) == 0)
+        {
+            // default_reception_threads - threadSettingsType
+            if (XMLP_ret::XML_OK != getXMLThreadSettings(p_aux0, pDesc->default_reception_threads, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else if (strcmp(name, WHITE_LIST) == 0)
         {
             // InterfaceWhiteList addressListType
@@ -697,7 +707,7 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                     strcmp(name, TYPE) == 0 || strcmp(name, SEND_BUFFER_SIZE) == 0 ||
                     strcmp(name, RECEIVE_BUFFER_SIZE) == 0 || strcmp(name, TTL) == 0 ||
                     strcmp(name, MAX_MESSAGE_SIZE) == 0 || strcmp(name, MAX_INITIAL_PEERS_RANGE) == 0 ||
-                    strcmp(name, WHITE_LIST) == 0)
+                    strcmp(name, WHITE_LIST) == 0 || strcmp(name, DEFAULT_RECEPTION_THREADS) == 0)
             {
                 // Parsed Outside of this method
             }
@@ -726,6 +736,7 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
             <xs:all minOccurs="0">
                 <xs:element name="maxMessageSize" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxInitialPeersRange" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="default_reception_threads" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="segment_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="port_queue_capacity" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="healthy_check_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
@@ -798,6 +809,15 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->maxInitialPeersRange = uRange;
             }
+            else if (strcmp(name, DEFAULT_RECEPTION_THREADS) == 0)
+            {
+                // default_reception_threads - threadSettingsType
+                if (XMLP_ret::XML_OK !=
+                        getXMLThreadSettings(p_aux0, transport_descriptor->default_reception_threads, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else if (strcmp(name, TRANSPORT_ID) == 0 || strcmp(name, TYPE) == 0)
             {
                 // Parsed Outside of this method
@@ -2713,6 +2733,7 @@ XMLP_ret XMLParser::parseLogConfig(
        <xs:element name="log">
        <xs:complexType>
         <xs:boolean name="use_default"/>
+        <xs:element name="thread_settings" type="threadSettingsType"/>
         <xs:sequence>
           <xs:element maxOccurs="consumer">
             <xs:complexType>
@@ -2760,13 +2781,22 @@ XMLP_ret XMLParser::parseLogConfig(
                     return ret;
                 }
             }
+            else if (strcmp(tag, THREAD_SETTINGS) == 0)
+            {
+                fastdds::rtps::ThreadSettings thread_settings;
+                if (XMLP_ret::XML_OK != getXMLThreadSettings(p_element, thread_settings, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                eprosima::fastdds::dds::Log::SetThreadConfig(thread_settings);
+            }
             else
             {
                 logError(XMLPARSER, "Not expected tag: '" << tag << "'");
                 ret = XMLP_ret::XML_ERROR;
             }
         }
-        p_element = p_element->NextSiblingElement(CONSUMER);
+        p_element = p_element->NextSiblingElement();
     }
     return ret;
 }
@@ -3060,10 +3090,15 @@ XMLP_ret XMLParser::fillDataNode(
                 <xs:element name="userData" type="octetVectorType" minOccurs="0"/>
                 <xs:element name="participantID" type="int32Type" minOccurs="0"/>
                 <xs:element name="throughputController" type="throughputControllerType" minOccurs="0"/>
+                <xs:element name="destination_throughput_controller" type="throughputControllerType" minOccurs="0"/>
                 <xs:element name="userTransports" type="stringListType" minOccurs="0"/>
                 <xs:element name="useBuiltinTransports" type="boolType" minOccurs="0"/>
                 <xs:element name="propertiesPolicy" type="propertyPolicyType" minOccurs="0"/>
                 <xs:element name="name" type="stringType" minOccurs="0"/>
+                <xs:element name="builtin_transports_reception_threads" type="threadSettingsType" minOccurs="0"/>
+                <xs:element name="timed_events_thread" type="threadSettingsType" minOccurs="0"/>
+                <xs:element name="async_writers_thread" type="threadSettingsType" minOccurs="0"/>
+                <xs:element name="discovery_server_matching_threads" type="threadSettingsType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -3193,6 +3228,16 @@ XMLP_ret XMLParser::fillDataNode(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        else if (strcmp(name, DESTINATION_THROUGHPUT_CONT) == 0)
+        {
+            // destination_throughput_controller
+            if (XMLP_ret::XML_OK !=
+                    getXMLThroughputController(p_aux0,
+                    participant_node.get()->rtps.destination_throughput_controller, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else if (strcmp(name, USER_TRANS) == 0)
         {
             // userTransports
@@ -3227,6 +3272,41 @@ XMLP_ret XMLParser::fillDataNode(
             }
             participant_node.get()->rtps.setName(s.c_str());
         }
+        else if (strcmp(name, BUILTIN_TRANSPORTS_RECEPTION_THREADS) == 0)
+        {
+            // builtin_transports_reception_threads - threadSettingsType
+            if (XMLP_ret::XML_OK != getXMLThreadSettings(p_aux0,
+                    participant_node.get()->rtps.builtin_transports_reception_threads, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, TIMED_EVENTS_THREAD) == 0)
+        {
+            // timed_events_thread - threadSettingsType
+            if (XMLP_ret::XML_OK != getXMLThreadSettings(p_aux0, participant_node.get()->rtps.timed_events_thread, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, ASYNC_WRITERS_THREAD) == 0)
+        {
+            // async_writers_thread - threadSettingsType
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadSettings(p_aux0, participant_node.get()->rtps.async_writers_thread, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, DISCOVERY_SERVER_MATCHING_THREADS) == 0)
+        {
+            // discovery_server_matching_threads - threadSettingsType
+            if (XMLP_ret::XML_OK != getXMLThreadSettings(p_aux0,
+                    participant_node.get()->rtps.discovery_server_matching_threads, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             logError(XMLPARSER, "Invalid element found into 'rtpsParticipantAttributesType'. Name: " << name);
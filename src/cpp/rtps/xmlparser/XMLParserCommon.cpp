@@ -95,6 +95,7 @@ const char* PHYSICAL_PORT = "physical_port";
 const char* USER_DATA = "userData";
 const char* PART_ID = "participantID";
 const char* THROUGHPUT_CONT = "throughputController";
+const char* DESTINATION_THROUGHPUT_CONT = "destination_throughput_controller";
 const char* USER_TRANS = "userTransports";
 const char* USE_BUILTIN_TRANS = "useBuiltinTransports";
 const char* PROPERTIES_POLICY = "propertiesPolicy";
@@ -111,6 +112,19 @@ const char* DYNAMIC_LC = "dynamic";
 const char* MAX_PROPERTIES = "max_properties";
 const char* MAX_USER_DATA = "max_user_data";
 const char* MAX_PARTITIONS = "max_partitions";
+const char* EVENT_THREADS = "event_threads";
+const char* ISOLATE_BUILTIN_ENDPOINTS = "isolate_builtin_endpoints";
+const char* ASYNC_WRITER_THREADS = "async_writer_threads";
+const char* SCHEDULING_POLICY = "scheduling_policy";
+const char* PRIORITY = "priority";
+const char* AFFINITY = "affinity";
+const char* STACK_SIZE = "stack_size";
+const char* TIMED_EVENTS_THREAD = "timed_events_thread";
+const char* ASYNC_WRITERS_THREAD = "async_writers_thread";
+const char* DISCOVERY_SERVER_MATCHING_THREADS = "discovery_server_matching_threads";
+const char* BUILTIN_TRANSPORTS_RECEPTION_THREADS = "builtin_transports_reception_threads";
+const char* DEFAULT_RECEPTION_THREADS = "default_reception_threads";
+const char* THREAD_SETTINGS = "thread_settings";
 
 /// Publisher-subscriber attributes
 const char* TOPIC = "topic";
@@ -233,6 +247,11 @@ const char* DEPTH = "depth";
 const char* ALLOCATED_SAMPLES = "allocated_samples";
 const char* BYTES_PER_SECOND = "bytesPerPeriod";
 const char* PERIOD_MILLISECS = "periodMillisecs";
+const char* SCHEDULER = "scheduler";
+const char* FIFO = "FIFO";
+const char* ROUND_ROBIN = "ROUND_ROBIN";
+const char* HIGH_PRIORITY = "HIGH_PRIORITY";
+const char* EARLIEST_DEADLINE_FIRST = "EARLIEST_DEADLINE_FIRST";
 const char* PORT_BASE = "portBase";
 const char* DOMAIN_ID_GAIN = "domainIDGain";
 const char* PARTICIPANT_ID_GAIN = "participantIDGain";
@@ -0,0 +1,203 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PartitionMatcher.cpp
+ */
+
+#include <utils/PartitionMatcher.hpp>
+
+#include <fastrtps/utils/StringMatching.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+static bool is_pattern(
+        const std::string& name)
+{
+#if defined(_WIN32)
+    // PathMatchSpec ignores case, so even names without wildcards are left to it
+    static_cast<void>(name);
+    return true;
+#else
+    return name.find_first_of("*?[") != std::string::npos;
+#endif // if defined(_WIN32)
+}
+
+PartitionMatcher::PartitionMatcher(
+        const fastdds::dds::PartitionQosPolicy& partitions)
+{
+    for (auto it = partitions.begin(); it != partitions.end(); ++it)
+    {
+        empty_ = false;
+        if (it->size() == 0)
+        {
+            has_empty_entry_ = true;
+        }
+
+        std::string name(it->name());
+        if (is_pattern(name))
+        {
+            patterns_.emplace_back(name);
+        }
+        else
+        {
+            names_.insert(std::move(name));
+        }
+    }
+}
+
+bool PartitionMatcher::matches(
+        const PartitionMatcher& other) const
+{
+    // An empty list only matches another empty list, or a list with an entry without name
+    if (empty_ || other.empty_)
+    {
+        return (empty_ && other.empty_) || (empty_ && other.has_empty_entry_) || (other.empty_ && has_empty_entry_);
+    }
+
+    const std::unordered_set<std::string>& smaller = names_.size() <= other.names_.size() ? names_ : other.names_;
+    const std::unordered_set<std::string>& larger = names_.size() <= other.names_.size() ? other.names_ : names_;
+    for (const std::string& name : smaller)
+    {
+        if (larger.count(name) > 0)
+        {
+            return true;
+        }
+    }
+
+    if (match_names(patterns_, other.names_) || match_names(other.patterns_, names_))
+    {
+        return true;
+    }
+
+    // Any of two patterns may match the other one
+    for (const Glob& pattern : patterns_)
+    {
+        for (const Glob& other_pattern : other.patterns_)
+        {
+            if (pattern.matches(other_pattern.pattern()) || other_pattern.matches(pattern.pattern()))
+            {
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+bool PartitionMatcher::match_names(
+        const std::vector<Glob>& patterns,
+        const std::unordered_set<std::string>& names)
+{
+    for (const Glob& pattern : patterns)
+    {
+        for (const std::string& name : names)
+        {
+            if (pattern.matches(name))
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+PartitionMatcher::Glob::Glob(
+        const std::string& pattern)
+    : pattern_(pattern)
+{
+#if defined(_WIN32)
+    use_string_matching_ = true;
+#else
+    // Bracket expressions are rare on partition names
+    use_string_matching_ = pattern.find('[') != std::string::npos;
+#endif // if defined(_WIN32)
+
+    if (!use_string_matching_)
+    {
+        size_t start = 0;
+        size_t asterisk = pattern.find('*');
+        while (asterisk != std::string::npos)
+        {
+            segments_.push_back(pattern.substr(start, asterisk - start));
+            start = asterisk + 1;
+            asterisk = pattern.find('*', start);
+        }
+        segments_.push_back(pattern.substr(start));
+    }
+}
+
+bool PartitionMatcher::Glob::matches(
+        const std::string& str) const
+{
+    if (use_string_matching_)
+    {
+        return StringMatching::matchPattern(pattern_.c_str(), str.c_str());
+    }
+
+    const std::string& first = segments_.front();
+    if (segments_.size() == 1)
+    {
+        return first.size() == str.size() && segment_matches_at(first, str, 0);
+    }
+
+    // The first segment is a prefix and the last one a suffix, not overlapping
+    const std::string& last = segments_.back();
+    if (first.size() + last.size() > str.size() ||
+            !segment_matches_at(first, str, 0) ||
+            !segment_matches_at(last, str, str.size() - last.size()))
+    {
+        return false;
+    }
+
+    // Taking the earliest occurrence of each segment in between leaves the most room to the next ones
+    size_t pos = first.size();
+    size_t end = str.size() - last.size();
+    for (size_t i = 1; i + 1 < segments_.size(); ++i)
+    {
+        const std::string& segment = segments_[i];
+        while (pos + segment.size() <= end && !segment_matches_at(segment, str, pos))
+        {
+            ++pos;
+        }
+        if (pos + segment.size() > end)
+        {
+            return false;
+        }
+        pos += segment.size();
+    }
+
+    return true;
+}
+
+bool PartitionMatcher::Glob::segment_matches_at(
+        const std::string& segment,
+        const std::string& str,
+        size_t pos) const
+{
+    for (size_t i = 0; i < segment.size(); ++i)
+    {
+        if (segment[i] != '?' && segment[i] != str[pos + i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
@@ -0,0 +1,109 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file PartitionMatcher.hpp
+ */
+
+#ifndef UTILS_PARTITIONMATCHER_HPP
+#define UTILS_PARTITIONMATCHER_HPP
+
+#include <fastdds/dds/core/policy/QosPolicies.hpp>
+
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * List of partitions prepared to be matched against other lists many times.
+ *
+ * Names without wildcards are kept on a hash set, and patterns are split by their asterisks once, so matching does
+ * not allocate memory. The result is the same as calling StringMatching::matchString on every pair of names.
+ */
+class PartitionMatcher
+{
+public:
+
+    //! Constructs the matcher of an empty list of partitions.
+    PartitionMatcher() = default;
+
+    /**
+     * Constructor.
+     * @param partitions List of partition names, any of which may be a pattern.
+     */
+    explicit PartitionMatcher(
+            const fastdds::dds::PartitionQosPolicy& partitions);
+
+    /**
+     * Check whether the lists of partitions of a writer and a reader match.
+     * @param other Matcher of the partitions of the other endpoint.
+     * @return True when a name of one of the lists matches a name of the other one.
+     */
+    bool matches(
+            const PartitionMatcher& other) const;
+
+private:
+
+    class Glob
+    {
+    public:
+
+        explicit Glob(
+                const std::string& pattern);
+
+        bool matches(
+                const std::string& str) const;
+
+        const std::string& pattern() const
+        {
+            return pattern_;
+        }
+
+    private:
+
+        bool segment_matches_at(
+                const std::string& segment,
+                const std::string& str,
+                size_t pos) const;
+
+        std::string pattern_;
+        //! Parts of the pattern between asterisks, where '?' matches any character
+        std::vector<std::string> segments_;
+        //! Patterns not supported by the segments are matched by StringMatching
+        bool use_string_matching_ = false;
+    };
+
+    static bool match_names(
+            const std::vector<Glob>& patterns,
+            const std::unordered_set<std::string>& names);
+
+    //! Whether the list of partitions is empty
+    bool empty_ = true;
+    //! Whether the list has an entry without name
+    bool has_empty_entry_ = false;
+    //! Names without wildcards
+    std::unordered_set<std::string> names_;
+    //! Names with wildcards
+    std::vector<Glob> patterns_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif  // UTILS_PARTITIONMATCHER_HPP
@@ -0,0 +1,110 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Thread.hpp
+ */
+
+#ifndef UTILS_THREAD_HPP
+#define UTILS_THREAD_HPP
+
+#include <cstdint>
+#include <functional>
+
+#if !defined(_WIN32)
+#include <pthread.h>
+#endif // if !defined(_WIN32)
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Thread created by the library.
+ *
+ * It behaves like std::thread, but allows choosing the stack size of the thread when it is created. It is only
+ * used for threads kept inside the library, as public headers expose std::thread.
+ */
+class Thread
+{
+public:
+
+#if defined(_WIN32)
+    using native_handle_type = void*;
+#else
+    using native_handle_type = pthread_t;
+#endif // if defined(_WIN32)
+
+    //! Create an object not representing any thread.
+    Thread() = default;
+
+    /**
+     * Create a thread running a function.
+     * @param func Function run by the thread.
+     * @param stack_size Size of the stack of the thread in bytes. 0 means the default of the OS.
+     * @throw std::system_error when the thread could not be created.
+     */
+    Thread(
+            std::function<void()> func,
+            uint32_t stack_size);
+
+    Thread(
+            Thread&& other) noexcept;
+
+    //! Moving into a joinable thread terminates the program, as it happens with std::thread.
+    Thread& operator =(
+            Thread&& other) noexcept;
+
+    //! Destroying a joinable thread terminates the program, as it happens with std::thread.
+    ~Thread();
+
+    Thread(
+            const Thread&) = delete;
+
+    Thread& operator =(
+            const Thread&) = delete;
+
+    //! Whether the object represents a thread which has not been joined nor detached.
+    bool joinable() const
+    {
+        return joinable_;
+    }
+
+    //! Wait for the thread to finish.
+    void join();
+
+    //! Let the thread run on its own, releasing its resources when it finishes.
+    void detach();
+
+    //! Whether the thread is the one calling this method.
+    bool is_calling_thread() const;
+
+    //! Exchange the threads represented by two objects.
+    void swap(
+            Thread& other) noexcept;
+
+private:
+
+    native_handle_type native_handle_{};
+
+#if defined(_WIN32)
+    unsigned long thread_id_ = 0;
+#endif // if defined(_WIN32)
+
+    bool joinable_ = false;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // UTILS_THREAD_HPP
@@ -0,0 +1,187 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LockFreeBoundedQueue.hpp
+ */
+
+#ifndef FASTRTPS_UTILS_COLLECTIONS_LOCKFREEBOUNDEDQUEUE_HPP_
+#define FASTRTPS_UTILS_COLLECTIONS_LOCKFREEBOUNDEDQUEUE_HPP_
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace eprosima {
+namespace fastrtps {
+
+/**
+ * Bounded queue with multiple producers and multiple consumers, none of them taking a lock.
+ *
+ * Each cell keeps a sequence telling whether it is ready to be filled or emptied on the current lap, so elements
+ * are never read before being completely written, and a cell reused by another thread is detected without the ABA
+ * problem of a linked stack.
+ *
+ * Intended for small, trivially copyable elements, like pointers.
+ */
+template<typename T>
+class LockFreeBoundedQueue
+{
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param capacity Maximum number of elements. Rounded up to a power of two.
+     */
+    explicit LockFreeBoundedQueue(
+            size_t capacity)
+        : mask_(round_up_to_power_of_two(capacity) - 1u)
+        , cells_(new Cell[mask_ + 1u])
+        , enqueue_pos_(0)
+        , dequeue_pos_(0)
+    {
+        for (size_t i = 0; i <= mask_; ++i)
+        {
+            cells_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    LockFreeBoundedQueue(
+            const LockFreeBoundedQueue&) = delete;
+
+    LockFreeBoundedQueue& operator =(
+            const LockFreeBoundedQueue&) = delete;
+
+    /**
+     * Add an element at the end of the queue.
+     *
+     * @param value Element to add.
+     * @return true when added, false when the queue is full.
+     */
+    bool try_push(
+            const T& value)
+    {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (0 == diff)
+            {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    cell.value = value;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Take the element at the front of the queue.
+     *
+     * @param [out] value Element taken.
+     * @return true when taken, false when the queue is empty.
+     */
+    bool try_pop(
+            T& value)
+    {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;)
+        {
+            Cell& cell = cells_[pos & mask_];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (0 == diff)
+            {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    value = cell.value;
+                    cell.sequence.store(pos + mask_ + 1u, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false;
+            }
+            else
+            {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * Number of elements on the queue.
+     *
+     * Only exact when no other thread is using the queue.
+     */
+    size_t size() const
+    {
+        size_t dequeued = dequeue_pos_.load(std::memory_order_acquire);
+        size_t enqueued = enqueue_pos_.load(std::memory_order_acquire);
+        return enqueued > dequeued ? enqueued - dequeued : 0u;
+    }
+
+    //! @return Maximum number of elements on the queue.
+    size_t capacity() const
+    {
+        return mask_ + 1u;
+    }
+
+private:
+
+    struct Cell
+    {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    static size_t round_up_to_power_of_two(
+            size_t value)
+    {
+        size_t ret = 2u;
+        while (ret < value)
+        {
+            ret <<= 1;
+        }
+        return ret;
+    }
+
+    size_t mask_;
+    std::unique_ptr<Cell[]> cells_;
+
+    //! Next position to fill
+    std::atomic<size_t> enqueue_pos_;
+    //! Next position to empty
+    std::atomic<size_t> dequeue_pos_;
+};
+
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif /* FASTRTPS_UTILS_COLLECTIONS_LOCKFREEBOUNDEDQUEUE_HPP_ */
@@ -0,0 +1,153 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file numa.cpp
+ */
+
+#include <utils/numa.hpp>
+
+#include <cstdlib>
+#include <cstring>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+namespace eprosima {
+
+int32_t parse_numa_node(
+        const std::string& value)
+{
+    if (value == "auto")
+    {
+        return current_numa_node();
+    }
+
+    char* end = nullptr;
+    long node = std::strtol(value.c_str(), &end, 10);
+    if (value.empty() || *end != '\0' || node < 0 || node > INT32_MAX)
+    {
+        return unknown_numa_node;
+    }
+    return static_cast<int32_t>(node);
+}
+
+#if defined(__linux__) && defined(SYS_getcpu) && defined(SYS_mbind)
+
+int32_t current_numa_node()
+{
+    unsigned int cpu = 0;
+    unsigned int node = 0;
+    if (0 != syscall(SYS_getcpu, &cpu, &node, nullptr))
+    {
+        return unknown_numa_node;
+    }
+    return static_cast<int32_t>(node);
+}
+
+size_t round_up_to_page_size(
+        size_t size)
+{
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return (size + page_size - 1u) & ~(page_size - 1u);
+}
+
+void* allocate_page_aligned_memory(
+        size_t size)
+{
+    size_t aligned_size = round_up_to_page_size(size);
+    void* address = nullptr;
+    if (0 != posix_memalign(&address, static_cast<size_t>(sysconf(_SC_PAGESIZE)), aligned_size))
+    {
+        return nullptr;
+    }
+
+    memset(address, 0, aligned_size);
+    return address;
+}
+
+void free_page_aligned_memory(
+        void* address)
+{
+    free(address);
+}
+
+bool bind_memory_to_numa_node(
+        void* address,
+        size_t size,
+        int32_t numa_node)
+{
+    // Values from linux/mempolicy.h, which may not be installed
+    constexpr int mpol_preferred = 1;
+    constexpr unsigned int mpol_mf_move = 1u << 1;
+    constexpr size_t bits_per_mask_word = sizeof(unsigned long) * 8u;
+    constexpr int32_t max_numa_node = 63;
+
+    if (numa_node < 0 || numa_node > max_numa_node)
+    {
+        return false;
+    }
+
+    uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(address) + page_size - 1u) & ~(page_size - 1u);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(address) + size) & ~(page_size - 1u);
+    if (begin >= end)
+    {
+        return true;
+    }
+
+    unsigned long node_mask[(max_numa_node + 1) / bits_per_mask_word + 1] = {};
+    node_mask[numa_node / bits_per_mask_word] = 1ul << (numa_node % bits_per_mask_word);
+    return 0 == syscall(SYS_mbind, begin, end - begin, mpol_preferred, node_mask, max_numa_node + 2, mpol_mf_move);
+}
+
+#else
+
+int32_t current_numa_node()
+{
+    return unknown_numa_node;
+}
+
+size_t round_up_to_page_size(
+        size_t size)
+{
+    // Memory is never placed, so there is no need to waste the end of the last page
+    return size;
+}
+
+void* allocate_page_aligned_memory(
+        size_t size)
+{
+    return calloc(size, 1u);
+}
+
+void free_page_aligned_memory(
+        void* address)
+{
+    free(address);
+}
+
+bool bind_memory_to_numa_node(
+        void* /*address*/,
+        size_t /*size*/,
+        int32_t /*numa_node*/)
+{
+    return false;
+}
+
+#endif // if defined(__linux__) && defined(SYS_getcpu) && defined(SYS_mbind)
+
+} // namespace eprosima
@@ -0,0 +1,91 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file numa.hpp
+ */
+
+#ifndef UTILS_NUMA_HPP
+#define UTILS_NUMA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace eprosima {
+
+//! Value used when the NUMA node is unknown or irrelevant.
+constexpr int32_t unknown_numa_node = -1;
+
+/**
+ * Get the NUMA node of the CPU the calling thread is running on.
+ *
+ * @return the NUMA node, or unknown_numa_node when the platform does not tell it.
+ */
+int32_t current_numa_node();
+
+/**
+ * Parse the NUMA node configured on an endpoint.
+ *
+ * @param value Either the number of a node, or "auto" to use the node of the calling thread.
+ * @return the NUMA node, or unknown_numa_node when the value is not valid.
+ */
+int32_t parse_numa_node(
+        const std::string& value);
+
+/**
+ * Allocate a zeroed block of memory made of whole pages, so it can be placed on a NUMA node as a whole.
+ *
+ * @param size Size of the block in bytes. The block takes round_up_to_page_size(size) bytes.
+ * @return Beginning of the block, or nullptr when it could not be allocated. Should be released with
+ * free_page_aligned_memory.
+ */
+void* allocate_page_aligned_memory(
+        size_t size);
+
+/**
+ * Release a block allocated with allocate_page_aligned_memory.
+ *
+ * @param address Beginning of the block. May be nullptr.
+ */
+void free_page_aligned_memory(
+        void* address);
+
+/**
+ * @return The size rounded up to a multiple of the page size, on platforms supporting NUMA placement. The size
+ * itself otherwise.
+ */
+size_t round_up_to_page_size(
+        size_t size);
+
+/**
+ * Ask the kernel to place a block of memory on a NUMA node, moving the pages already touched.
+ *
+ * Only the pages completely inside the block are moved, so memory from other allocations sharing its first and
+ * last pages is not affected. Blocks allocated with allocate_page_aligned_memory are made of whole pages, so they
+ * are placed completely. Smaller blocks keep the placement decided by the thread that first touched them.
+ *
+ * @param address Beginning of the block.
+ * @param size Size of the block in bytes.
+ * @param numa_node NUMA node where the memory should be.
+ * @return true when the placement was applied or there were no whole pages to place, false otherwise.
+ */
+bool bind_memory_to_numa_node(
+        void* address,
+        size_t size,
+        int32_t numa_node);
+
+} // namespace eprosima
+
+#endif  // UTILS_NUMA_HPP
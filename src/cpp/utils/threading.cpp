@@ -0,0 +1,359 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file threading.cpp
+ */
+
+#include <utils/threading.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <exception>
+#include <memory>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#if defined(_WIN32)
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <string.h>
+#endif // if defined(_WIN32)
+
+namespace eprosima {
+
+using ThreadSettings = fastdds::rtps::ThreadSettings;
+using Thread = fastrtps::Thread;
+
+namespace fastrtps {
+
+Thread::Thread(
+        Thread&& other) noexcept
+{
+    swap(other);
+}
+
+Thread& Thread::operator =(
+        Thread&& other) noexcept
+{
+    if (joinable_)
+    {
+        std::terminate();
+    }
+    swap(other);
+    return *this;
+}
+
+Thread::~Thread()
+{
+    if (joinable_)
+    {
+        std::terminate();
+    }
+}
+
+void Thread::swap(
+        Thread& other) noexcept
+{
+    std::swap(native_handle_, other.native_handle_);
+#if defined(_WIN32)
+    std::swap(thread_id_, other.thread_id_);
+#endif // if defined(_WIN32)
+    std::swap(joinable_, other.joinable_);
+}
+
+#if defined(_WIN32)
+
+static unsigned __stdcall thread_start(
+        void* arg)
+{
+    std::unique_ptr<std::function<void()>> func(static_cast<std::function<void()>*>(arg));
+    (*func)();
+    return 0;
+}
+
+Thread::Thread(
+        std::function<void()> func,
+        uint32_t stack_size)
+{
+    std::function<void()>* arg = new std::function<void()>(std::move(func));
+    unsigned thread_id = 0;
+    uintptr_t handle = _beginthreadex(nullptr, stack_size, thread_start, arg, STACK_SIZE_PARAM_IS_A_RESERVATION,
+                    &thread_id);
+    if (0 == handle)
+    {
+        delete arg;
+        throw std::system_error(errno, std::generic_category());
+    }
+
+    native_handle_ = reinterpret_cast<native_handle_type>(handle);
+    thread_id_ = thread_id;
+    joinable_ = true;
+}
+
+void Thread::join()
+{
+    if (!joinable_ || is_calling_thread())
+    {
+        throw std::system_error(std::make_error_code(std::errc::invalid_argument));
+    }
+    WaitForSingleObject(native_handle_, INFINITE);
+    CloseHandle(native_handle_);
+    joinable_ = false;
+}
+
+void Thread::detach()
+{
+    if (!joinable_)
+    {
+        throw std::system_error(std::make_error_code(std::errc::invalid_argument));
+    }
+    CloseHandle(native_handle_);
+    joinable_ = false;
+}
+
+bool Thread::is_calling_thread() const
+{
+    return joinable_ && GetCurrentThreadId() == thread_id_;
+}
+
+#else
+
+static void* thread_start(
+        void* arg)
+{
+    std::unique_ptr<std::function<void()>> func(static_cast<std::function<void()>*>(arg));
+    (*func)();
+    return nullptr;
+}
+
+Thread::Thread(
+        std::function<void()> func,
+        uint32_t stack_size)
+{
+    pthread_attr_t attr;
+    int result = pthread_attr_init(&attr);
+    if (0 != result)
+    {
+        throw std::system_error(result, std::generic_category());
+    }
+
+    if (0 != stack_size)
+    {
+        result = pthread_attr_setstacksize(&attr, stack_size);
+    }
+
+    std::function<void()>* arg = new std::function<void()>(std::move(func));
+    if (0 == result)
+    {
+        result = pthread_create(&native_handle_, &attr, thread_start, arg);
+    }
+    pthread_attr_destroy(&attr);
+
+    if (0 != result)
+    {
+        delete arg;
+        throw std::system_error(result, std::generic_category());
+    }
+    joinable_ = true;
+}
+
+void Thread::join()
+{
+    if (!joinable_ || is_calling_thread())
+    {
+        throw std::system_error(std::make_error_code(std::errc::invalid_argument));
+    }
+    pthread_join(native_handle_, nullptr);
+    joinable_ = false;
+}
+
+void Thread::detach()
+{
+    if (!joinable_)
+    {
+        throw std::system_error(std::make_error_code(std::errc::invalid_argument));
+    }
+    pthread_detach(native_handle_);
+    joinable_ = false;
+}
+
+bool Thread::is_calling_thread() const
+{
+    return joinable_ && 0 != pthread_equal(native_handle_, pthread_self());
+}
+
+#endif // if defined(_WIN32)
+
+} // namespace fastrtps
+
+Thread create_thread(
+        std::function<void()> func,
+        const ThreadSettings& settings,
+        const char* thread_name)
+{
+    std::string name(thread_name);
+    std::function<void()> start = [func, settings, name]()
+            {
+                apply_thread_settings_to_current_thread(name.c_str(), settings);
+                func();
+            };
+
+    if (0 != settings.stack_size)
+    {
+        try
+        {
+            return Thread(start, settings.stack_size);
+        }
+        catch (const std::system_error& e)
+        {
+            logWarning(SYSTEM, "Could not set stack size " << settings.stack_size << " on thread '" << name
+                                                           << "': " << e.what());
+        }
+    }
+
+    return Thread(start, 0);
+}
+
+std::thread create_std_thread(
+        std::function<void()> func,
+        const ThreadSettings& settings,
+        const char* thread_name)
+{
+    std::string name(thread_name);
+    if (0 != settings.stack_size)
+    {
+        logWarning(SYSTEM, "Stack size cannot be set on thread '" << name << "', using the default one");
+    }
+
+    return std::thread([func, settings, name]()
+                   {
+                       apply_thread_settings_to_current_thread(name.c_str(), settings);
+                       func();
+                   });
+}
+
+#if defined(_WIN32)
+
+bool apply_thread_settings_to_current_thread(
+        const char* thread_name,
+        const ThreadSettings& settings)
+{
+    bool ret = true;
+    HANDLE thread = GetCurrentThread();
+
+    if (ThreadSettings::default_priority != settings.priority)
+    {
+        if (0 == SetThreadPriority(thread, settings.priority))
+        {
+            logWarning(SYSTEM, "Could not set priority " << settings.priority << " on thread '" << thread_name
+                                                         << "'. Error code: " << GetLastError());
+            ret = false;
+        }
+    }
+
+    if (0 != settings.affinity)
+    {
+        if (0 == SetThreadAffinityMask(thread, static_cast<DWORD_PTR>(settings.affinity)))
+        {
+            logWarning(SYSTEM, "Could not set affinity " << settings.affinity << " on thread '" << thread_name
+                                                         << "'. Error code: " << GetLastError());
+            ret = false;
+        }
+    }
+
+    return ret;
+}
+
+#else
+
+bool apply_thread_settings_to_current_thread(
+        const char* thread_name,
+        const ThreadSettings& settings)
+{
+    bool ret = true;
+    pthread_t thread = pthread_self();
+
+    if (settings.scheduling_policy >= 0 || ThreadSettings::default_priority != settings.priority)
+    {
+        // Only the values given in the settings are changed
+        int policy = 0;
+        sched_param param;
+        int result = pthread_getschedparam(thread, &policy, &param);
+        if (0 == result)
+        {
+            if (settings.scheduling_policy >= 0)
+            {
+                policy = settings.scheduling_policy;
+            }
+            if (ThreadSettings::default_priority != settings.priority)
+            {
+                param.sched_priority = settings.priority;
+            }
+            else if (param.sched_priority < sched_get_priority_min(policy) ||
+                    param.sched_priority > sched_get_priority_max(policy))
+            {
+                // The current priority is not valid for the new policy (e.g. 0 when going from SCHED_OTHER to
+                // SCHED_FIFO), so the lowest one of the policy is used
+                param.sched_priority = sched_get_priority_min(policy);
+            }
+            result = pthread_setschedparam(thread, policy, &param);
+        }
+
+        if (0 != result)
+        {
+            logWarning(SYSTEM, "Could not set scheduling policy " << policy << " with priority "
+                                                                  << param.sched_priority << " on thread '" << thread_name
+                                                                  << "': " << strerror(result));
+            ret = false;
+        }
+    }
+
+    if (0 != settings.affinity)
+    {
+#if defined(__linux__) && !defined(__ANDROID__)
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (int cpu = 0; cpu < 64 && cpu < CPU_SETSIZE; ++cpu)
+        {
+            if (0 != (settings.affinity & (static_cast<uint64_t>(1) << cpu)))
+            {
+                CPU_SET(cpu, &cpu_set);
+            }
+        }
+
+        int result = pthread_setaffinity_np(thread, sizeof(cpu_set), &cpu_set);
+        if (0 != result)
+        {
+            logWarning(SYSTEM, "Could not set affinity " << settings.affinity << " on thread '" << thread_name
+                                                         << "': " << strerror(result));
+            ret = false;
+        }
+#else
+        logWarning(SYSTEM, "Thread affinity is not supported on this platform. Ignored on thread '"
+                << thread_name << "'");
+        ret = false;
+#endif // if defined(__linux__) && !defined(__ANDROID__)
+    }
+
+    return ret;
+}
+
+#endif // if defined(_WIN32)
+
+} // namespace eprosima
@@ -0,0 +1,80 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file threading.hpp
+ */
+
+#ifndef UTILS_THREADING_HPP
+#define UTILS_THREADING_HPP
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <utils/Thread.hpp>
+
+#include <functional>
+#include <thread>
+
+namespace eprosima {
+
+/**
+ * Apply thread settings to the calling thread.
+ *
+ * Settings that cannot be applied are reported with a warning, and the thread keeps running with the settings
+ * it had.
+ *
+ * @param thread_name Name identifying the thread on the warnings.
+ * @param settings Settings to apply.
+ * @return true when all the settings were applied, false otherwise.
+ */
+bool apply_thread_settings_to_current_thread(
+        const char* thread_name,
+        const fastdds::rtps::ThreadSettings& settings);
+
+/**
+ * Create a thread with the given settings.
+ *
+ * The stack size is set when the thread is created, falling back to the default of the OS with a warning when it
+ * cannot be used. The rest of the settings are applied by the new thread before running the function.
+ *
+ * @param func Function run by the thread.
+ * @param settings Settings of the thread.
+ * @param thread_name Name identifying the thread on the warnings.
+ * @return The thread created.
+ * @throw std::system_error when the thread could not be created.
+ */
+fastrtps::Thread create_thread(
+        std::function<void()> func,
+        const fastdds::rtps::ThreadSettings& settings,
+        const char* thread_name);
+
+/**
+ * Create a std::thread with the given settings, for threads held by classes of the public API.
+ *
+ * The settings are applied by the new thread before running the function. The stack size of a std::thread cannot
+ * be chosen, so a stack size in the settings is reported with a warning and the default of the OS is used.
+ *
+ * @param func Function run by the thread.
+ * @param settings Settings of the thread.
+ * @param thread_name Name identifying the thread on the warnings.
+ * @return The thread created.
+ * @throw std::system_error when the thread could not be created.
+ */
+std::thread create_std_thread(
+        std::function<void()> func,
+        const fastdds::rtps::ThreadSettings& settings,
+        const char* thread_name);
+
+} // namespace eprosima
+
+#endif  // UTILS_THREADING_HPP
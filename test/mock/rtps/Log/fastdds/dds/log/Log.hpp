@@ -20,6 +20,8 @@
 #include <memory>
 #include <gmock/gmock.h>
 
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
 /**
  * eProsima log mock.
  */
@@ -81,6 +83,13 @@ public:
         ClearConsumersFunc();
     }
 
+    static std::function<void(const fastdds::rtps::ThreadSettings&)> SetThreadConfigFunc;
+    static void SetThreadConfig(
+            const fastdds::rtps::ThreadSettings& settings)
+    {
+        SetThreadConfigFunc(settings);
+    }
+
 };
 
 using ::testing::_;
@@ -99,6 +108,8 @@ public:
     MOCK_METHOD1(RegisterConsumer, void(std::unique_ptr<LogConsumer>&));
 
     MOCK_METHOD0(ClearConsumers, void());
+
+    MOCK_METHOD1(SetThreadConfig, void(const fastdds::rtps::ThreadSettings&));
 };
 
 } // namespace dds
@@ -76,6 +76,9 @@ public:
             const GUID_t& writer,
             WriterProxyData& wdata));
 
+    MOCK_CONST_METHOD1(find_participant_proxy, ParticipantProxyData*(
+            const GuidPrefix_t& guid_prefix));
+
     MOCK_METHOD0(ParticipantProxiesBegin, ResourceLimitedVector<ParticipantProxyData*>::const_iterator());
 
     MOCK_METHOD0(ParticipantProxiesEnd, ResourceLimitedVector<ParticipantProxyData*>::const_iterator());
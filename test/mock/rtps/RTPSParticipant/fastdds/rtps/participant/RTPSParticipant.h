@@ -115,6 +115,12 @@ public:
         return mp_event_thr;
     }
 
+    ResourceEvent& get_resource_event(
+            const GUID_t& /*endpoint_guid*/)
+    {
+        return mp_event_thr;
+    }
+
     MOCK_CONST_METHOD0(typelookup_manager, fastdds::dds::builtin::TypeLookupManager* ());
 
     MOCK_METHOD3(registerWriter, bool(
@@ -51,6 +51,7 @@ class ReaderHistory;
 class WriterListener;
 class ReaderListener;
 class PDPSimple;
+class FlowController;
 struct EntityId_t;
 
 class MockParticipantListener : public RTPSParticipantListener
@@ -224,6 +225,12 @@ public:
         return events_;
     }
 
+    ResourceEvent& getEventResource(
+            const GUID_t& /*endpoint_guid*/)
+    {
+        return events_;
+    }
+
     void set_endpoint_rtps_protection_supports(
             Endpoint* /*endpoint*/,
             bool /*support*/)
@@ -253,6 +260,11 @@ public:
         return attr_;
     }
 
+    std::vector<FlowController*>& getFlowControllers()
+    {
+        return controllers_;
+    }
+
 private:
 
     MockParticipantListener listener_;
@@ -260,6 +272,8 @@ private:
     ResourceEvent events_;
 
     RTPSParticipantAttributes attr_;
+
+    std::vector<FlowController*> controllers_;
 };
 
 } // namespace rtps
@@ -130,6 +130,11 @@ public:
         return true;
     }
 
+    virtual void intraprocess_messages_processed(
+            const GUID_t&)
+    {
+    }
+
     virtual bool change_removed_by_history(
             CacheChange_t*,
             WriterProxy*)
@@ -37,6 +37,8 @@ class RTPSParticipantImpl;
 
 class RTPSWriter : public Endpoint
 {
+    friend class AsyncInterestTree;
+
 public:
 
     virtual ~RTPSWriter() = default;
@@ -131,6 +133,11 @@ public:
         return true;
     }
 
+    virtual bool has_remote_destinations() const
+    {
+        return true;
+    }
+
     virtual bool process_acknack(
             const GUID_t& writer_guid,
             const GUID_t& reader_guid,
@@ -167,6 +174,10 @@ public:
 
     LivelinessLostStatus liveliness_lost_status_;
 
+private:
+
+    RTPSWriter* next_[2] = { nullptr, nullptr };
+
 };
 
 } // namespace rtps
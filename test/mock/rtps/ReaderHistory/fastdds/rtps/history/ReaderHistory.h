@@ -43,6 +43,11 @@ public:
     {
     }
 
+    virtual ~ReaderHistory() = default;
+
+    using iterator = std::vector<CacheChange_t*>::iterator;
+    using const_iterator = std::vector<CacheChange_t*>::const_iterator;
+
     // *INDENT-OFF* Uncrustify makes a mess with MOCK_METHOD macros
     MOCK_METHOD1(remove_change_mock, bool(CacheChange_t*));
 
@@ -73,6 +78,18 @@ public:
         return ret;
     }
 
+    virtual iterator remove_change_nts(
+            const_iterator removal,
+            bool /*release*/ = true)
+    {
+        return m_changes.erase(removal);
+    }
+
+    iterator changesEnd()
+    {
+        return m_changes.end();
+    }
+
     inline RecursiveTimedMutex* getMutex()
     {
         return mp_mutex;
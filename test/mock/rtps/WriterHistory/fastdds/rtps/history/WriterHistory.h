@@ -50,7 +50,10 @@ public:
     {
     }
 
+    virtual ~WriterHistory() = default;
+
     using iterator = std::vector<CacheChange_t*>::iterator;
+    using const_iterator = std::vector<CacheChange_t*>::const_iterator;
 
     // *INDENT-OFF* Uncrustify makes a mess with MOCK_METHOD macros
     MOCK_METHOD1(add_change_mock, bool(CacheChange_t*));
@@ -105,6 +108,13 @@ public:
         return ret;
     }
 
+    virtual iterator remove_change_nts(
+            const_iterator removal,
+            bool /*release*/ = true)
+    {
+        return m_changes.erase(removal);
+    }
+
     void wait_for_more_samples_than(
             unsigned int minimum)
     {
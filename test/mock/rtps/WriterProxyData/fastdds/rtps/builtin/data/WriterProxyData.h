@@ -221,7 +221,7 @@ public:
 
     bool has_type_information () const
     {
-        return false;
+        return type_info_.assigned();
     }
 
     void type_information(
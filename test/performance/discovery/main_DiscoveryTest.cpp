@@ -0,0 +1,350 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DiscoveryTest.cpp
+ *
+ * Measures the time it takes a number of participants, each one with a number of endpoints spread over several
+ * topics, to discover each other and match all their endpoints.
+ */
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/DataWriterListener.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::rtps;
+
+/**
+ * Type of the topics. No data is ever published, so it does not need to serialize anything.
+ */
+class DiscoveryTestType : public TopicDataType
+{
+public:
+
+    DiscoveryTestType()
+    {
+        setName("DiscoveryTestType");
+        m_typeSize = 4;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void*,
+            SerializedPayload_t* payload) override
+    {
+        payload->length = 0;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t*,
+            void*) override
+    {
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*) override
+    {
+        return []() -> uint32_t
+               {
+                   return 4;
+               };
+    }
+
+    void* createData() override
+    {
+        return new uint32_t(0);
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<uint32_t*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+/**
+ * Counts the matches of all the endpoints, and wakes up the main thread when all the expected ones happened.
+ */
+class MatchCounter : public DataWriterListener, public DataReaderListener
+{
+public:
+
+    explicit MatchCounter(
+            int64_t expected)
+        : expected_(expected)
+    {
+    }
+
+    void on_publication_matched(
+            DataWriter*,
+            const PublicationMatchedStatus& info) override
+    {
+        add(info.current_count_change);
+    }
+
+    void on_subscription_matched(
+            DataReader*,
+            const SubscriptionMatchedStatus& info) override
+    {
+        add(info.current_count_change);
+    }
+
+    bool wait_all(
+            std::chrono::seconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this]()
+                       {
+                           return matched_ >= expected_;
+                       });
+    }
+
+    int64_t matched()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return matched_;
+    }
+
+private:
+
+    void add(
+            int32_t change)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        matched_ += change;
+        if (matched_ >= expected_)
+        {
+            cv_.notify_all();
+        }
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int64_t matched_ = 0;
+    int64_t expected_;
+};
+
+struct ParticipantEntities
+{
+    DomainParticipant* participant = nullptr;
+    Publisher* publisher = nullptr;
+    Subscriber* subscriber = nullptr;
+    std::vector<Topic*> topics;
+    std::vector<DataWriter*> writers;
+    std::vector<DataReader*> readers;
+};
+
+static void usage()
+{
+    std::cout << "Usage: DiscoveryTest [--participants <n>] [--endpoints <n>] [--topics <n>] [--timeout <seconds>]"
+              << " [--domain <id>] [--property <name>=<value>]..." << std::endl;
+    std::cout << "Each participant creates <endpoints> endpoints, alternating writers and readers, spread over"
+              << " <topics> topics." << std::endl;
+    std::cout << "Properties are added to all the participants, to compare discovery settings." << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_participants = 10;
+    uint32_t num_endpoints = 100;
+    uint32_t num_topics = 50;
+    uint32_t timeout = 60;
+    uint32_t domain = 0;
+    DomainParticipantQos participant_qos = PARTICIPANT_QOS_DEFAULT;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return -1;
+        }
+
+        if (arg == "--property")
+        {
+            std::string property(argv[++i]);
+            size_t separator = property.find('=');
+            if (separator == std::string::npos)
+            {
+                usage();
+                return -1;
+            }
+            participant_qos.properties().properties().emplace_back(property.substr(0, separator),
+                    property.substr(separator + 1));
+            continue;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--participants")
+        {
+            num_participants = value;
+        }
+        else if (arg == "--endpoints")
+        {
+            num_endpoints = value;
+        }
+        else if (arg == "--topics")
+        {
+            num_topics = value;
+        }
+        else if (arg == "--timeout")
+        {
+            timeout = value;
+        }
+        else if (arg == "--domain")
+        {
+            domain = value;
+        }
+        else
+        {
+            usage();
+            return -1;
+        }
+    }
+
+    if (num_participants == 0 || num_endpoints == 0 || num_topics == 0)
+    {
+        usage();
+        return -1;
+    }
+
+    // Endpoint j of every participant is a writer when j is even, and a reader otherwise, on topic (j / 2) % topics.
+    // Each writer matches every reader on its topic, on all the participants, its own included, and both sides of
+    // each match are counted.
+    std::vector<int64_t> writers_per_topic(num_topics, 0);
+    std::vector<int64_t> readers_per_topic(num_topics, 0);
+    for (uint32_t j = 0; j < num_endpoints; ++j)
+    {
+        std::vector<int64_t>& count = (j % 2 == 0) ? writers_per_topic : readers_per_topic;
+        count[(j / 2) % num_topics] += num_participants;
+    }
+    int64_t expected = 0;
+    for (uint32_t t = 0; t < num_topics; ++t)
+    {
+        expected += 2 * writers_per_topic[t] * readers_per_topic[t];
+    }
+
+    MatchCounter counter(expected);
+    TypeSupport type(new DiscoveryTestType());
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    std::vector<ParticipantEntities> entities(num_participants);
+
+    auto initial_time = std::chrono::steady_clock::now();
+    for (ParticipantEntities& e : entities)
+    {
+        e.participant = factory->create_participant(domain, participant_qos);
+        if (e.participant == nullptr)
+        {
+            std::cout << "Error creating participant" << std::endl;
+            return -1;
+        }
+        type.register_type(e.participant);
+        e.publisher = e.participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+        e.subscriber = e.participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+
+        for (uint32_t t = 0; t < num_topics; ++t)
+        {
+            e.topics.push_back(e.participant->create_topic("DiscoveryTest_" + std::to_string(t), type.get_type_name(),
+                    TOPIC_QOS_DEFAULT));
+        }
+
+        for (uint32_t j = 0; j < num_endpoints; ++j)
+        {
+            Topic* topic = e.topics[(j / 2) % num_topics];
+            if (j % 2 == 0)
+            {
+                e.writers.push_back(e.publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT, &counter));
+            }
+            else
+            {
+                e.readers.push_back(e.subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT, &counter));
+            }
+        }
+    }
+    auto created_time = std::chrono::steady_clock::now();
+
+    bool all_matched = counter.wait_all(std::chrono::seconds(timeout));
+    auto final_time = std::chrono::steady_clock::now();
+
+    std::cout << "Participants: " << num_participants << ", endpoints per participant: " << num_endpoints
+              << ", topics: " << num_topics << std::endl;
+    std::cout << "Creation time: "
+              << std::chrono::duration_cast<std::chrono::milliseconds>(created_time - initial_time).count()
+              << " ms" << std::endl;
+    if (all_matched)
+    {
+        std::cout << "Time to full match: "
+                  << std::chrono::duration_cast<std::chrono::milliseconds>(final_time - initial_time).count()
+                  << " ms" << std::endl;
+    }
+    else
+    {
+        std::cout << "Only " << counter.matched() << " of " << expected << " matches after " << timeout
+                  << " seconds" << std::endl;
+    }
+
+    for (ParticipantEntities& e : entities)
+    {
+        for (DataWriter* writer : e.writers)
+        {
+            e.publisher->delete_datawriter(writer);
+        }
+        for (DataReader* reader : e.readers)
+        {
+            e.subscriber->delete_datareader(reader);
+        }
+        e.participant->delete_publisher(e.publisher);
+        e.participant->delete_subscriber(e.subscriber);
+        for (Topic* topic : e.topics)
+        {
+            e.participant->delete_topic(topic);
+        }
+        factory->delete_participant(e.participant);
+    }
+
+    return all_matched ? 0 : -1;
+}
@@ -0,0 +1,162 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_PayloadPoolTest.cpp
+ *
+ * Measures the throughput of getting and releasing payloads from a topic payload pool shared by several threads,
+ * as happens when many writers on the same topic publish concurrently.
+ */
+
+#include <rtps/history/TopicPayloadPool.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+static void usage()
+{
+    std::cout << "Usage: PayloadPoolTest [--max_threads <n>] [--iterations <n>] [--payload_size <bytes>]"
+              << std::endl;
+}
+
+/**
+ * Run a number of threads getting and releasing payloads from the same pool.
+ *
+ * @return Operations per second, counting a get and its release as one operation.
+ */
+static double measure(
+        ITopicPayloadPool& pool,
+        uint32_t num_threads,
+        uint32_t iterations,
+        uint32_t payload_size)
+{
+    std::atomic<uint32_t> ready(0);
+    std::atomic<bool> start(false);
+    std::atomic<uint64_t> failures(0);
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < num_threads; ++i)
+    {
+        threads.emplace_back([&]()
+                {
+                    CacheChange_t change;
+                    ++ready;
+                    while (!start.load())
+                    {
+                        std::this_thread::yield();
+                    }
+
+                    for (uint32_t n = 0; n < iterations; ++n)
+                    {
+                        if (!pool.get_payload(payload_size, change))
+                        {
+                            ++failures;
+                            continue;
+                        }
+                        change.serializedPayload.data[0] = static_cast<octet>(n);
+                        pool.release_payload(change);
+                    }
+                });
+    }
+
+    while (ready.load() < num_threads)
+    {
+        std::this_thread::yield();
+    }
+
+    auto initial_time = std::chrono::steady_clock::now();
+    start.store(true);
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+    auto final_time = std::chrono::steady_clock::now();
+
+    if (failures.load() > 0)
+    {
+        std::cout << "Failed to get " << failures.load() << " payloads" << std::endl;
+    }
+
+    double seconds = std::chrono::duration<double>(final_time - initial_time).count();
+    return static_cast<double>(num_threads) * iterations / seconds;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t max_threads = 32;
+    uint32_t iterations = 1000000;
+    uint32_t payload_size = 1024;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return -1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--max_threads")
+        {
+            max_threads = value;
+        }
+        else if (arg == "--iterations")
+        {
+            iterations = value;
+        }
+        else if (arg == "--payload_size")
+        {
+            payload_size = value;
+        }
+        else
+        {
+            usage();
+            return -1;
+        }
+    }
+
+    if (max_threads == 0 || payload_size == 0)
+    {
+        usage();
+        return -1;
+    }
+
+    std::cout << std::setw(10) << "Threads" << std::setw(20) << "Operations/s" << std::endl;
+    for (uint32_t num_threads = 1; num_threads <= max_threads; num_threads *= 2)
+    {
+        // Each thread holds at most one payload at a time
+        PoolConfig config{ PREALLOCATED_WITH_REALLOC_MEMORY_MODE, payload_size, num_threads, 0 };
+        std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+        pool->reserve_history(config, false);
+
+        double throughput = measure(*pool, num_threads, iterations, payload_size);
+        std::cout << std::setw(10) << num_threads << std::setw(20) << std::fixed << std::setprecision(0)
+                  << throughput << std::endl;
+
+        pool->release_history(config, false);
+    }
+
+    return 0;
+}
@@ -0,0 +1,143 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_TimedEventsTest.cpp
+ *
+ * Measures the CPU used by the event thread of a ResourceEvent with a big number of active timers.
+ * The main thread sleeps during the measurement, so the process CPU time is the one used by the event thread.
+ */
+
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+static void usage()
+{
+    std::cout << "Usage: TimedEventsTest [--timers <n>] [--seconds <n>] [--min_period <ms>] [--max_period <ms>]"
+              << std::endl;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    uint32_t num_timers = 10000;
+    uint32_t seconds = 10;
+    uint32_t min_period = 10;
+    uint32_t max_period = 1000;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg(argv[i]);
+        if (i + 1 >= argc)
+        {
+            usage();
+            return -1;
+        }
+
+        uint32_t value = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        if (arg == "--timers")
+        {
+            num_timers = value;
+        }
+        else if (arg == "--seconds")
+        {
+            seconds = value;
+        }
+        else if (arg == "--min_period")
+        {
+            min_period = value;
+        }
+        else if (arg == "--max_period")
+        {
+            max_period = value;
+        }
+        else
+        {
+            usage();
+            return -1;
+        }
+    }
+
+    if (min_period == 0 || max_period < min_period)
+    {
+        usage();
+        return -1;
+    }
+
+    std::atomic<uint64_t> triggers(0);
+    std::mt19937 gen(42);
+    std::uniform_int_distribution<uint32_t> period(min_period, max_period);
+
+    ResourceEvent service;
+    service.init_thread();
+
+    std::vector<std::unique_ptr<TimedEvent>> timers;
+    timers.reserve(num_timers);
+    for (uint32_t i = 0; i < num_timers; ++i)
+    {
+        timers.emplace_back(new TimedEvent(service, [&triggers]() -> bool
+                {
+                    ++triggers;
+                    return true;
+                }, period(gen)));
+    }
+
+    for (std::unique_ptr<TimedEvent>& timer : timers)
+    {
+        timer->restart_timer();
+    }
+
+    // Let all timers be scheduled before measuring
+    std::this_thread::sleep_for(std::chrono::milliseconds(max_period));
+
+    uint64_t initial_triggers = triggers.load();
+    std::clock_t initial_cpu = std::clock();
+    auto initial_time = std::chrono::steady_clock::now();
+
+    std::this_thread::sleep_for(std::chrono::seconds(seconds));
+
+    std::clock_t final_cpu = std::clock();
+    auto final_time = std::chrono::steady_clock::now();
+    uint64_t final_triggers = triggers.load();
+
+    double cpu_seconds = static_cast<double>(final_cpu - initial_cpu) / CLOCKS_PER_SEC;
+    double wall_seconds = std::chrono::duration<double>(final_time - initial_time).count();
+
+    std::cout << "Timers:              " << num_timers << std::endl;
+    std::cout << "Periods (ms):        " << min_period << " - " << max_period << std::endl;
+    std::cout << "Triggers per second: " << (final_triggers - initial_triggers) / wall_seconds << std::endl;
+    std::cout << "Event thread CPU:    " << 100.0 * cpu_seconds / wall_seconds << " %" << std::endl;
+
+    for (std::unique_ptr<TimedEvent>& timer : timers)
+    {
+        timer->cancel_timer();
+    }
+    timers.clear();
+
+    return 0;
+}
@@ -132,7 +132,9 @@ enum  optionIndex {
     FORCED_DOMAIN,
     WIDTH,
     HEIGHT,
-    FRAMERATE
+    FRAMERATE,
+    FRAGMENT_RATE,
+    FRAGMENT_BURST
 };
 
 const option::Descriptor usage[] = {
@@ -159,6 +161,8 @@ const option::Descriptor usage[] = {
     { SEND_SLEEP_TIME, 0, "", "sleeptime",      Arg::Numeric,   "\t--sleeptime \tMaximum sleep time before shipments (milliseconds)." },
     { EXPORT_CSV,0,"","export_csv",             Arg::None,      "\t--export_csv \tFlag to export a CSV file." },
     { EXPORT_PREFIX,0,"","export_prefix",       Arg::String,    "\t--export_prefix \tFile prefix for the CSV file." },
+    { FRAGMENT_RATE, 0, "", "fragment_rate",    Arg::Numeric,   "\t--fragment_rate \tPace fragments of large samples (bytes per second)." },
+    { FRAGMENT_BURST, 0, "", "fragment_burst",  Arg::Numeric,   "\t--fragment_burst \tMaximum burst of paced fragments (bytes)." },
     //{ UNKNOWN_OPT, 0,"", "",                    Arg::None,      "\nSubscriber options:"},
 
 
@@ -210,6 +214,8 @@ int main(int argc, char** argv)
     bool large_data = false;
     std::string export_prefix = "";
     std::string sXMLConfigFile = "";
+    std::string fragment_rate = "";
+    std::string fragment_burst = "";
 
     argc -= (argc > 0);
     argv += (argc > 0); // skip program name argv[0] if present
@@ -343,6 +349,12 @@ int main(int argc, char** argv)
             case FRAMERATE:
                 frame_rate = strtol(opt.arg, nullptr, 10);
                 break;
+            case FRAGMENT_RATE:
+                fragment_rate = opt.arg;
+                break;
+            case FRAGMENT_BURST:
+                fragment_burst = opt.arg;
+                break;
 
 #if HAVE_SECURITY
             case USE_SECURITY:
@@ -415,6 +427,15 @@ int main(int argc, char** argv)
     }
 #endif
 
+    if (!fragment_rate.empty())
+    {
+        pub_property_policy.properties().emplace_back("fastdds.fragment_pacing.bytes_per_second", fragment_rate);
+        if (!fragment_burst.empty())
+        {
+            pub_property_policy.properties().emplace_back("fastdds.fragment_pacing.burst_size", fragment_burst);
+        }
+    }
+
     // Load an XML file with predefined profiles for publisher and subscriber
     if (sXMLConfigFile.length() > 0)
     {
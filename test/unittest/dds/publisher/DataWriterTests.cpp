@@ -205,6 +205,84 @@ TEST(DataWriterTests, Write)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+class CopyableTopicDataTypeMock : public TopicDataTypeMock
+{
+public:
+
+    bool serialize(
+            void* /*data*/,
+            fastrtps::rtps::SerializedPayload_t* /*payload*/) override
+    {
+        ++serialized_samples;
+        return true;
+    }
+
+    void* createData() override
+    {
+        return new FooType();
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<FooType*>(data);
+    }
+
+    bool copyData(
+            void* dst,
+            const void* src) override
+    {
+        *static_cast<FooType*>(dst) = *static_cast<const FooType*>(src);
+        return true;
+    }
+
+    uint32_t serialized_samples = 0;
+};
+
+TEST(DataWriterTests, WriteTypedSampleWithoutSerializing)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    CopyableTopicDataTypeMock* type_mock = new CopyableTopicDataTypeMock();
+    TypeSupport type(type_mock);
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.durability().kind = VOLATILE_DURABILITY_QOS;
+    qos.properties().properties().emplace_back("fastdds.intraprocess_typed_samples", "true");
+    DataWriter* datawriter = publisher->create_datawriter(topic, qos);
+    ASSERT_NE(datawriter, nullptr);
+
+    // There are no readers on other processes, so the sample is not serialized
+    FooType data;
+    data.message("HelloWorld");
+    ASSERT_TRUE(datawriter->write(&data, fastrtps::rtps::c_InstanceHandle_Unknown) ==
+            ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(0u, type_mock->serialized_samples);
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == ReturnCode_t::RETCODE_OK);
+
+    // Without the property the sample is serialized
+    datawriter = publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT);
+    ASSERT_NE(datawriter, nullptr);
+    ASSERT_TRUE(datawriter->write(&data, fastrtps::rtps::c_InstanceHandle_Unknown) ==
+            ReturnCode_t::RETCODE_OK);
+    ASSERT_EQ(1u, type_mock->serialized_samples);
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_topic(topic) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
+}
+
 void set_listener_test (
         DataWriter* writer,
         DataWriterListener* listener,
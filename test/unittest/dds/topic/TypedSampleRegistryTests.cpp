@@ -0,0 +1,119 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastdds/topic/TypedSampleRegistry.hpp>
+
+#include <memory>
+
+using namespace eprosima::fastdds::dds;
+using eprosima::fastrtps::rtps::GUID_t;
+using eprosima::fastrtps::rtps::SequenceNumber_t;
+
+class TypedSampleRegistryTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        writer_.guidPrefix.value[0] = 1;
+        writer_.entityId.value[3] = 0x03;
+        registry_.register_writer(writer_);
+    }
+
+    void TearDown() override
+    {
+        registry_.unregister_writer(writer_);
+    }
+
+    std::shared_ptr<void> sample(
+            int value)
+    {
+        return std::make_shared<int>(value);
+    }
+
+    TypedSampleRegistry& registry_ = TypedSampleRegistry::instance();
+    GUID_t writer_;
+    // Only compared, never dereferenced
+    TopicDataType* type_ = reinterpret_cast<TopicDataType*>(0x1);
+};
+
+TEST_F(TypedSampleRegistryTests, unregistered_writers_do_not_share)
+{
+    GUID_t other_writer = writer_;
+    other_writer.entityId.value[2] = 1;
+    EXPECT_FALSE(registry_.add(other_writer, SequenceNumber_t(0, 1), sample(1), type_));
+
+    std::shared_ptr<void> found;
+    TopicDataType* found_type = nullptr;
+    EXPECT_FALSE(registry_.find(other_writer, SequenceNumber_t(0, 1), found, found_type));
+}
+
+TEST_F(TypedSampleRegistryTests, find_takes_a_reference)
+{
+    ASSERT_TRUE(registry_.add(writer_, SequenceNumber_t(0, 1), sample(1), type_));
+    ASSERT_TRUE(registry_.add(writer_, SequenceNumber_t(0, 2), sample(2), type_));
+
+    std::shared_ptr<void> found;
+    TopicDataType* found_type = nullptr;
+    ASSERT_TRUE(registry_.find(writer_, SequenceNumber_t(0, 2), found, found_type));
+    ASSERT_TRUE(static_cast<bool>(found));
+    EXPECT_EQ(2, *static_cast<int*>(found.get()));
+    EXPECT_EQ(type_, found_type);
+
+    // The reader keeps the sample after the writer removes it
+    registry_.remove(writer_, SequenceNumber_t(0, 2));
+    EXPECT_EQ(2, *static_cast<int*>(found.get()));
+    EXPECT_EQ(1, found.use_count());
+}
+
+TEST_F(TypedSampleRegistryTests, removed_samples_are_not_found)
+{
+    ASSERT_TRUE(registry_.add(writer_, SequenceNumber_t(0, 1), sample(1), type_));
+    registry_.remove(writer_, SequenceNumber_t(0, 1));
+
+    // The writer still shares its samples, so the change has no payload to fall back to
+    std::shared_ptr<void> found = sample(0);
+    TopicDataType* found_type = type_;
+    EXPECT_TRUE(registry_.find(writer_, SequenceNumber_t(0, 1), found, found_type));
+    EXPECT_FALSE(static_cast<bool>(found));
+    EXPECT_EQ(nullptr, found_type);
+}
+
+TEST_F(TypedSampleRegistryTests, unregister_drops_samples)
+{
+    std::weak_ptr<void> added = [this]()
+            {
+                std::shared_ptr<void> ret = sample(1);
+                registry_.add(writer_, SequenceNumber_t(0, 1), ret, type_);
+                return ret;
+            } ();
+    ASSERT_FALSE(added.expired());
+
+    registry_.unregister_writer(writer_);
+    EXPECT_TRUE(added.expired());
+
+    std::shared_ptr<void> found;
+    TopicDataType* found_type = nullptr;
+    EXPECT_FALSE(registry_.find(writer_, SequenceNumber_t(0, 1), found, found_type));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
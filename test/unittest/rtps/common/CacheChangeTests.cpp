@@ -15,6 +15,7 @@
 #include <fastrtps/rtps/common/CacheChange.h>
 
 #include <climits>
+#include <cstring>
 #include <vector>
 #include <gtest/gtest.h>
 
@@ -132,6 +133,172 @@ TEST(CacheChange, FragmentManagement)
     }
 }
 
+/*!
+ * @fn TEST(CacheChange, FragmentManagementManyFragments)
+ * @brief This test checks the fragment management of CacheChange_t when the number of fragments spans
+ * several words of the missing fragments bitmap, and fragments are received out of order.
+ */
+TEST(CacheChange, FragmentManagementManyFragments)
+{
+    constexpr uint32_t num_fragments = 100;
+    constexpr uint16_t fragment_size = 10;
+    constexpr uint32_t payload_size = num_fragments * fragment_size - 5;
+
+    CacheChange_t uut(payload_size);
+    uut.serializedPayload.length = payload_size;
+    uut.setFragmentSize(fragment_size, true);
+    ASSERT_EQ(num_fragments, uut.getFragmentCount());
+    EXPECT_FALSE(uut.is_fully_assembled());
+
+    SerializedPayload_t payload(fragment_size);
+    payload.length = fragment_size;
+
+    // Receive even fragments in reverse order
+    for (uint32_t i = num_fragments; i > 0; --i)
+    {
+        if (i % 2 == 0)
+        {
+            memset(payload.data, static_cast<int>(i), fragment_size);
+            EXPECT_FALSE(uut.add_fragments(payload, i, 1));
+        }
+    }
+
+    FragmentNumberSet_t fns;
+    uut.get_missing_fragments(fns);
+    EXPECT_EQ(1u, fns.base());
+    for (FragmentNumber_t i = 1; i <= num_fragments; ++i)
+    {
+        EXPECT_EQ(i % 2 == 1, fns.is_set(i)) << "  index: " << i;
+    }
+
+    // Receive odd fragments, with fragment 1 last
+    for (uint32_t i = 3; i <= num_fragments; i += 2)
+    {
+        memset(payload.data, static_cast<int>(i), fragment_size);
+        EXPECT_FALSE(uut.add_fragments(payload, i, 1));
+    }
+
+    fns = FragmentNumberSet_t();
+    uut.get_missing_fragments(fns);
+    EXPECT_EQ(1u, fns.base());
+    EXPECT_TRUE(fns.is_set(1));
+    EXPECT_FALSE(fns.is_set(2));
+
+    memset(payload.data, 1, fragment_size);
+    EXPECT_TRUE(uut.add_fragments(payload, 1, 1));
+    EXPECT_TRUE(uut.is_fully_assembled());
+
+    fns = FragmentNumberSet_t();
+    uut.get_missing_fragments(fns);
+    EXPECT_TRUE(fns.empty());
+
+    // Check every fragment was copied to its final position
+    for (uint32_t i = 0; i < payload_size; ++i)
+    {
+        EXPECT_EQ(static_cast<octet>(i / fragment_size + 1), uut.serializedPayload.data[i]) << "  offset: " << i;
+    }
+}
+
+/*!
+ * @fn TEST(CacheChange, FragmentManagementWithoutList)
+ * @brief This test checks that fragments received on a change fragmented without the list of missing fragments,
+ * as the ones to be sent, are ignored.
+ */
+TEST(CacheChange, FragmentManagementWithoutList)
+{
+    CacheChange_t uut(90);
+    uut.serializedPayload.length = 90;
+    memset(uut.serializedPayload.data, 0, 90);
+
+    // The change may have had a list before
+    uut.setFragmentSize(9, true);
+    uut.setFragmentSize(9, false);
+    ASSERT_EQ(10u, uut.getFragmentCount());
+    EXPECT_TRUE(uut.is_fully_assembled());
+
+    SerializedPayload_t payload(9);
+    payload.length = 9;
+    memset(payload.data, 1, 9);
+    EXPECT_TRUE(uut.add_fragments(payload, 1, 1));
+    EXPECT_TRUE(uut.add_fragments(payload, 10, 1));
+    EXPECT_EQ(0u, uut.serializedPayload.data[0]);
+    EXPECT_EQ(0u, uut.serializedPayload.data[81]);
+
+    FragmentNumberSet_t fns;
+    uut.get_missing_fragments(fns);
+    EXPECT_TRUE(fns.empty());
+}
+
+/*!
+ * @fn TEST(ChangeForReader, FragmentRetransmission)
+ * @brief This test checks that only the fragments requested by a NACK_FRAG are marked to be sent again,
+ * even when the change has more fragments than the ones that fit on the window of unsent fragments.
+ */
+TEST(ChangeForReader, FragmentRetransmission)
+{
+    constexpr uint32_t num_fragments = 600;
+    constexpr uint16_t fragment_size = 10;
+
+    CacheChange_t change(num_fragments * fragment_size);
+    change.serializedPayload.length = num_fragments * fragment_size;
+    change.setFragmentSize(fragment_size, false);
+    ASSERT_EQ(num_fragments, change.getFragmentCount());
+
+    ChangeForReader_t uut(&change);
+
+    // Send all fragments, in order, checking the window is correctly updated
+    for (FragmentNumber_t i = 1; i <= num_fragments; ++i)
+    {
+        FragmentNumberSet_t unsent = uut.getUnsentFragments();
+        ASSERT_FALSE(unsent.empty());
+        ASSERT_EQ(i, unsent.min());
+        uut.markFragmentsAsSent(i);
+    }
+    EXPECT_TRUE(uut.getUnsentFragments().empty());
+
+    // Reader requests fragments 3 and 5
+    FragmentNumberSet_t requested(3);
+    requested.add(3);
+    requested.add(5);
+    uut.markFragmentsAsUnsent(requested);
+
+    // Only those fragments should be sent again
+    std::vector<FragmentNumber_t> resent;
+    while (!uut.getUnsentFragments().empty())
+    {
+        FragmentNumber_t frag = uut.getUnsentFragments().min();
+        resent.push_back(frag);
+        uut.markFragmentsAsSent(frag);
+    }
+    ASSERT_EQ(2u, resent.size());
+    EXPECT_EQ(3u, resent[0]);
+    EXPECT_EQ(5u, resent[1]);
+
+    // Request a fragment while the initial sending is still in progress
+    uut.markAllFragmentsAsUnsent();
+    for (FragmentNumber_t i = 1; i <= 100; ++i)
+    {
+        uut.markFragmentsAsSent(i);
+    }
+    requested.base(7);
+    requested.add(7);
+    uut.markFragmentsAsUnsent(requested);
+
+    resent.clear();
+    while (!uut.getUnsentFragments().empty())
+    {
+        FragmentNumber_t frag = uut.getUnsentFragments().min();
+        resent.push_back(frag);
+        uut.markFragmentsAsSent(frag);
+    }
+    ASSERT_EQ(num_fragments - 100 + 1, resent.size());
+    EXPECT_EQ(7u, resent[0]);
+    for (size_t i = 1; i < resent.size(); ++i)
+    {
+        EXPECT_EQ(100u + i, resent[i]);
+    }
+}
+
 int main(
         int argc,
         char **argv)
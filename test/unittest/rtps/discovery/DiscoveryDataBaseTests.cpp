@@ -0,0 +1,377 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+using fastrtps::rtps::CacheChange_t;
+using fastrtps::rtps::EntityId_t;
+using fastrtps::rtps::GUID_t;
+using fastrtps::rtps::GuidPrefix_t;
+using fastrtps::rtps::InstanceHandle_t;
+
+/*
+ * Database exposing to which participants its writers are sent, and the topics left to match.
+ */
+class RoutingDiscoveryDataBase : public DiscoveryDataBase
+{
+public:
+
+    RoutingDiscoveryDataBase(
+            const GuidPrefix_t& server_guid_prefix)
+        : DiscoveryDataBase(server_guid_prefix, {})
+    {
+    }
+
+    bool writer_sent_to(
+            const GUID_t& writer,
+            const GuidPrefix_t& participant) const
+    {
+        auto it = writers_.find(writer);
+        return it != writers_.end() && it->second.is_relevant_participant(participant);
+    }
+
+    std::vector<std::string> dirty_topics() const
+    {
+        return dirty_topics_;
+    }
+
+    // As if the participant had acknowledged the DATA(p) of the other one
+    void participant_acked(
+            const GuidPrefix_t& participant,
+            const GuidPrefix_t& other_participant)
+    {
+        auto it = participants_.find(participant);
+        ASSERT_NE(it, participants_.end());
+        it->second.add_or_update_ack_participant(other_participant, true);
+    }
+
+};
+
+/*
+ * What a round of matching left to send, and the topics still dirty after it.
+ */
+struct MatchingResult
+{
+    std::vector<InstanceHandle_t> pdp_to_send;
+    std::vector<InstanceHandle_t> edp_publications_to_send;
+    std::vector<InstanceHandle_t> edp_subscriptions_to_send;
+    std::vector<std::string> dirty_topics;
+};
+
+// Changes are compared by instance, as each database has its own
+static std::vector<InstanceHandle_t> instances(
+        const std::vector<CacheChange_t*>& changes)
+{
+    std::vector<InstanceHandle_t> ret;
+    for (const CacheChange_t* change : changes)
+    {
+        ret.push_back(change->instanceHandle);
+    }
+    return ret;
+}
+
+class DiscoveryDataBaseTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        db_.reset(new RoutingDiscoveryDataBase(prefix(0)));
+    }
+
+    void TearDown() override
+    {
+        release_database();
+    }
+
+    void release_database()
+    {
+        db_->disable();
+        std::set<CacheChange_t*> leftovers;
+        for (CacheChange_t* change : db_->changes_to_release())
+        {
+            leftovers.insert(change);
+        }
+        for (CacheChange_t* change : db_->clear())
+        {
+            leftovers.insert(change);
+        }
+        for (CacheChange_t* change : leftovers)
+        {
+            delete change;
+        }
+        db_.reset();
+    }
+
+    static GuidPrefix_t prefix(
+            uint8_t id)
+    {
+        GuidPrefix_t ret;
+        ret.value[0] = 0x44;
+        ret.value[11] = id;
+        return ret;
+    }
+
+    static GUID_t endpoint(
+            const GuidPrefix_t& participant,
+            uint8_t id,
+            bool writer)
+    {
+        EntityId_t entity_id;
+        entity_id.value[2] = id;
+        // User writers and readers without key
+        entity_id.value[3] = writer ? 0x03 : 0x04;
+        return GUID_t(participant, entity_id);
+    }
+
+    static CacheChange_t* create_change(
+            const GUID_t& guid,
+            const GuidPrefix_t& sender,
+            const EntityId_t& sender_entity,
+            int32_t sequence_number,
+            bool alive)
+    {
+        CacheChange_t* change = new CacheChange_t();
+        change->kind = alive ? fastrtps::rtps::ALIVE : fastrtps::rtps::NOT_ALIVE_DISPOSED_UNREGISTERED;
+        change->writerGUID = GUID_t(sender, sender_entity);
+        change->instanceHandle = fastrtps::rtps::InstanceHandle_t(guid);
+        fastrtps::rtps::SampleIdentity sample_identity;
+        sample_identity.writer_guid(change->writerGUID);
+        sample_identity.sequence_number(fastrtps::rtps::SequenceNumber_t(0, sequence_number));
+        change->write_params.sample_identity(sample_identity);
+        change->write_params.related_sample_identity(sample_identity);
+        return change;
+    }
+
+    void add_participant(
+            const GuidPrefix_t& participant,
+            const GuidPrefix_t& sender,
+            bool is_client,
+            bool is_local)
+    {
+        GUID_t guid(participant, fastrtps::rtps::c_EntityId_RTPSParticipant);
+        DiscoveryParticipantChangeData change_data(fastrtps::rtps::RemoteLocatorList(0, 0), is_client, is_local);
+        ASSERT_TRUE(db_->update(create_change(guid, sender, fastrtps::rtps::c_EntityId_SPDPWriter, 1, true),
+                change_data));
+        db_->process_pdp_data_queue();
+    }
+
+    void add_endpoint(
+            const GUID_t& guid,
+            const GuidPrefix_t& sender,
+            const std::string& topic)
+    {
+        bool writer = DiscoveryDataBase::is_writer(guid);
+        const EntityId_t& sender_entity =
+                writer ? fastrtps::rtps::c_EntityId_SEDPPubWriter : fastrtps::rtps::c_EntityId_SEDPSubWriter;
+        ASSERT_TRUE(db_->update(create_change(guid, sender, sender_entity, 1, true), topic));
+        db_->process_edp_data_queue();
+    }
+
+    void remove_reader(
+            const GUID_t& guid,
+            const GuidPrefix_t& sender,
+            const std::string& topic)
+    {
+        ASSERT_TRUE(db_->update(create_change(guid, sender, fastrtps::rtps::c_EntityId_SEDPSubWriter, 2, false),
+                topic));
+        db_->process_edp_data_queue();
+    }
+
+    /*
+     * Local server with a client, a remote server connected to it, and a participant behind the remote server.
+     */
+    void create_federation()
+    {
+        add_participant(local_server_, local_server_, false, true);
+        add_participant(remote_server_, remote_server_, false, true);
+        add_participant(client_, client_, true, true);
+        add_participant(remote_participant_, remote_server_, true, false);
+    }
+
+    /*
+     * Clients behind the local server and participants behind the remote one, each with a writer and a reader on
+     * different topics, and a round of matching of the resulting dirty topics. Half of the participants already know
+     * each other, so some of their endpoints are sent and the rest wait for their DATA(p).
+     */
+    MatchingResult match_many_topics()
+    {
+        const uint8_t num_participants = 12;
+        create_federation();
+        for (uint8_t id = 0; id < num_participants; ++id)
+        {
+            bool is_local = id % 3 != 0;
+            GuidPrefix_t participant = prefix(10 + id);
+            GuidPrefix_t sender = is_local ? participant : remote_server_;
+            add_participant(participant, sender, true, is_local);
+            add_endpoint(endpoint(participant, 1, true), sender, "T" + std::to_string(id % 5));
+            add_endpoint(endpoint(participant, 2, false), sender, "T" + std::to_string((id + 2) % 7));
+        }
+
+        for (uint8_t id = 0; id < num_participants; ++id)
+        {
+            for (uint8_t other_id = id % 2; other_id < num_participants; other_id += 2)
+            {
+                db_->participant_acked(prefix(10 + id), prefix(10 + other_id));
+            }
+        }
+
+        db_->process_dirty_topics();
+
+        MatchingResult result;
+        result.pdp_to_send = instances(db_->pdp_to_send());
+        result.edp_publications_to_send = instances(db_->edp_publications_to_send());
+        result.edp_subscriptions_to_send = instances(db_->edp_subscriptions_to_send());
+        result.dirty_topics = db_->dirty_topics();
+        return result;
+    }
+
+    std::unique_ptr<RoutingDiscoveryDataBase> db_;
+
+    const GuidPrefix_t local_server_ = prefix(0);
+    const GuidPrefix_t remote_server_ = prefix(1);
+    const GuidPrefix_t client_ = prefix(2);
+    const GuidPrefix_t remote_participant_ = prefix(3);
+};
+
+TEST_F(DiscoveryDataBaseTests, WritersFloodedWithoutTopicRouting)
+{
+    create_federation();
+
+    GUID_t writer = endpoint(client_, 1, true);
+    add_endpoint(writer, client_, "A");
+    EXPECT_TRUE(db_->writer_sent_to(writer, remote_server_));
+}
+
+TEST_F(DiscoveryDataBaseTests, WritersRoutedToInterestedServers)
+{
+    db_->topic_routing(true);
+    create_federation();
+
+    // Nobody behind the remote server reads the topic yet
+    GUID_t writer = endpoint(client_, 1, true);
+    add_endpoint(writer, client_, "A");
+    EXPECT_FALSE(db_->writer_sent_to(writer, remote_server_));
+
+    // A reader relayed by the remote server routes the writers already on the topic, and the new ones
+    add_endpoint(endpoint(remote_participant_, 1, false), remote_server_, "A");
+    EXPECT_TRUE(db_->writer_sent_to(writer, remote_server_));
+
+    GUID_t new_writer = endpoint(client_, 2, true);
+    add_endpoint(new_writer, client_, "A");
+    EXPECT_TRUE(db_->writer_sent_to(new_writer, remote_server_));
+
+    // Writers on other topics are not routed
+    GUID_t other_writer = endpoint(client_, 3, true);
+    add_endpoint(other_writer, client_, "B");
+    EXPECT_FALSE(db_->writer_sent_to(other_writer, remote_server_));
+}
+
+TEST_F(DiscoveryDataBaseTests, InterestDroppedWithLastRelayedReader)
+{
+    db_->topic_routing(true);
+    create_federation();
+
+    GUID_t first_reader = endpoint(remote_participant_, 1, false);
+    GUID_t second_reader = endpoint(remote_participant_, 2, false);
+    add_endpoint(first_reader, remote_server_, "A");
+    add_endpoint(second_reader, remote_server_, "A");
+
+    GUID_t writer = endpoint(client_, 1, true);
+    add_endpoint(writer, client_, "A");
+    EXPECT_TRUE(db_->writer_sent_to(writer, remote_server_));
+
+    // The server is still interested while it has readers on the topic
+    remove_reader(first_reader, remote_server_, "A");
+    GUID_t second_writer = endpoint(client_, 2, true);
+    add_endpoint(second_writer, client_, "A");
+    EXPECT_TRUE(db_->writer_sent_to(second_writer, remote_server_));
+
+    // Once its last reader is gone, new writers are no longer routed to it
+    remove_reader(second_reader, remote_server_, "A");
+    GUID_t third_writer = endpoint(client_, 3, true);
+    add_endpoint(third_writer, client_, "A");
+    EXPECT_FALSE(db_->writer_sent_to(third_writer, remote_server_));
+
+    // The writers it already got keep being sent, so it learns about their updates and disposals
+    EXPECT_TRUE(db_->writer_sent_to(writer, remote_server_));
+
+    // A new reader shows the interest again
+    add_endpoint(endpoint(remote_participant_, 3, false), remote_server_, "A");
+    EXPECT_TRUE(db_->writer_sent_to(third_writer, remote_server_));
+}
+
+TEST_F(DiscoveryDataBaseTests, InterestKeptByReadersRelayedByOtherServers)
+{
+    // The interest of a server only depends on the readers it relayed itself
+    db_->topic_routing(true);
+    const GuidPrefix_t other_server = prefix(4);
+    create_federation();
+    add_participant(other_server, other_server, false, true);
+
+    GUID_t remote_reader = endpoint(remote_participant_, 1, false);
+    add_endpoint(remote_reader, remote_server_, "A");
+    add_participant(prefix(5), other_server, true, false);
+    add_endpoint(endpoint(prefix(5), 1, false), other_server, "A");
+
+    remove_reader(remote_reader, remote_server_, "A");
+    GUID_t writer = endpoint(client_, 1, true);
+    add_endpoint(writer, client_, "A");
+    EXPECT_FALSE(db_->writer_sent_to(writer, remote_server_));
+    EXPECT_TRUE(db_->writer_sent_to(writer, other_server));
+}
+
+TEST_F(DiscoveryDataBaseTests, MatchingThreadsGiveSameResult)
+{
+    MatchingResult sequential = match_many_topics();
+    ASSERT_FALSE(sequential.pdp_to_send.empty());
+    ASSERT_FALSE(sequential.edp_publications_to_send.empty());
+    ASSERT_FALSE(sequential.edp_subscriptions_to_send.empty());
+    ASSERT_FALSE(sequential.dirty_topics.empty());
+
+    release_database();
+    db_.reset(new RoutingDiscoveryDataBase(prefix(0)));
+    db_->matching_threads(4);
+    MatchingResult parallel = match_many_topics();
+
+    EXPECT_EQ(sequential.pdp_to_send, parallel.pdp_to_send);
+    EXPECT_EQ(sequential.edp_publications_to_send, parallel.edp_publications_to_send);
+    EXPECT_EQ(sequential.edp_subscriptions_to_send, parallel.edp_subscriptions_to_send);
+    EXPECT_EQ(sequential.dirty_topics, parallel.dirty_topics);
+}
+
+} // namespace ddb
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,122 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/builtin/discovery/database/DiscoveryDataBaseWorkers.hpp>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+/*
+ * Runs a job and checks every task was run exactly once, before run returned.
+ */
+static void check_job(
+        DiscoveryDataBaseWorkers& workers,
+        size_t num_tasks)
+{
+    std::unique_ptr<std::atomic<uint32_t>[]> runs(new std::atomic<uint32_t>[num_tasks]);
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        runs[i].store(0);
+    }
+
+    workers.run(num_tasks, [&runs](size_t index)
+            {
+                runs[index].fetch_add(1);
+            });
+
+    for (size_t i = 0; i < num_tasks; ++i)
+    {
+        EXPECT_EQ(1u, runs[i].load()) << "Task " << i << " of " << num_tasks;
+    }
+}
+
+TEST(DiscoveryDataBaseWorkersTests, OnlyCallingThread)
+{
+    DiscoveryDataBaseWorkers workers(1);
+    check_job(workers, 0);
+    check_job(workers, 1);
+    check_job(workers, 100);
+}
+
+TEST(DiscoveryDataBaseWorkersTests, MoreTasksThanThreads)
+{
+    DiscoveryDataBaseWorkers workers(4);
+    for (size_t num_tasks : {0u, 1u, 3u, 4u, 5u, 1000u})
+    {
+        check_job(workers, num_tasks);
+    }
+}
+
+TEST(DiscoveryDataBaseWorkersTests, ConsecutiveJobs)
+{
+    // Workers must not mix up the tasks of a job with the ones of the previous job
+    DiscoveryDataBaseWorkers workers(4);
+    for (size_t job = 0; job < 500; ++job)
+    {
+        check_job(workers, 1 + job % 17);
+    }
+}
+
+TEST(DiscoveryDataBaseWorkersTests, TasksRunOnSeveralThreads)
+{
+    // Every task waits until all the threads have taken one, which only happens if the workers take part
+    constexpr uint32_t num_threads = 4;
+    DiscoveryDataBaseWorkers workers(num_threads);
+
+    std::mutex mutex;
+    std::set<std::thread::id> thread_ids;
+    std::atomic<uint32_t> started(0);
+    std::atomic<uint32_t> runs(0);
+
+    workers.run(num_threads, [&](size_t)
+            {
+                {
+                    std::lock_guard<std::mutex> guard(mutex);
+                    thread_ids.insert(std::this_thread::get_id());
+                }
+                started.fetch_add(1);
+                while (started.load() < num_threads)
+                {
+                    std::this_thread::yield();
+                }
+                runs.fetch_add(1);
+            });
+
+    EXPECT_EQ(num_threads, runs.load());
+    EXPECT_EQ(num_threads, thread_ids.size());
+}
+
+} // namespace ddb
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -134,6 +134,18 @@ protected:
         rdata->typeName("AnotherTypeName");
     }
 
+    template<typename ProxyData>
+    void set_type_hash(
+            ProxyData* data,
+            octet hash)
+    {
+        types::TypeIdentifier& type_id =
+                data->type_information().type_information.complete().typeid_with_size().type_id();
+        type_id._d(types::EK_COMPLETE);
+        type_id.equivalence_hash()[0] = hash;
+        data->type_information().assigned(true);
+    }
+
     void check_expectations(
             bool valid_matching)
     {
@@ -225,6 +237,18 @@ TEST_F(EdpTests, IncompatibleType)
     check_expectations(false);
 }
 
+TEST_F(EdpTests, CheckTypeInformationCompatibility)
+{
+    // Types with the same hash match without their type objects
+    set_type_hash(wdata, 1);
+    set_type_hash(rdata, 1);
+    check_expectations(true);
+
+    // Types with different hashes do not match while their type objects are not known
+    set_type_hash(rdata, 2);
+    check_expectations(false);
+}
+
 
 TEST_F(EdpTests, CheckPartitionCompatibility)
 {
@@ -388,6 +412,54 @@ TEST_F(EdpTests, CheckPositiveAckCompatibility)
     }
 }
 
+TEST_F(EdpTests, CheckCachedQosCompatibility)
+{
+    // Results for the same QoS are remembered, and equal to the ones checked the first time
+    wdata->m_qos.m_reliability.kind = BEST_EFFORT_RELIABILITY_QOS;
+    rdata->m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    check_expectations(false, fastdds::dds::RELIABILITY_QOS_POLICY_ID);
+    check_expectations(false, fastdds::dds::RELIABILITY_QOS_POLICY_ID);
+
+    wdata->m_qos.m_partition.push_back("A");
+    rdata->m_qos.m_partition.push_back("B");
+    wdata->m_qos.m_reliability.kind = RELIABLE_RELIABILITY_QOS;
+    check_expectations(false);
+    check_expectations(false);
+
+    rdata->m_qos.m_partition.push_back("A");
+    check_expectations(true);
+    check_expectations(true);
+
+    // The topic is not part of the fingerprint, so it is always checked
+    set_incompatible_topic();
+    EDP::MatchingFailureMask no_match_reason;
+    fastdds::dds::PolicyMask incompatible_qos;
+    EXPECT_FALSE(edp->valid_matching(wdata, rdata, no_match_reason, incompatible_qos));
+    EXPECT_TRUE(no_match_reason.test(EDP::MatchingFailureMask::different_topic));
+    EXPECT_TRUE(incompatible_qos.none());
+}
+
+TEST_F(EdpTests, CheckCachedQosCompatibilityEviction)
+{
+    // Results are still right after the least recently used ones have been dropped, and when checked again
+    for (int round = 0; round < 2; ++round)
+    {
+        for (int32_t seconds = 1; seconds <= 2000; ++seconds)
+        {
+            wdata->m_qos.m_deadline.period = Duration_t(seconds, 0);
+            rdata->m_qos.m_deadline.period = Duration_t((seconds % 2 == 0) ? seconds - 1 : seconds, 0);
+            if (seconds % 2 == 0)
+            {
+                check_expectations(false, fastdds::dds::DEADLINE_QOS_POLICY_ID);
+            }
+            else
+            {
+                check_expectations(true);
+            }
+        }
+    }
+}
+
 
 } // namespace rtps
 } // namespace fastrtps
@@ -0,0 +1,345 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+using fastrtps::rtps::CacheChange_t;
+using fastrtps::rtps::GUID_t;
+using fastrtps::rtps::SequenceNumber_t;
+
+/*
+ * Fills a change with values depending on its instance and sequence number.
+ */
+static void fill_change(
+        CacheChange_t& change,
+        uint8_t instance,
+        int32_t sequence_number,
+        const std::string& data)
+{
+    change.kind = fastrtps::rtps::ALIVE;
+    change.isRead = sequence_number % 2 == 0;
+    change.writerGUID.guidPrefix.value[0] = 1;
+    change.writerGUID.entityId = fastrtps::rtps::c_EntityId_SEDPPubWriter;
+    change.instanceHandle.value[0] = instance;
+    change.instanceHandle.value[15] = 0xC1;
+    change.sequenceNumber = SequenceNumber_t(0, sequence_number);
+    change.sourceTimestamp = fastrtps::rtps::Time_t(sequence_number, 100u);
+    change.receptionTimestamp = fastrtps::rtps::Time_t(sequence_number, 200u);
+
+    fastrtps::rtps::SampleIdentity sample_identity;
+    sample_identity.writer_guid(change.writerGUID);
+    sample_identity.sequence_number(change.sequenceNumber);
+    change.write_params.sample_identity(sample_identity);
+    fastrtps::rtps::SampleIdentity related_sample_identity;
+    related_sample_identity.sequence_number(SequenceNumber_t(0, instance));
+    change.write_params.related_sample_identity(related_sample_identity);
+
+    change.serializedPayload.reserve(static_cast<uint32_t>(data.size()));
+    change.serializedPayload.encapsulation = PL_CDR_LE;
+    change.serializedPayload.length = static_cast<uint32_t>(data.size());
+    if (!data.empty())
+    {
+        memcpy(change.serializedPayload.data, data.data(), data.size());
+    }
+}
+
+static std::string payload_of(
+        const CacheChange_t& change)
+{
+    return std::string(reinterpret_cast<const char*>(change.serializedPayload.data), change.serializedPayload.length);
+}
+
+static void expect_equal_changes(
+        const CacheChange_t& expected,
+        const CacheChange_t& change)
+{
+    EXPECT_EQ(expected.kind, change.kind);
+    EXPECT_EQ(expected.isRead, change.isRead);
+    EXPECT_EQ(expected.writerGUID, change.writerGUID);
+    EXPECT_EQ(expected.instanceHandle, change.instanceHandle);
+    EXPECT_EQ(expected.sequenceNumber, change.sequenceNumber);
+    EXPECT_EQ(expected.sourceTimestamp, change.sourceTimestamp);
+    EXPECT_EQ(expected.receptionTimestamp, change.receptionTimestamp);
+    EXPECT_EQ(expected.write_params.sample_identity(), change.write_params.sample_identity());
+    EXPECT_EQ(expected.write_params.related_sample_identity(), change.write_params.related_sample_identity());
+    EXPECT_EQ(expected.serializedPayload.encapsulation, change.serializedPayload.encapsulation);
+    EXPECT_EQ(payload_of(expected), payload_of(change));
+}
+
+/*
+ * Writes the changes to a journal, returning its content.
+ */
+static std::string write_journal(
+        const std::vector<const CacheChange_t*>& changes)
+{
+    std::ostringstream journal;
+    for (const CacheChange_t* change : changes)
+    {
+        EXPECT_GT(write_journal_record(journal, *change), 0u);
+    }
+    return journal.str();
+}
+
+TEST(SharedBackupFunctionsTests, JournalRecordRoundTrip)
+{
+    CacheChange_t change;
+    fill_change(change, 1, 7, "some payload data");
+    CacheChange_t empty_change;
+    fill_change(empty_change, 2, 8, "");
+
+    std::istringstream journal(write_journal({&change, &empty_change}));
+
+    JournalRecord record;
+    CacheChange_t restored;
+    ASSERT_TRUE(read_journal_record(journal, record));
+    ASSERT_TRUE(from_journal_record(record, restored));
+    expect_equal_changes(change, restored);
+
+    ASSERT_TRUE(read_journal_record(journal, record));
+    ASSERT_TRUE(from_journal_record(record, restored));
+    expect_equal_changes(empty_change, restored);
+
+    EXPECT_FALSE(read_journal_record(journal, record));
+}
+
+TEST(SharedBackupFunctionsTests, JournalRecordReservesPayload)
+{
+    // The payload of the change is enlarged when the record does not fit in it
+    CacheChange_t change;
+    fill_change(change, 1, 1, std::string(1000, 'x'));
+    std::istringstream journal(write_journal({&change}));
+
+    JournalRecord record;
+    CacheChange_t restored;
+    restored.serializedPayload.reserve(10);
+    ASSERT_TRUE(read_journal_record(journal, record));
+    ASSERT_TRUE(from_journal_record(record, restored));
+    EXPECT_GE(restored.serializedPayload.max_size, 1000u);
+    expect_equal_changes(change, restored);
+}
+
+TEST(SharedBackupFunctionsTests, JournalTruncatedTail)
+{
+    CacheChange_t first;
+    fill_change(first, 1, 1, "first");
+    CacheChange_t second;
+    fill_change(second, 2, 2, "second");
+    std::string complete = write_journal({&first, &second});
+    size_t first_size = write_journal({&first}).size();
+
+    // Every cut inside the second record, including its header, leaves only the first one
+    for (size_t cut = first_size + 1; cut < complete.size(); ++cut)
+    {
+        std::istringstream journal(complete.substr(0, cut));
+        std::vector<JournalRecord> records;
+        EXPECT_FALSE(read_journal(journal, records)) << "Cut at " << cut;
+        ASSERT_EQ(1u, records.size()) << "Cut at " << cut;
+
+        CacheChange_t restored;
+        ASSERT_TRUE(from_journal_record(records[0], restored));
+        expect_equal_changes(first, restored);
+    }
+
+    // A journal ending at a record boundary is complete
+    std::istringstream journal(complete.substr(0, first_size));
+    std::vector<JournalRecord> records;
+    EXPECT_TRUE(read_journal(journal, records));
+    EXPECT_EQ(1u, records.size());
+}
+
+TEST(SharedBackupFunctionsTests, JournalCorruptedTail)
+{
+    CacheChange_t first;
+    fill_change(first, 1, 1, "first");
+    CacheChange_t second;
+    fill_change(second, 2, 2, "second");
+    std::string complete = write_journal({&first, &second});
+    size_t first_size = write_journal({&first}).size();
+
+    // Any byte changed in the second record makes it be dropped
+    for (size_t pos = first_size; pos < complete.size(); ++pos)
+    {
+        std::string corrupted = complete;
+        corrupted[pos] = static_cast<char>(corrupted[pos] ^ 0x5A);
+        std::istringstream journal(corrupted);
+        std::vector<JournalRecord> records;
+        EXPECT_FALSE(read_journal(journal, records)) << "Corrupted at " << pos;
+        ASSERT_EQ(1u, records.size()) << "Corrupted at " << pos;
+
+        CacheChange_t restored;
+        ASSERT_TRUE(from_journal_record(records[0], restored));
+        expect_equal_changes(first, restored);
+    }
+}
+
+/*
+ * Backup files of a server, removed when the test ends.
+ */
+class BackupFilesTests : public ::testing::Test
+{
+protected:
+
+    void TearDown() override
+    {
+        std::remove(snapshot_file_.c_str());
+        std::remove(json_file_.c_str());
+        std::remove(journal_file_.c_str());
+        std::remove((journal_file_ + ".tmp").c_str());
+    }
+
+    void write_file(
+            const std::string& file_name,
+            const std::string& data)
+    {
+        std::ofstream file(file_name, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+        file.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    std::string read_file(
+            const std::string& file_name)
+    {
+        std::ifstream file(file_name, std::ios_base::in | std::ios_base::binary);
+        return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    }
+
+    const std::string snapshot_file_ = "SharedBackupFunctionsTests.db";
+    const std::string json_file_ = "SharedBackupFunctionsTests.json";
+    const std::string journal_file_ = "SharedBackupFunctionsTests_queue.db";
+};
+
+TEST_F(BackupFilesTests, RestoreSnapshotAndJournal)
+{
+    // Snapshot with the state before the journal, stored as the server does
+    CacheChange_t old_first;
+    fill_change(old_first, 1, 1, "first, old");
+    CacheChange_t second;
+    fill_change(second, 2, 2, "second");
+
+    json snapshot_json;
+    to_json(snapshot_json["writers"]["1"]["change"], old_first);
+    to_json(snapshot_json["writers"]["2"]["change"], second);
+    std::vector<uint8_t> snapshot = json::to_cbor(snapshot_json);
+    write_file(snapshot_file_, std::string(snapshot.begin(), snapshot.end()));
+
+    // The journal has the changes arrived after the snapshot
+    CacheChange_t new_first;
+    fill_change(new_first, 1, 3, "first, new");
+    CacheChange_t third;
+    fill_change(third, 3, 4, "third");
+    write_file(journal_file_, write_journal({&new_first, &third}));
+
+    json restored_json;
+    size_t snapshot_size = 0;
+    ASSERT_TRUE(read_snapshot(snapshot_file_, json_file_, restored_json, snapshot_size));
+    EXPECT_EQ(snapshot.size(), snapshot_size);
+    EXPECT_EQ(snapshot_json, restored_json);
+
+    // The records are replayed in order on top of the snapshot
+    std::vector<JournalRecord> records;
+    EXPECT_TRUE(restore_journal(journal_file_, records));
+    ASSERT_EQ(2u, records.size());
+    CacheChange_t restored;
+    ASSERT_TRUE(from_journal_record(records[0], restored));
+    expect_equal_changes(new_first, restored);
+    ASSERT_TRUE(from_journal_record(records[1], restored));
+    expect_equal_changes(third, restored);
+}
+
+TEST_F(BackupFilesTests, RestoreJsonSnapshotOfPreviousVersions)
+{
+    CacheChange_t change;
+    fill_change(change, 1, 1, "first");
+    json snapshot_json;
+    to_json(snapshot_json["writers"]["1"]["change"], change);
+    write_file(json_file_, snapshot_json.dump());
+
+    json restored_json;
+    size_t snapshot_size = 1;
+    ASSERT_TRUE(read_snapshot(snapshot_file_, json_file_, restored_json, snapshot_size));
+    EXPECT_EQ(0u, snapshot_size);
+    EXPECT_EQ(snapshot_json, restored_json);
+}
+
+TEST_F(BackupFilesTests, RestoreWithoutBackup)
+{
+    json restored_json;
+    size_t snapshot_size = 0;
+    EXPECT_FALSE(read_snapshot(snapshot_file_, json_file_, restored_json, snapshot_size));
+
+    std::vector<JournalRecord> records;
+    EXPECT_TRUE(restore_journal(journal_file_, records));
+    EXPECT_TRUE(records.empty());
+}
+
+TEST_F(BackupFilesTests, TornJournalIsTruncated)
+{
+    CacheChange_t first;
+    fill_change(first, 1, 1, "first");
+    CacheChange_t lost;
+    fill_change(lost, 2, 2, "lost");
+    std::string valid_data = write_journal({&first});
+    std::string torn_data = write_journal({&first, &lost});
+    torn_data.resize(torn_data.size() - 3);
+    write_file(journal_file_, torn_data);
+
+    std::vector<JournalRecord> records;
+    EXPECT_FALSE(restore_journal(journal_file_, records));
+    ASSERT_EQ(1u, records.size());
+    EXPECT_EQ(valid_data, read_file(journal_file_));
+
+    // The changes arrived after the restart are appended to the journal, and restored after the next one
+    CacheChange_t second;
+    fill_change(second, 3, 3, "second");
+    {
+        std::ofstream journal(journal_file_, std::ios_base::app | std::ios_base::binary);
+        ASSERT_GT(write_journal_record(journal, second), 0u);
+    }
+
+    records.clear();
+    EXPECT_TRUE(restore_journal(journal_file_, records));
+    ASSERT_EQ(2u, records.size());
+    CacheChange_t restored;
+    ASSERT_TRUE(from_journal_record(records[0], restored));
+    expect_equal_changes(first, restored);
+    ASSERT_TRUE(from_journal_record(records[1], restored));
+    expect_equal_changes(second, restored);
+}
+
+} // namespace ddb
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,91 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/flowcontrol/DestinationShaper.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace std::chrono;
+
+static GuidPrefix_t participant_prefix(
+        octet key)
+{
+    GuidPrefix_t prefix;
+    prefix.value[11] = key;
+    return prefix;
+}
+
+static const GuidPrefix_t fast_link = participant_prefix(1);
+static const GuidPrefix_t slow_link = participant_prefix(2);
+
+TEST(DestinationShaperTests, disabled_shaper_lets_everything_through)
+{
+    DestinationShaper shaper(0, 0);
+
+    auto now = DestinationShaper::clock::now();
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(shaper.try_send(fast_link, 65000, now));
+    }
+    EXPECT_EQ(6500000u, shaper.sent_bytes(fast_link));
+    EXPECT_EQ(0u, shaper.deferred_bytes(fast_link));
+}
+
+TEST(DestinationShaperTests, destinations_are_paced_independently)
+{
+    // 1000 bytes per second, bursts of 2000 bytes
+    DestinationShaper shaper(1000, 2000);
+
+    auto now = DestinationShaper::clock::now();
+    EXPECT_TRUE(shaper.try_send(slow_link, 2000, now));
+    EXPECT_FALSE(shaper.try_send(slow_link, 500, now));
+
+    // Exhausting the bandwidth of a destination does not affect the others
+    EXPECT_TRUE(shaper.try_send(fast_link, 1000, now));
+    EXPECT_TRUE(shaper.try_send(fast_link, 1000, now));
+    EXPECT_EQ(DestinationShaper::clock::duration::zero(), shaper.time_until_available(participant_prefix(3), 2000, now));
+
+    EXPECT_EQ(milliseconds(500), duration_cast<milliseconds>(shaper.time_until_available(slow_link, 500, now)));
+    EXPECT_TRUE(shaper.try_send(slow_link, 500, now + milliseconds(500)));
+
+    EXPECT_EQ(2500u, shaper.sent_bytes(slow_link));
+    EXPECT_EQ(2000u, shaper.sent_bytes(fast_link));
+}
+
+TEST(DestinationShaperTests, deferred_bytes_are_counted_per_destination)
+{
+    DestinationShaper shaper(1000, 1000);
+
+    auto now = DestinationShaper::clock::now();
+    EXPECT_TRUE(shaper.try_send(slow_link, 1000, now));
+    EXPECT_FALSE(shaper.try_send(slow_link, 300, now));
+    shaper.defer(slow_link, 200);
+
+    EXPECT_EQ(500u, shaper.deferred_bytes(slow_link));
+    EXPECT_EQ(0u, shaper.deferred_bytes(fast_link));
+
+    // Counters are lost when the destination is removed
+    shaper.remove_destination(slow_link);
+    EXPECT_EQ(0u, shaper.deferred_bytes(slow_link));
+    EXPECT_EQ(0u, shaper.sent_bytes(slow_link));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,149 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/participant/RTPSParticipantImpl.h>
+#include <fastdds/rtps/writer/ReaderProxy.h>
+#include <rtps/flowcontrol/DestinationThroughputController.h>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+static const uint32_t payload_size = 500;
+static const uint32_t bytes_per_period = 1000;
+static const uint32_t period_millisecs = 1000;
+
+static GuidPrefix_t participant_prefix(
+        octet key)
+{
+    GuidPrefix_t prefix;
+    prefix.value[11] = key;
+    return prefix;
+}
+
+static GUID_t reader_guid(
+        const GuidPrefix_t& prefix,
+        octet key)
+{
+    GUID_t guid;
+    guid.guidPrefix = prefix;
+    guid.entityId.value[2] = key;
+    guid.entityId.value[3] = 0x07;
+    return guid;
+}
+
+class DestinationThroughputControllerTests : public ::testing::Test
+{
+public:
+
+    DestinationThroughputControllerTests()
+        : controller_({bytes_per_period, period_millisecs}, nullptr)
+    {
+        for (uint32_t i = 0; i < 10; ++i)
+        {
+            changes_.emplace_back(new CacheChange_t(payload_size));
+            changes_.back()->sequenceNumber = {0, i + 1};
+            changes_.back()->serializedPayload.length = payload_size;
+        }
+    }
+
+    //! Collect all the changes for the given readers, and return the number of them each reader may receive
+    std::vector<size_t> filter(
+            const std::vector<ReaderProxy*>& readers)
+    {
+        RTPSWriterCollector<ReaderProxy*> collector;
+        for (auto& change : changes_)
+        {
+            for (ReaderProxy* reader : readers)
+            {
+                collector.add_change(change.get(), reader, FragmentNumberSet_t());
+            }
+        }
+
+        controller_(collector);
+
+        std::vector<size_t> ret(readers.size(), 0u);
+        for (const auto& item : collector.items())
+        {
+            for (ReaderProxy* reader : item.remoteReaders)
+            {
+                for (size_t i = 0; i < readers.size(); ++i)
+                {
+                    if (readers[i] == reader)
+                    {
+                        ++ret[i];
+                    }
+                }
+            }
+        }
+        return ret;
+    }
+
+    DestinationThroughputController controller_;
+    std::vector<std::unique_ptr<CacheChange_t>> changes_;
+};
+
+TEST_F(DestinationThroughputControllerTests, readers_of_a_participant_share_its_bandwidth)
+{
+    GuidPrefix_t prefix = participant_prefix(1);
+    ReaderProxy reader_1(reader_guid(prefix, 1));
+    ReaderProxy reader_2(reader_guid(prefix, 2));
+    ReaderProxy reader_3(reader_guid(prefix, 3));
+
+    // The data is only charged once for the participant, no matter the number of readers
+    std::vector<size_t> sent = filter({&reader_1, &reader_2, &reader_3});
+    EXPECT_EQ(2u, sent[0]);
+    EXPECT_EQ(2u, sent[1]);
+    EXPECT_EQ(2u, sent[2]);
+    EXPECT_EQ(8u * payload_size, controller_.deferred_bytes(prefix));
+}
+
+TEST_F(DestinationThroughputControllerTests, participants_are_paced_independently)
+{
+    ReaderProxy slow_reader(reader_guid(participant_prefix(1), 1));
+    ReaderProxy fast_reader(reader_guid(participant_prefix(2), 1));
+
+    // Exhaust the bandwidth of the slow participant
+    EXPECT_EQ(2u, filter({&slow_reader})[0]);
+
+    std::vector<size_t> sent = filter({&slow_reader, &fast_reader});
+    EXPECT_EQ(0u, sent[0]);
+    EXPECT_EQ(2u, sent[1]);
+}
+
+TEST_F(DestinationThroughputControllerTests, removed_participants_are_forgotten)
+{
+    GuidPrefix_t prefix = participant_prefix(1);
+    ReaderProxy reader(reader_guid(prefix, 1));
+
+    EXPECT_EQ(2u, filter({&reader})[0]);
+    EXPECT_EQ(0u, filter({&reader})[0]);
+    EXPECT_LT(0u, controller_.deferred_bytes(prefix));
+
+    // A participant coming back starts with a full bucket
+    controller_.remove_remote_participant(prefix);
+    EXPECT_EQ(0u, controller_.deferred_bytes(prefix));
+    EXPECT_EQ(2u, filter({&reader})[0]);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
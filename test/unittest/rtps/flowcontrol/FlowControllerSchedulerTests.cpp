@@ -0,0 +1,260 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/flowcontrol/FlowControllerScheduler.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+
+static GUID_t writer_guid(
+        octet key)
+{
+    GUID_t guid;
+    guid.entityId.value[2] = key;
+    guid.entityId.value[3] = 0x03;
+    return guid;
+}
+
+static const GUID_t bulk = writer_guid(1);
+static const GUID_t control = writer_guid(2);
+static const GUID_t other = writer_guid(3);
+
+static const uint32_t unlimited = FlowControllerScheduler::unlimited;
+static const int64_t infinite = FlowControllerScheduler::infinite_deadline;
+
+TEST(FlowControllerSchedulerTests, fifo_does_not_limit_writers)
+{
+    FlowControllerScheduler scheduler(FlowControllerSchedulerPolicy::FIFO, 1000);
+    scheduler.register_writer(bulk, 10, c_TimeInfinite);
+    scheduler.register_writer(control, -10, c_TimeInfinite);
+
+    scheduler.writer_blocked(control, infinite);
+    scheduler.writer_blocked(bulk, infinite);
+    EXPECT_EQ(unlimited, scheduler.share(bulk, infinite));
+
+    // Writers are woken up in arrival order
+    std::vector<GUID_t> blocked = scheduler.take_blocked_writers();
+    ASSERT_EQ(2u, blocked.size());
+    EXPECT_EQ(control, blocked[0]);
+    EXPECT_EQ(bulk, blocked[1]);
+    EXPECT_TRUE(scheduler.take_blocked_writers().empty());
+}
+
+TEST(FlowControllerSchedulerTests, high_priority_writers_go_first)
+{
+    FlowControllerScheduler scheduler(FlowControllerSchedulerPolicy::HIGH_PRIORITY, 1000);
+    scheduler.register_writer(bulk, 10, c_TimeInfinite);
+    scheduler.register_writer(control, -10, c_TimeInfinite);
+
+    // Nobody waiting, so the bulk writer may use the bandwidth
+    EXPECT_EQ(unlimited, scheduler.share(bulk, infinite));
+
+    // Bulk writer should wait while the control writer is waiting, but not the other way round
+    scheduler.writer_blocked(bulk, infinite);
+    scheduler.writer_blocked(control, infinite);
+    EXPECT_EQ(0u, scheduler.share(bulk, infinite));
+    EXPECT_EQ(unlimited, scheduler.share(control, infinite));
+
+    // Writers not registered have priority 0
+    EXPECT_EQ(0u, scheduler.share(other, infinite));
+
+    std::vector<GUID_t> blocked = scheduler.take_blocked_writers();
+    ASSERT_EQ(2u, blocked.size());
+    EXPECT_EQ(control, blocked[0]);
+    EXPECT_EQ(bulk, blocked[1]);
+}
+
+TEST(FlowControllerSchedulerTests, round_robin_shares_bandwidth)
+{
+    FlowControllerScheduler scheduler(FlowControllerSchedulerPolicy::ROUND_ROBIN, 1000);
+    scheduler.register_writer(bulk, 0, c_TimeInfinite);
+    scheduler.register_writer(control, 0, c_TimeInfinite);
+    scheduler.register_writer(other, 0, c_TimeInfinite);
+
+    scheduler.bytes_sent(bulk, 400);
+    EXPECT_EQ(unlimited, scheduler.share(bulk, infinite));
+
+    // With two writers waiting, each one gets a third of the bandwidth
+    scheduler.writer_blocked(control, infinite);
+    scheduler.writer_blocked(other, infinite);
+    EXPECT_EQ(0u, scheduler.share(bulk, infinite));
+    EXPECT_EQ(500u, scheduler.share(control, infinite));
+
+    scheduler.bytes_restored(bulk, 300);
+    EXPECT_EQ(233u, scheduler.share(bulk, infinite));
+
+    // Blocked writers are woken up in arrival order
+    std::vector<GUID_t> blocked = scheduler.take_blocked_writers();
+    ASSERT_EQ(2u, blocked.size());
+    EXPECT_EQ(control, blocked[0]);
+    EXPECT_EQ(other, blocked[1]);
+}
+
+TEST(FlowControllerSchedulerTests, earliest_deadline_goes_first)
+{
+    FlowControllerScheduler scheduler(FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST, 1000);
+    scheduler.register_writer(bulk, 0, c_TimeInfinite);
+    scheduler.register_writer(control, 0, Duration_t(0, 10000000));
+
+    rtps::Time_t timestamp(100, 0);
+    int64_t control_deadline = scheduler.deadline(control, timestamp);
+    EXPECT_EQ(timestamp.to_ns() + 10000000, control_deadline);
+    EXPECT_EQ(infinite, scheduler.deadline(bulk, timestamp));
+
+    scheduler.writer_blocked(bulk, infinite);
+    scheduler.writer_blocked(control, control_deadline);
+    EXPECT_EQ(0u, scheduler.share(bulk, infinite));
+    EXPECT_EQ(unlimited, scheduler.share(control, control_deadline));
+
+    std::vector<GUID_t> blocked = scheduler.take_blocked_writers();
+    ASSERT_EQ(2u, blocked.size());
+    EXPECT_EQ(control, blocked[0]);
+    EXPECT_EQ(bulk, blocked[1]);
+}
+
+TEST(FlowControllerSchedulerTests, unregistered_writers_are_not_woken_up)
+{
+    FlowControllerScheduler scheduler(FlowControllerSchedulerPolicy::HIGH_PRIORITY, 1000);
+    scheduler.register_writer(bulk, 10, c_TimeInfinite);
+    scheduler.register_writer(control, -10, c_TimeInfinite);
+
+    scheduler.writer_blocked(control, infinite);
+    scheduler.writer_blocked(bulk, infinite);
+    scheduler.unregister_writer(control);
+
+    EXPECT_EQ(unlimited, scheduler.share(bulk, infinite));
+    std::vector<GUID_t> blocked = scheduler.take_blocked_writers();
+    ASSERT_EQ(1u, blocked.size());
+    EXPECT_EQ(bulk, blocked[0]);
+}
+
+TEST(FlowControllerSchedulerTests, writers_blocked_twice_are_woken_up_once)
+{
+    const FlowControllerSchedulerPolicy policies[] = {
+        FlowControllerSchedulerPolicy::FIFO,
+        FlowControllerSchedulerPolicy::ROUND_ROBIN,
+        FlowControllerSchedulerPolicy::HIGH_PRIORITY,
+        FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST
+    };
+
+    for (FlowControllerSchedulerPolicy policy : policies)
+    {
+        FlowControllerScheduler scheduler(policy, 1000);
+        scheduler.writer_blocked(bulk, infinite);
+        scheduler.writer_blocked(control, infinite);
+        scheduler.writer_blocked(bulk, infinite);
+
+        // Same priority and deadline, so arrival order is kept by every policy
+        std::vector<GUID_t> blocked = scheduler.take_blocked_writers();
+        ASSERT_EQ(2u, blocked.size());
+        EXPECT_EQ(bulk, blocked[0]);
+        EXPECT_EQ(control, blocked[1]);
+    }
+}
+
+TEST(FlowControllerSchedulerTests, writers_do_not_wait_for_themselves)
+{
+    FlowControllerScheduler round_robin(FlowControllerSchedulerPolicy::ROUND_ROBIN, 1000);
+    round_robin.writer_blocked(bulk, infinite);
+    EXPECT_EQ(unlimited, round_robin.share(bulk, infinite));
+
+    FlowControllerScheduler high_priority(FlowControllerSchedulerPolicy::HIGH_PRIORITY, 1000);
+    high_priority.register_writer(bulk, -10, c_TimeInfinite);
+    high_priority.writer_blocked(bulk, infinite);
+    EXPECT_EQ(unlimited, high_priority.share(bulk, infinite));
+
+    FlowControllerScheduler edf(FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST, 1000);
+    edf.writer_blocked(bulk, 10);
+    EXPECT_EQ(unlimited, edf.share(bulk, infinite));
+}
+
+TEST(FlowControllerSchedulerTests, equal_priority_does_not_wait)
+{
+    FlowControllerScheduler scheduler(FlowControllerSchedulerPolicy::HIGH_PRIORITY, 1000);
+    scheduler.register_writer(bulk, 5, c_TimeInfinite);
+    scheduler.register_writer(control, 5, c_TimeInfinite);
+    scheduler.register_writer(other, 1, c_TimeInfinite);
+
+    scheduler.writer_blocked(control, infinite);
+    EXPECT_EQ(unlimited, scheduler.share(bulk, infinite));
+
+    // Writers with the same priority are woken up in arrival order, after the ones with higher priority
+    scheduler.writer_blocked(bulk, infinite);
+    scheduler.writer_blocked(other, infinite);
+    std::vector<GUID_t> blocked = scheduler.take_blocked_writers();
+    ASSERT_EQ(3u, blocked.size());
+    EXPECT_EQ(other, blocked[0]);
+    EXPECT_EQ(control, blocked[1]);
+    EXPECT_EQ(bulk, blocked[2]);
+}
+
+TEST(FlowControllerSchedulerTests, earliest_deadline_of_blocked_writer_is_kept)
+{
+    FlowControllerScheduler scheduler(FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST, 1000);
+    scheduler.writer_blocked(bulk, 300);
+    scheduler.writer_blocked(control, 200);
+    scheduler.writer_blocked(other, 400);
+    scheduler.writer_blocked(other, 100);
+    scheduler.writer_blocked(other, 500);
+
+    // Equal deadlines do not wait
+    EXPECT_EQ(unlimited, scheduler.share(writer_guid(4), 100));
+    EXPECT_EQ(0u, scheduler.share(writer_guid(4), 101));
+
+    std::vector<GUID_t> blocked = scheduler.take_blocked_writers();
+    ASSERT_EQ(3u, blocked.size());
+    EXPECT_EQ(other, blocked[0]);
+    EXPECT_EQ(control, blocked[1]);
+    EXPECT_EQ(bulk, blocked[2]);
+}
+
+TEST(FlowControllerSchedulerTests, writers_without_send_deadline)
+{
+    FlowControllerScheduler scheduler(FlowControllerSchedulerPolicy::EARLIEST_DEADLINE_FIRST, 1000);
+    scheduler.register_writer(control, 0, Duration_t(10, 0));
+    scheduler.register_writer(bulk, 0, c_TimeInfinite);
+
+    EXPECT_EQ(rtps::Time_t(11, 0).to_ns(), scheduler.deadline(control, rtps::Time_t(1, 0)));
+    EXPECT_EQ(infinite, scheduler.deadline(bulk, rtps::Time_t(1, 0)));
+    EXPECT_EQ(infinite, scheduler.deadline(other, rtps::Time_t(1, 0)));
+
+    // After unregistering, the writer has no send deadline
+    scheduler.unregister_writer(control);
+    EXPECT_EQ(infinite, scheduler.deadline(control, rtps::Time_t(1, 0)));
+}
+
+TEST(FlowControllerSchedulerTests, round_robin_share_is_zero_when_exhausted)
+{
+    FlowControllerScheduler scheduler(FlowControllerSchedulerPolicy::ROUND_ROBIN, 1000);
+    scheduler.register_writer(bulk, 0, c_TimeInfinite);
+
+    scheduler.writer_blocked(control, infinite);
+    EXPECT_EQ(500u, scheduler.share(bulk, infinite));
+    scheduler.bytes_sent(bulk, 500);
+    EXPECT_EQ(0u, scheduler.share(bulk, infinite));
+
+    // Restoring more than in use does not wrap around
+    scheduler.bytes_restored(bulk, 2000);
+    EXPECT_EQ(500u, scheduler.share(bulk, infinite));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
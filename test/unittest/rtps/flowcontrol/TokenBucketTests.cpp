@@ -0,0 +1,102 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/flowcontrol/TokenBucket.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace std::chrono;
+
+TEST(TokenBucketTests, disabled_bucket_lets_everything_through)
+{
+    TokenBucket bucket(0, 0);
+    EXPECT_FALSE(bucket.is_enabled());
+
+    auto now = TokenBucket::clock::now();
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        EXPECT_TRUE(bucket.try_consume(65000, now));
+    }
+    EXPECT_EQ(TokenBucket::clock::duration::zero(), bucket.time_until_available(65000, now));
+}
+
+TEST(TokenBucketTests, burst_is_limited)
+{
+    // 1000 bytes per second, bursts of 3000 bytes
+    TokenBucket bucket(1000, 3000);
+    ASSERT_TRUE(bucket.is_enabled());
+
+    auto now = TokenBucket::clock::now();
+    EXPECT_TRUE(bucket.try_consume(1000, now));
+    EXPECT_TRUE(bucket.try_consume(1000, now));
+    EXPECT_TRUE(bucket.try_consume(1000, now));
+    EXPECT_FALSE(bucket.try_consume(1000, now));
+
+    // One second is needed to refill 1000 bytes
+    EXPECT_EQ(seconds(1), duration_cast<seconds>(bucket.time_until_available(1000, now)));
+    EXPECT_FALSE(bucket.try_consume(1000, now + milliseconds(500)));
+    EXPECT_TRUE(bucket.try_consume(1000, now + milliseconds(1000)));
+    EXPECT_FALSE(bucket.try_consume(1000, now + milliseconds(1000)));
+}
+
+TEST(TokenBucketTests, refill_does_not_exceed_burst)
+{
+    TokenBucket bucket(1000, 2000);
+
+    auto now = TokenBucket::clock::now();
+    EXPECT_TRUE(bucket.try_consume(2000, now));
+
+    // After a long idle period only the burst is available
+    now += seconds(3600);
+    EXPECT_TRUE(bucket.try_consume(2000, now));
+    EXPECT_FALSE(bucket.try_consume(1, now));
+}
+
+TEST(TokenBucketTests, fractions_of_tokens_are_not_lost)
+{
+    TokenBucket bucket(1000, 1000);
+
+    auto now = TokenBucket::clock::now();
+    EXPECT_TRUE(bucket.try_consume(1000, now));
+
+    // Each call is done 0.5 ms later, which refills half a token each time
+    for (uint32_t i = 1; i < 2000; ++i)
+    {
+        EXPECT_FALSE(bucket.try_consume(1000, now + microseconds(500 * i)));
+    }
+    EXPECT_TRUE(bucket.try_consume(1000, now + milliseconds(1000)));
+}
+
+TEST(TokenBucketTests, blocks_bigger_than_burst_are_allowed_when_full)
+{
+    TokenBucket bucket(1000, 1000);
+
+    auto now = TokenBucket::clock::now();
+    EXPECT_TRUE(bucket.try_consume(3000, now));
+
+    // The bucket is in debt for 2000 bytes, so it needs 3 seconds to be full again
+    EXPECT_EQ(seconds(3), duration_cast<seconds>(bucket.time_until_available(1000, now)));
+    EXPECT_FALSE(bucket.try_consume(1, now + milliseconds(2000)));
+    EXPECT_EQ(seconds(1), duration_cast<seconds>(bucket.time_until_available(1000, now + milliseconds(2000))));
+    EXPECT_TRUE(bucket.try_consume(1000, now + milliseconds(3000)));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
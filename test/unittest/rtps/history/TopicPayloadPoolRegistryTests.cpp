@@ -18,6 +18,7 @@
 
 #include <rtps/history/TopicPayloadPoolRegistry_impl/TopicPayloadPoolProxy.hpp>
 
+using namespace eprosima;
 using namespace eprosima::fastrtps::rtps;
 using namespace ::testing;
 using namespace std;
@@ -74,3 +75,31 @@ TEST(TopicPayloadPoolRegistryTests, basic_checks)
     // Destructor should have been called a certain number of times
     EXPECT_EQ(detail::TopicPayloadPoolProxy::DestructorHelper::instance().get(), 3u);
 }
+
+TEST(TopicPayloadPoolRegistryTests, numa_nodes)
+{
+    PoolConfig cfg{ PREALLOCATED_MEMORY_MODE, 4u, 4u, 4u };
+
+    // Same topic on different NUMA nodes should result on different pools
+    auto pool_any = TopicPayloadPoolRegistry::get("topic_numa", cfg);
+    auto pool_0 = TopicPayloadPoolRegistry::get("topic_numa", cfg, 0);
+    auto pool_1 = TopicPayloadPoolRegistry::get("topic_numa", cfg, 1);
+    EXPECT_NE(pool_any, pool_0);
+    EXPECT_NE(pool_any, pool_1);
+    EXPECT_NE(pool_0, pool_1);
+
+    // Same node should result on same pool
+    auto pool_1_again = TopicPayloadPoolRegistry::get("topic_numa", cfg, 1);
+    EXPECT_EQ(pool_1, pool_1_again);
+
+    TopicPayloadPoolRegistry::release(pool_any);
+    TopicPayloadPoolRegistry::release(pool_0);
+    TopicPayloadPoolRegistry::release(pool_1);
+    TopicPayloadPoolRegistry::release(pool_1_again);
+
+    EXPECT_EQ(0, parse_numa_node("0"));
+    EXPECT_EQ(3, parse_numa_node("3"));
+    EXPECT_EQ(unknown_numa_node, parse_numa_node("-1"));
+    EXPECT_EQ(unknown_numa_node, parse_numa_node("node"));
+    EXPECT_EQ(unknown_numa_node, parse_numa_node(""));
+}
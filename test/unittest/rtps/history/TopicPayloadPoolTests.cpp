@@ -16,7 +16,10 @@
 
 #include <rtps/history/TopicPayloadPool.hpp>
 
+#include <cstring>
+#include <thread>
 #include <tuple>
+#include <vector>
 
 using namespace eprosima::fastrtps::rtps;
 using namespace ::testing;
@@ -406,6 +409,89 @@ TEST_P(TopicPayloadPoolTests, release_history_writer_finite_size)
     do_history_test(reserve_size, reserve_max_size, false);
 }
 
+TEST(TopicPayloadPoolNumaTests, payloads_keep_their_data_when_reallocated)
+{
+    // Pools placed on a NUMA node allocate whole pages, which are kept when the payloads grow
+    PoolConfig config{ MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE, 16u, 1u, 1u };
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config, eprosima::current_numa_node());
+    ASSERT_TRUE(pool->reserve_history(config, false));
+
+    CacheChange_t change;
+    ASSERT_TRUE(pool->get_payload(16u, change));
+    memset(change.serializedPayload.data, 0xAB, 16u);
+    ASSERT_TRUE(pool->release_payload(change));
+
+    for (uint32_t size : {1024u, 8192u, 100000u})
+    {
+        ASSERT_TRUE(pool->get_payload(size, change));
+        ASSERT_GE(change.serializedPayload.max_size, size);
+        for (uint32_t i = 0; i < 16u; ++i)
+        {
+            EXPECT_EQ(0xAB, change.serializedPayload.data[i]);
+        }
+        for (uint32_t i = 16u; i < size; ++i)
+        {
+            ASSERT_EQ(0u, change.serializedPayload.data[i]);
+        }
+        ASSERT_TRUE(pool->release_payload(change));
+    }
+
+    EXPECT_TRUE(pool->release_history(config, false));
+}
+
+TEST(TopicPayloadPoolConcurrencyTests, shrink_while_payloads_are_released)
+{
+    // Payloads released by other threads while the pool shrinks may be in the middle of being cached
+    constexpr uint32_t num_payloads = 64u;
+    PoolConfig config{ MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE, 16u, num_payloads,
+                       num_payloads };
+
+    for (uint32_t i = 0; i < 200u; ++i)
+    {
+        std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+        ASSERT_TRUE(pool->reserve_history(config, false));
+        ASSERT_TRUE(pool->reserve_history(config, true));
+
+        std::vector<CacheChange_t> changes(2u * num_payloads);
+        for (CacheChange_t& change : changes)
+        {
+            ASSERT_TRUE(pool->get_payload(16u, change));
+        }
+        for (uint32_t n = 0; n < num_payloads; ++n)
+        {
+            ASSERT_TRUE(pool->release_payload(changes[n]));
+        }
+
+        std::thread releaser([&]()
+                {
+                    for (uint32_t n = num_payloads; n < 2u * num_payloads; ++n)
+                    {
+                        pool->release_payload(changes[n]);
+                    }
+                });
+        EXPECT_TRUE(pool->release_history(config, false));
+        releaser.join();
+
+        EXPECT_EQ(num_payloads, pool->payload_pool_allocated_size());
+        EXPECT_EQ(num_payloads, pool->payload_pool_available_size());
+        EXPECT_TRUE(pool->release_history(config, true));
+        EXPECT_EQ(0u, pool->payload_pool_allocated_size());
+    }
+}
+
+TEST(TopicPayloadPoolConcurrencyTests, shrink_fails_with_payloads_in_use)
+{
+    PoolConfig config{ MemoryManagementPolicy_t::PREALLOCATED_MEMORY_MODE, 16u, 4u, 4u };
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    ASSERT_TRUE(pool->reserve_history(config, false));
+
+    CacheChange_t change;
+    ASSERT_TRUE(pool->get_payload(16u, change));
+    EXPECT_FALSE(pool->release_history(config, false));
+    EXPECT_EQ(1u, pool->payload_pool_allocated_size());
+    EXPECT_TRUE(pool->release_payload(change));
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
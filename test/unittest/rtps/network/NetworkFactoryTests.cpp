@@ -627,6 +627,118 @@ TEST_F(NetworkTests, LocatorShrink)
     }
 }
 
+TEST_F(NetworkTests, LocatorSelectorCachedSelection)
+{
+    NetworkFactory f;
+    UDPv4TransportDescriptor udpv4;
+    f.RegisterTransport(&udpv4);
+
+    Locator_t unicast1, unicast2;
+    IPLocator::setIPv4(unicast1, 192, 168, 1, 1);
+    unicast1.port = 7410;
+    IPLocator::setIPv4(unicast2, 192, 168, 1, 2);
+    unicast2.port = 7410;
+
+    LocatorSelectorEntry entry1(SHRINK_TEST_MAX_UNICAST_LOCATORS, SHRINK_TEST_MAX_MULTICAST_LOCATORS);
+    entry1.remote_guid.entityId = 1;
+    entry1.unicast.push_back(unicast1);
+    LocatorSelectorEntry entry2(SHRINK_TEST_MAX_UNICAST_LOCATORS, SHRINK_TEST_MAX_MULTICAST_LOCATORS);
+    entry2.remote_guid.entityId = 2;
+    entry2.unicast.push_back(unicast2);
+
+    LocatorSelector selector(ResourceLimitedContainerConfig::fixed_size_configuration(SHRINK_TEST_MAX_ENTRIES));
+    selector.add_entry(&entry1);
+
+    // Nothing selected yet
+    selector.reset(true);
+    ASSERT_FALSE(selector.selection_is_valid());
+    f.select_locators(selector);
+    ASSERT_EQ(selector.selected_size(), 1u);
+
+    // Same entries enabled, selection is kept
+    selector.reset(true);
+    ASSERT_TRUE(selector.selection_is_valid());
+
+    // Different entries enabled
+    selector.reset(false);
+    ASSERT_FALSE(selector.selection_is_valid());
+    f.select_locators(selector);
+    ASSERT_EQ(selector.selected_size(), 0u);
+    selector.reset(true);
+    ASSERT_FALSE(selector.selection_is_valid());
+    f.select_locators(selector);
+    ASSERT_TRUE(selector.selection_is_valid());
+
+    // Adding an entry invalidates the selection
+    selector.add_entry(&entry2);
+    selector.reset(true);
+    ASSERT_FALSE(selector.selection_is_valid());
+    f.select_locators(selector);
+    ASSERT_EQ(selector.selected_size(), 2u);
+    ASSERT_TRUE(selector.selection_is_valid());
+
+    // Changing the locators of an entry invalidates the selection
+    entry2.unicast.clear();
+    selector.entries_changed();
+    selector.reset(true);
+    ASSERT_FALSE(selector.selection_is_valid());
+    f.select_locators(selector);
+    ASSERT_EQ(selector.selected_size(), 1u);
+
+    // Removing an entry invalidates the selection
+    selector.remove_entry(entry1.remote_guid);
+    selector.reset(true);
+    ASSERT_FALSE(selector.selection_is_valid());
+}
+
+TEST_F(NetworkTests, LocatorSelectorUnicastOnlyEntries)
+{
+    NetworkFactory f;
+    UDPv4TransportDescriptor udpv4;
+    f.RegisterTransport(&udpv4);
+
+    Locator_t multicast;
+    IPLocator::setIPv4(multicast, 239, 255, 0, 1);
+    multicast.port = 7400;
+
+    std::vector<LocatorSelectorEntry> entries;
+    entries.reserve(3);
+    LocatorSelector selector(ResourceLimitedContainerConfig::fixed_size_configuration(SHRINK_TEST_MAX_ENTRIES));
+    for (uint8_t i = 1; i <= 3; ++i)
+    {
+        Locator_t unicast;
+        IPLocator::setIPv4(unicast, 192, 168, 1, i);
+        unicast.port = 7410;
+
+        entries.emplace_back(SHRINK_TEST_MAX_UNICAST_LOCATORS, SHRINK_TEST_MAX_MULTICAST_LOCATORS);
+        entries.back().remote_guid.entityId = i;
+        entries.back().unicast.push_back(unicast);
+        entries.back().multicast.push_back(multicast);
+        selector.add_entry(&entries.back());
+    }
+
+    // Shared multicast locator is selected
+    selector.reset(true);
+    f.select_locators(selector);
+    ASSERT_EQ(selector.selected_size(), 1u);
+
+    // Restricting entries to unicast changes the state
+    selector.reset(true);
+    entries[0].allow_multicast = false;
+    entries[1].allow_multicast = false;
+    ASSERT_TRUE(selector.state_has_changed());
+    ASSERT_FALSE(selector.selection_is_valid());
+    f.select_locators(selector);
+    ASSERT_EQ(selector.selected_size(), 3u);
+
+    // Reset allows multicast again
+    selector.reset(true);
+    ASSERT_TRUE(entries[0].allow_multicast);
+    ASSERT_TRUE(selector.state_has_changed());
+    f.select_locators(selector);
+    ASSERT_EQ(selector.selected_size(), 1u);
+}
+
 int main(int argc, char **argv)
 {
     testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,404 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/reader/IntraprocessDeliveryQueue.hpp>
+
+#include <fastdds/rtps/history/IPayloadPool.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+
+#include <gtest/gtest.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+/**
+ * Payload pool sharing the payloads it owns, counting the references taken.
+ */
+class SharingPayloadPool : public IPayloadPool
+{
+public:
+
+    bool get_payload(
+            uint32_t size,
+            CacheChange_t& cache_change) override
+    {
+        cache_change.serializedPayload.reserve(size);
+        cache_change.payload_owner(this);
+        return true;
+    }
+
+    bool get_payload(
+            SerializedPayload_t& data,
+            IPayloadPool*& data_owner,
+            CacheChange_t& cache_change) override
+    {
+        EXPECT_EQ(this, data_owner);
+        ++references;
+        cache_change.serializedPayload.data = data.data;
+        cache_change.serializedPayload.length = data.length;
+        cache_change.payload_owner(this);
+        return true;
+    }
+
+    bool release_payload(
+            CacheChange_t& cache_change) override
+    {
+        if (cache_change.serializedPayload.data != owned_data)
+        {
+            cache_change.serializedPayload.empty();
+        }
+        else
+        {
+            --references;
+            cache_change.serializedPayload.data = nullptr;
+        }
+        cache_change.serializedPayload.length = 0;
+        cache_change.payload_owner(nullptr);
+        return true;
+    }
+
+    octet* owned_data = nullptr;
+    int references = 0;
+};
+
+/**
+ * Reader recording the messages processed, which can be blocked to simulate a slow listener.
+ */
+class RecordingReader : public RTPSReader
+{
+public:
+
+    bool matched_writer_add(
+            const WriterProxyData&) override
+    {
+        return true;
+    }
+
+    bool matched_writer_remove(
+            const GUID_t&,
+            bool) override
+    {
+        return true;
+    }
+
+    bool matched_writer_is_matched(
+            const GUID_t&) override
+    {
+        return true;
+    }
+
+    bool processDataMsg(
+            CacheChange_t* change) override
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        ++processing;
+        cv.notify_all();
+        cv.wait(lock, [this]()
+                {
+                    return !blocked;
+                });
+        messages.push_back("DATA " + std::to_string(change->sequenceNumber.to64long()));
+        payloads.push_back(change->serializedPayload.data);
+        cv.notify_all();
+        return true;
+    }
+
+    bool processHeartbeatMsg(
+            const GUID_t&,
+            uint32_t,
+            const SequenceNumber_t& first,
+            const SequenceNumber_t& last,
+            bool,
+            bool) override
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        messages.push_back("HEARTBEAT " + std::to_string(first.to64long()) + "-" +
+                std::to_string(last.to64long()));
+        cv.notify_all();
+        return true;
+    }
+
+    bool processGapMsg(
+            const GUID_t&,
+            const SequenceNumber_t& gap_start,
+            const SequenceNumberSet_t& gap_list) override
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        messages.push_back("GAP " + std::to_string(gap_start.to64long()) + "-" +
+                std::to_string(gap_list.base().to64long()));
+        cv.notify_all();
+        return true;
+    }
+
+    void intraprocess_messages_processed(
+            const GUID_t& writer_guid) override
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        reports.push_back({writer_guid, messages.size()});
+        cv.notify_all();
+    }
+
+    void wait_messages(
+            size_t n)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this, n]()
+                {
+                    return messages.size() >= n;
+                });
+    }
+
+    void wait_processing(
+            size_t n)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this, n]()
+                {
+                    return processing >= n;
+                });
+    }
+
+    void wait_reports(
+            size_t n)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this, n]()
+                {
+                    return reports.size() >= n;
+                });
+    }
+
+    void unblock()
+    {
+        std::lock_guard<std::mutex> guard(mutex);
+        blocked = false;
+        cv.notify_all();
+    }
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool blocked = false;
+    size_t processing = 0;
+    std::vector<std::string> messages;
+    std::vector<octet*> payloads;
+    //! Writers reported as processed, with the number of messages processed at that moment
+    std::vector<std::pair<GUID_t, size_t>> reports;
+};
+
+class IntraprocessDeliveryQueueTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        writer_guid.entityId.value[3] = 0x03;
+        payload.reserve(16);
+        payload.length = 16;
+        pool.owned_data = payload.data;
+    }
+
+    void TearDown() override
+    {
+        payload.empty();
+    }
+
+    CacheChange_t* make_change(
+            int64_t seq)
+    {
+        changes.emplace_back(new CacheChange_t());
+        CacheChange_t* change = changes.back().get();
+        change->writerGUID = writer_guid;
+        change->sequenceNumber = SequenceNumber_t(0, static_cast<uint32_t>(seq));
+        change->serializedPayload.data = payload.data;
+        change->serializedPayload.length = payload.length;
+        change->payload_owner(&pool);
+        return change;
+    }
+
+    void release_changes()
+    {
+        for (auto& change : changes)
+        {
+            change->serializedPayload.data = nullptr;
+            change->payload_owner(nullptr);
+        }
+        changes.clear();
+    }
+
+    GUID_t writer_guid;
+    SerializedPayload_t payload;
+    SharingPayloadPool pool;
+    std::vector<std::unique_ptr<CacheChange_t>> changes;
+};
+
+TEST_F(IntraprocessDeliveryQueueTests, messages_are_processed_in_order)
+{
+    RecordingReader reader;
+    {
+        IntraprocessDeliveryQueue queue(&reader, 8);
+        EXPECT_EQ(8u, queue.capacity());
+
+        EXPECT_TRUE(queue.push_heartbeat(writer_guid, 1, SequenceNumber_t(0, 1), SequenceNumber_t(0, 2), false));
+        EXPECT_TRUE(queue.push_data(make_change(1)));
+        EXPECT_TRUE(queue.push_gap(writer_guid, SequenceNumber_t(0, 2), SequenceNumber_t(0, 3)));
+        EXPECT_TRUE(queue.push_data(make_change(3)));
+
+        reader.wait_messages(4);
+    }
+    release_changes();
+
+    std::vector<std::string> expected = {"HEARTBEAT 1-2", "DATA 1", "GAP 2-3", "DATA 3"};
+    EXPECT_EQ(expected, reader.messages);
+}
+
+TEST_F(IntraprocessDeliveryQueueTests, payload_is_shared_with_writer)
+{
+    RecordingReader reader;
+    {
+        IntraprocessDeliveryQueue queue(&reader, 4);
+        EXPECT_TRUE(queue.push_data(make_change(1)));
+
+        // The writer may remove its change as soon as it is queued
+        release_changes();
+
+        reader.wait_messages(1);
+    }
+
+    ASSERT_EQ(1u, reader.payloads.size());
+    EXPECT_EQ(payload.data, reader.payloads[0]);
+    EXPECT_EQ(0, pool.references);
+}
+
+TEST_F(IntraprocessDeliveryQueueTests, slow_reader_does_not_block_writer)
+{
+    RecordingReader reader;
+    reader.blocked = true;
+    {
+        IntraprocessDeliveryQueue queue(&reader, 2);
+
+        // First change is taken by the delivery thread, which blocks on it. Then the queue fills up.
+        EXPECT_TRUE(queue.push_data(make_change(1)));
+        int64_t seq = 2;
+        while (queue.push_data(make_change(seq)))
+        {
+            ++seq;
+        }
+        EXPECT_LE(seq, 4);
+        EXPECT_EQ(1u, queue.refused_messages());
+
+        reader.unblock();
+        reader.wait_messages(static_cast<size_t>(seq - 1));
+
+        // There is room again
+        EXPECT_TRUE(queue.push_data(make_change(seq)));
+        reader.wait_messages(static_cast<size_t>(seq));
+    }
+    release_changes();
+    EXPECT_EQ(0, pool.references);
+}
+
+TEST_F(IntraprocessDeliveryQueueTests, stopped_queue_refuses_messages)
+{
+    RecordingReader reader;
+    IntraprocessDeliveryQueue queue(&reader, 4);
+    queue.stop();
+
+    EXPECT_FALSE(queue.push_data(make_change(1)));
+    EXPECT_FALSE(queue.push_gap(writer_guid, SequenceNumber_t(0, 1), SequenceNumber_t(0, 2)));
+    release_changes();
+    EXPECT_EQ(0, pool.references);
+    EXPECT_TRUE(reader.messages.empty());
+}
+
+TEST_F(IntraprocessDeliveryQueueTests, processed_writers_are_reported_once_queue_is_drained)
+{
+    GUID_t other_writer_guid = writer_guid;
+    other_writer_guid.entityId.value[2] = 0x01;
+
+    RecordingReader reader;
+    reader.blocked = true;
+    {
+        IntraprocessDeliveryQueue queue(&reader, 8);
+
+        EXPECT_TRUE(queue.push_data(make_change(1)));
+        EXPECT_TRUE(queue.push_gap(other_writer_guid, SequenceNumber_t(0, 1), SequenceNumber_t(0, 2)));
+        EXPECT_TRUE(queue.push_data(make_change(2)));
+        reader.unblock();
+
+        // Each writer is reported once, after all its messages were processed
+        reader.wait_reports(2);
+        ASSERT_EQ(2u, reader.reports.size());
+        EXPECT_EQ(writer_guid, reader.reports[0].first);
+        EXPECT_EQ(other_writer_guid, reader.reports[1].first);
+        EXPECT_EQ(3u, reader.reports[0].second);
+        EXPECT_EQ(3u, reader.reports[1].second);
+    }
+    release_changes();
+    EXPECT_EQ(0, pool.references);
+}
+
+TEST_F(IntraprocessDeliveryQueueTests, pending_messages_are_released_on_destruction)
+{
+    RecordingReader reader;
+    reader.blocked = true;
+    std::unique_ptr<IntraprocessDeliveryQueue> queue(new IntraprocessDeliveryQueue(&reader, 2));
+
+    // First change blocks the delivery thread, the others stay on the queue until it is full
+    EXPECT_TRUE(queue->push_data(make_change(1)));
+    reader.wait_processing(1);
+    int64_t seq = 2;
+    while (queue->push_data(make_change(seq)))
+    {
+        ++seq;
+    }
+    uint64_t refused = queue->refused_messages();
+    EXPECT_EQ(1u, refused);
+
+    IntraprocessDeliveryQueue* queue_ptr = queue.get();
+    std::thread unblocker([&]()
+            {
+                // A stopped queue refuses messages without counting them as refused because it was full
+                while (queue_ptr->push_data(make_change(seq)) || queue_ptr->refused_messages() != refused)
+                {
+                    refused = queue_ptr->refused_messages();
+                    std::this_thread::yield();
+                }
+                reader.unblock();
+            });
+
+    queue.reset();
+    unblocker.join();
+
+    // Only the message being processed when the queue was stopped reached the reader
+    std::vector<std::string> expected = {"DATA 1"};
+    EXPECT_EQ(expected, reader.messages);
+    EXPECT_TRUE(reader.reports.empty());
+
+    release_changes();
+    EXPECT_EQ(0, pool.references);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
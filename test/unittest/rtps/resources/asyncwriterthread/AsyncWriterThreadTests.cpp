@@ -0,0 +1,147 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/resources/AsyncWriterThread.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+
+#include <memory>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using ::testing::ReturnRef;
+
+class TestWriter : public RTPSWriter
+{
+public:
+
+    TestWriter(
+            const GUID_t& guid)
+        : guid_(guid)
+    {
+        ON_CALL(*this, getGuid()).WillByDefault(ReturnRef(guid_));
+    }
+
+    bool matched_reader_add(
+            const ReaderProxyData&) override
+    {
+        return true;
+    }
+
+    bool matched_reader_remove(
+            const GUID_t&) override
+    {
+        return true;
+    }
+
+    bool matched_reader_is_matched(
+            const GUID_t&) override
+    {
+        return false;
+    }
+
+private:
+
+    GUID_t guid_;
+};
+
+class AsyncWriterThreadTests : public ::testing::Test
+{
+protected:
+
+    /*
+     * Writers of an application creating a writer and a reader per topic. Readers and writers take their entity keys
+     * from the same counter, so writers only get odd keys.
+     */
+    void create_writers(
+            uint32_t count)
+    {
+        uint32_t first_topic = static_cast<uint32_t>(writers_.size());
+        for (uint32_t topic = first_topic; topic < first_topic + count; ++topic)
+        {
+            uint32_t key = 2u * topic + 1u;
+            GUID_t guid;
+            guid.guidPrefix.value[0] = 1;
+            guid.entityId.value[1] = static_cast<octet>(key >> 8);
+            guid.entityId.value[2] = static_cast<octet>(key);
+            guid.entityId.value[3] = 0x03;
+            writers_.emplace_back(new ::testing::NiceMock<TestWriter>(guid));
+        }
+    }
+
+    std::vector<std::unique_ptr<TestWriter>> writers_;
+};
+
+TEST_F(AsyncWriterThreadTests, writers_land_on_different_threads)
+{
+    AsyncWriterThreadsAllocationAttributes allocation;
+    allocation.count = 2u;
+    AsyncWriterThread async_thread(allocation, eprosima::fastdds::rtps::ThreadSettings());
+    create_writers(10u);
+
+    std::vector<size_t> writers_per_thread(async_thread.thread_count(), 0u);
+    for (auto& writer : writers_)
+    {
+        ++writers_per_thread[async_thread.thread_of(writer.get())];
+    }
+
+    EXPECT_EQ(5u, writers_per_thread[0]);
+    EXPECT_EQ(5u, writers_per_thread[1]);
+}
+
+TEST_F(AsyncWriterThreadTests, writer_keeps_its_thread)
+{
+    AsyncWriterThreadsAllocationAttributes allocation;
+    allocation.count = 3u;
+    AsyncWriterThread async_thread(allocation, eprosima::fastdds::rtps::ThreadSettings());
+    create_writers(7u);
+
+    std::vector<size_t> threads;
+    for (auto& writer : writers_)
+    {
+        threads.push_back(async_thread.thread_of(writer.get()));
+    }
+
+    for (size_t i = 0; i < writers_.size(); ++i)
+    {
+        EXPECT_EQ(threads[i], async_thread.thread_of(writers_[i].get()));
+    }
+}
+
+TEST_F(AsyncWriterThreadTests, unregistered_writers_leave_room)
+{
+    AsyncWriterThreadsAllocationAttributes allocation;
+    allocation.count = 2u;
+    AsyncWriterThread async_thread(allocation, eprosima::fastdds::rtps::ThreadSettings());
+    create_writers(3u);
+
+    ASSERT_EQ(0u, async_thread.thread_of(writers_[0].get()));
+    ASSERT_EQ(1u, async_thread.thread_of(writers_[1].get()));
+    ASSERT_EQ(0u, async_thread.thread_of(writers_[2].get()));
+
+    // The second thread has the fewest writers once the first one loses one
+    async_thread.unregister_writer(writers_[0].get());
+    async_thread.unregister_writer(writers_[2].get());
+    create_writers(1u);
+    EXPECT_EQ(0u, async_thread.thread_of(writers_[3].get()));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
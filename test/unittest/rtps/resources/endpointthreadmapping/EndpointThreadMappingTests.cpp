@@ -0,0 +1,163 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <rtps/resources/EndpointThreadMapping.hpp>
+
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+
+/*
+ * GUID of a user endpoint, with the entity key the participant assigns from the counter shared by readers and
+ * writers.
+ */
+static GUID_t user_endpoint(
+        uint32_t key,
+        bool writer)
+{
+    GUID_t guid;
+    guid.guidPrefix.value[0] = 1;
+    guid.entityId.value[0] = static_cast<octet>(key >> 16);
+    guid.entityId.value[1] = static_cast<octet>(key >> 8);
+    guid.entityId.value[2] = static_cast<octet>(key);
+    guid.entityId.value[3] = writer ? 0x03 : 0x04;
+    return guid;
+}
+
+static GUID_t builtin_endpoint(
+        const EntityId_t& entity_id)
+{
+    GUID_t guid;
+    guid.guidPrefix.value[0] = 1;
+    guid.entityId = entity_id;
+    return guid;
+}
+
+TEST(EndpointThreadMappingTests, single_thread)
+{
+    EndpointThreadMapping mapping(1u, true);
+    EXPECT_EQ(1u, mapping.thread_count());
+    EXPECT_EQ(0u, mapping.thread_for(user_endpoint(1u, true)));
+    EXPECT_EQ(0u, mapping.thread_for(user_endpoint(2u, false)));
+    EXPECT_EQ(0u, mapping.thread_for(builtin_endpoint(c_EntityId_SEDPPubWriter)));
+}
+
+TEST(EndpointThreadMappingTests, endpoint_keeps_its_thread)
+{
+    EndpointThreadMapping mapping(4u, false);
+    std::vector<size_t> threads;
+    for (uint32_t key = 1u; key <= 10u; ++key)
+    {
+        threads.push_back(mapping.thread_for(user_endpoint(key, true)));
+    }
+
+    for (uint32_t key = 1u; key <= 10u; ++key)
+    {
+        EXPECT_EQ(threads[key - 1u], mapping.thread_for(user_endpoint(key, true)));
+    }
+}
+
+TEST(EndpointThreadMappingTests, writers_spread_when_sharing_keys_with_readers)
+{
+    // An application creating a writer and a reader per topic, with only the writers asking for a thread, as on
+    // the asynchronous writer threads. Taking the thread from the entity key would put every writer on the same one.
+    EndpointThreadMapping mapping(2u, false);
+    for (uint32_t topic = 0; topic < 10u; ++topic)
+    {
+        mapping.thread_for(user_endpoint(2u * topic + 1u, true));
+    }
+
+    EXPECT_EQ(5u, mapping.endpoint_count(0u));
+    EXPECT_EQ(5u, mapping.endpoint_count(1u));
+}
+
+TEST(EndpointThreadMappingTests, readers_and_writers_spread)
+{
+    EndpointThreadMapping mapping(3u, false);
+    for (uint32_t key = 1u; key <= 12u; ++key)
+    {
+        mapping.thread_for(user_endpoint(key, key % 2u == 0u));
+    }
+
+    for (size_t thread = 0; thread < 3u; ++thread)
+    {
+        EXPECT_EQ(4u, mapping.endpoint_count(thread));
+    }
+}
+
+TEST(EndpointThreadMappingTests, isolate_builtin_endpoints)
+{
+    EndpointThreadMapping mapping(3u, true);
+    EXPECT_EQ(0u, mapping.thread_for(builtin_endpoint(c_EntityId_SPDPWriter)));
+    EXPECT_EQ(0u, mapping.thread_for(builtin_endpoint(c_EntityId_SEDPPubWriter)));
+    EXPECT_EQ(0u, mapping.thread_for(builtin_endpoint(c_EntityId_SEDPSubReader)));
+
+    for (uint32_t key = 1u; key <= 10u; ++key)
+    {
+        EXPECT_NE(0u, mapping.thread_for(user_endpoint(key, true)));
+    }
+
+    EXPECT_EQ(0u, mapping.endpoint_count(0u));
+    EXPECT_EQ(5u, mapping.endpoint_count(1u));
+    EXPECT_EQ(5u, mapping.endpoint_count(2u));
+}
+
+TEST(EndpointThreadMappingTests, builtin_endpoints_shared_when_not_isolated)
+{
+    EndpointThreadMapping mapping(2u, false);
+    EXPECT_EQ(0u, mapping.thread_for(builtin_endpoint(c_EntityId_SEDPPubWriter)));
+    EXPECT_EQ(1u, mapping.thread_for(builtin_endpoint(c_EntityId_SEDPSubWriter)));
+    EXPECT_EQ(0u, mapping.thread_for(user_endpoint(1u, true)));
+    EXPECT_EQ(1u, mapping.thread_for(user_endpoint(2u, false)));
+}
+
+TEST(EndpointThreadMappingTests, isolation_ignored_with_single_thread)
+{
+    EndpointThreadMapping mapping(1u, true);
+    EXPECT_EQ(0u, mapping.thread_for(user_endpoint(1u, true)));
+}
+
+TEST(EndpointThreadMappingTests, released_endpoints_leave_room)
+{
+    EndpointThreadMapping mapping(3u, false);
+    for (uint32_t key = 1u; key <= 6u; ++key)
+    {
+        mapping.thread_for(user_endpoint(key, true));
+    }
+
+    // Endpoints 2 and 5 went to the second thread
+    ASSERT_EQ(1u, mapping.thread_for(user_endpoint(2u, true)));
+    ASSERT_EQ(1u, mapping.thread_for(user_endpoint(5u, true)));
+    mapping.release(user_endpoint(2u, true));
+    mapping.release(user_endpoint(5u, true));
+    EXPECT_EQ(0u, mapping.endpoint_count(1u));
+
+    EXPECT_EQ(1u, mapping.thread_for(user_endpoint(7u, true)));
+    EXPECT_EQ(1u, mapping.thread_for(user_endpoint(8u, true)));
+    EXPECT_EQ(0u, mapping.thread_for(user_endpoint(9u, true)));
+
+    // Releasing an unknown endpoint does nothing
+    mapping.release(user_endpoint(100u, true));
+    EXPECT_EQ(3u, mapping.endpoint_count(0u));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
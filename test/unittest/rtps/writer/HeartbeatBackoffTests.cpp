@@ -0,0 +1,97 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <rtps/writer/HeartbeatBackoff.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+TEST(HeartbeatBackoffTests, disabled_backoff_keeps_period)
+{
+    HeartbeatBackoff backoff(1);
+    EXPECT_FALSE(backoff.is_enabled());
+
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        EXPECT_FALSE(backoff.heartbeat_sent());
+        EXPECT_EQ(1u, backoff.factor());
+    }
+
+    EXPECT_EQ(10u, backoff.heartbeats_sent());
+    EXPECT_EQ(0u, backoff.heartbeats_saved());
+}
+
+TEST(HeartbeatBackoffTests, period_doubles_up_to_max_factor)
+{
+    HeartbeatBackoff backoff(6);
+    ASSERT_TRUE(backoff.is_enabled());
+
+    EXPECT_TRUE(backoff.heartbeat_sent());
+    EXPECT_EQ(2u, backoff.factor());
+    EXPECT_TRUE(backoff.heartbeat_sent());
+    EXPECT_EQ(4u, backoff.factor());
+    EXPECT_TRUE(backoff.heartbeat_sent());
+    EXPECT_EQ(6u, backoff.factor());
+    EXPECT_FALSE(backoff.heartbeat_sent());
+    EXPECT_EQ(6u, backoff.factor());
+
+    // Sent with factors 1, 2, 4, 6
+    EXPECT_EQ(4u, backoff.heartbeats_sent());
+    EXPECT_EQ(0u + 1u + 3u + 5u, backoff.heartbeats_saved());
+}
+
+TEST(HeartbeatBackoffTests, reset_goes_back_to_configured_period)
+{
+    HeartbeatBackoff backoff(8);
+
+    EXPECT_FALSE(backoff.reset());
+    backoff.heartbeat_sent();
+    backoff.heartbeat_sent();
+    EXPECT_EQ(4u, backoff.factor());
+
+    EXPECT_TRUE(backoff.reset());
+    EXPECT_EQ(1u, backoff.factor());
+    EXPECT_FALSE(backoff.reset());
+
+    // Statistics are kept
+    EXPECT_EQ(2u, backoff.heartbeats_sent());
+    EXPECT_EQ(1u, backoff.heartbeats_saved());
+}
+
+TEST(HeartbeatBackoffTests, silent_reader_backs_off_while_another_answers)
+{
+    // A writer with a reader which acknowledged everything and answers every heartbeat, and a silent one
+    HeartbeatBackoff backoff(8);
+
+    for (uint32_t expected_factor : {2u, 4u, 8u, 8u})
+    {
+        backoff.heartbeat_sent();
+        EXPECT_FALSE(backoff.acknack_received(false));
+        EXPECT_EQ(expected_factor, backoff.factor());
+    }
+
+    // The silent reader comes back, and still misses changes
+    EXPECT_TRUE(backoff.acknack_received(true));
+    EXPECT_EQ(1u, backoff.factor());
+    EXPECT_FALSE(backoff.acknack_received(true));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
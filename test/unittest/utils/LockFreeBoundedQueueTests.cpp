@@ -0,0 +1,111 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utils/collections/LockFreeBoundedQueue.hpp>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+using namespace eprosima::fastrtps;
+
+TEST(LockFreeBoundedQueueTests, capacity_is_rounded_up)
+{
+    LockFreeBoundedQueue<int> uut(5);
+    ASSERT_EQ(8u, uut.capacity());
+    ASSERT_EQ(0u, uut.size());
+}
+
+TEST(LockFreeBoundedQueueTests, elements_are_taken_in_order)
+{
+    LockFreeBoundedQueue<int> uut(4);
+
+    // Several laps over the cells
+    for (int lap = 0; lap < 3; ++lap)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            ASSERT_TRUE(uut.try_push(lap * 4 + i));
+        }
+        ASSERT_FALSE(uut.try_push(-1));
+        ASSERT_EQ(4u, uut.size());
+
+        int value = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            ASSERT_TRUE(uut.try_pop(value));
+            ASSERT_EQ(lap * 4 + i, value);
+        }
+        ASSERT_FALSE(uut.try_pop(value));
+        ASSERT_EQ(0u, uut.size());
+    }
+}
+
+TEST(LockFreeBoundedQueueTests, elements_are_not_lost_between_threads)
+{
+    constexpr int num_threads = 4;
+    constexpr int num_elements = 10000;
+    LockFreeBoundedQueue<int> uut(64);
+    std::atomic<long long> popped_sum(0);
+    std::atomic<int> popped_count(0);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < num_threads; ++t)
+    {
+        threads.emplace_back([&uut, t]()
+                {
+                    for (int i = 1; i <= num_elements; ++i)
+                    {
+                        while (!uut.try_push(t * num_elements + i))
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+        threads.emplace_back([&]()
+                {
+                    int value = 0;
+                    while (popped_count.load() < num_threads * num_elements)
+                    {
+                        if (uut.try_pop(value))
+                        {
+                            popped_sum += value;
+                            ++popped_count;
+                        }
+                        else
+                        {
+                            std::this_thread::yield();
+                        }
+                    }
+                });
+    }
+
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    long long total = static_cast<long long>(num_threads) * num_elements;
+    ASSERT_EQ(total * (total + 1) / 2, popped_sum.load());
+    ASSERT_EQ(0u, uut.size());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,106 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utils/numa.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+using namespace eprosima;
+
+TEST(NumaTests, page_aligned_memory)
+{
+    const size_t size = 100u;
+    size_t aligned_size = round_up_to_page_size(size);
+    EXPECT_GE(aligned_size, size);
+    EXPECT_EQ(aligned_size, round_up_to_page_size(aligned_size));
+
+    unsigned char* block = static_cast<unsigned char*>(allocate_page_aligned_memory(size));
+    ASSERT_NE(nullptr, block);
+
+    // The whole block is zeroed and usable
+    for (size_t i = 0; i < aligned_size; ++i)
+    {
+        EXPECT_EQ(0u, block[i]);
+    }
+    memset(block, 0xFF, aligned_size);
+
+#if defined(__linux__)
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(block) % page_size);
+    EXPECT_EQ(page_size, aligned_size);
+#endif // if defined(__linux__)
+
+    free_page_aligned_memory(block);
+    free_page_aligned_memory(nullptr);
+}
+
+TEST(NumaTests, bind_whole_pages)
+{
+    int32_t node = current_numa_node();
+    if (unknown_numa_node == node)
+    {
+        std::cout << "Skipping test, as the NUMA node is not known on this platform" << std::endl;
+        return;
+    }
+
+    const size_t size = round_up_to_page_size(3u * 4096u);
+    void* block = allocate_page_aligned_memory(size);
+    ASSERT_NE(nullptr, block);
+
+    EXPECT_TRUE(bind_memory_to_numa_node(block, size, node));
+    EXPECT_FALSE(bind_memory_to_numa_node(block, size, -2));
+
+    // Blocks smaller than a page are left alone
+    EXPECT_TRUE(bind_memory_to_numa_node(static_cast<char*>(block) + 1, 100u, node));
+
+#if defined(__linux__) && defined(SYS_move_pages)
+    // Every page of the block should be on the node
+    size_t page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    std::vector<void*> pages;
+    for (size_t offset = 0; offset < size; offset += page_size)
+    {
+        pages.push_back(static_cast<char*>(block) + offset);
+    }
+    std::vector<int> status(pages.size(), -1);
+    ASSERT_EQ(0, syscall(SYS_move_pages, 0, pages.size(), pages.data(), nullptr, status.data(), 0));
+    for (int page_node : status)
+    {
+        EXPECT_EQ(node, page_node);
+    }
+#endif // if defined(__linux__) && defined(SYS_move_pages)
+
+    free_page_aligned_memory(block);
+}
+
+TEST(NumaTests, parse_auto_numa_node)
+{
+    EXPECT_EQ(current_numa_node(), parse_numa_node("auto"));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,87 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utils/PartitionMatcher.hpp>
+#include <fastrtps/utils/StringMatching.h>
+#include <gtest/gtest.h>
+
+#include <string>
+#include <vector>
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::dds::PartitionQosPolicy;
+
+static PartitionQosPolicy partitions(
+        const std::vector<std::string>& names)
+{
+    PartitionQosPolicy ret;
+    for (const std::string& name : names)
+    {
+        ret.push_back(name.c_str());
+    }
+    return ret;
+}
+
+static bool match(
+        const std::vector<std::string>& names1,
+        const std::vector<std::string>& names2)
+{
+    PartitionMatcher matcher1(partitions(names1));
+    PartitionMatcher matcher2(partitions(names2));
+    bool ret = matcher1.matches(matcher2);
+    EXPECT_EQ(ret, matcher2.matches(matcher1));
+    return ret;
+}
+
+TEST(PartitionMatcherTests, same_result_as_string_matching)
+{
+    std::vector<std::string> names = {
+        "foo/bar/baz", "foo*", "*baz", "foo/*/baz", "foo/bar/ba?", "*ba?*", "foo\\bar\\baz", "*bar", "*",
+        "foo/bar/qux", "FOO/BAR/QUX", "", "?", "**", "a*b*c", "abc", "aXbYc", "ab", "a*bc*bc", "abcbc",
+        "foo/ba[rz]/baz", "[!f]oo"
+    };
+
+    for (const std::string& name1 : names)
+    {
+        for (const std::string& name2 : names)
+        {
+            EXPECT_EQ(StringMatching::matchString(name1.c_str(), name2.c_str()), match({name1}, {name2}))
+                << "'" << name1 << "' vs '" << name2 << "'";
+        }
+    }
+}
+
+TEST(PartitionMatcherTests, any_pair_of_names)
+{
+    ASSERT_TRUE(match({"A", "B"}, {"C", "B"}));
+    ASSERT_TRUE(match({"A", "B*"}, {"C", "Bar"}));
+    ASSERT_TRUE(match({"A", "B*"}, {"C", "B?r"}));
+    ASSERT_FALSE(match({"A", "B"}, {"C", "D"}));
+    ASSERT_FALSE(match({"A", "B*"}, {"C", "D*"}));
+}
+
+TEST(PartitionMatcherTests, empty_lists)
+{
+    ASSERT_TRUE(match({}, {}));
+    ASSERT_FALSE(match({}, {"A"}));
+    ASSERT_FALSE(match({"*"}, {}));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
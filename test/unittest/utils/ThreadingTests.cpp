@@ -0,0 +1,239 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <utils/threading.hpp>
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <gtest/gtest.h>
+
+#include <iostream>
+#include <atomic>
+#include <thread>
+
+#if defined(__linux__) && !defined(__ANDROID__)
+#include <pthread.h>
+#include <sched.h>
+#endif // if defined(__linux__) && !defined(__ANDROID__)
+
+using eprosima::apply_thread_settings_to_current_thread;
+using eprosima::create_std_thread;
+using eprosima::create_thread;
+using eprosima::fastdds::rtps::ThreadSettings;
+using eprosima::fastrtps::Thread;
+
+TEST(ThreadingTests, default_settings_are_applied)
+{
+    bool applied = false;
+    std::thread thread([&applied]()
+            {
+                applied = apply_thread_settings_to_current_thread("test", ThreadSettings());
+            });
+    thread.join();
+
+    EXPECT_TRUE(applied);
+}
+
+TEST(ThreadingTests, wrong_settings_are_reported)
+{
+    ThreadSettings settings;
+    settings.scheduling_policy = 12345;
+
+    bool applied = true;
+    std::thread thread([&applied, &settings]()
+            {
+                applied = apply_thread_settings_to_current_thread("test", settings);
+            });
+    thread.join();
+
+    EXPECT_FALSE(applied);
+}
+
+TEST(ThreadingTests, thread_runs_and_joins)
+{
+    std::atomic<bool> is_calling_thread{false};
+    Thread* thread_ptr = nullptr;
+    Thread thread([&]()
+            {
+                while (nullptr == thread_ptr)
+                {
+                    std::this_thread::yield();
+                }
+                is_calling_thread = thread_ptr->is_calling_thread();
+            }, 0);
+    EXPECT_TRUE(thread.joinable());
+    EXPECT_FALSE(thread.is_calling_thread());
+
+    // Moving keeps the same thread
+    Thread moved(std::move(thread));
+    EXPECT_FALSE(thread.joinable());
+    ASSERT_TRUE(moved.joinable());
+    thread_ptr = &moved;
+
+    moved.join();
+    EXPECT_FALSE(moved.joinable());
+    EXPECT_TRUE(is_calling_thread);
+}
+
+TEST(ThreadingTests, create_thread_applies_settings)
+{
+    ThreadSettings settings;
+    settings.scheduling_policy = 12345;
+
+    // Wrong settings are reported, but the function runs anyway
+    bool ran = false;
+    Thread thread = create_thread([&ran]()
+                    {
+                        ran = true;
+                    }, settings, "test");
+    thread.join();
+
+    EXPECT_TRUE(ran);
+}
+
+#if defined(__linux__) && !defined(__ANDROID__)
+TEST(ThreadingTests, create_std_thread_applies_settings)
+{
+    // The stack size of a std::thread cannot be chosen, but the rest of settings are applied
+    ThreadSettings settings;
+    settings.affinity = 1u;
+    settings.stack_size = 32 * 1024 * 1024;
+
+    bool only_first_core = false;
+    std::thread thread = create_std_thread([&only_first_core]()
+                    {
+                        cpu_set_t cpu_set;
+                        CPU_ZERO(&cpu_set);
+                        if (0 == pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set))
+                        {
+                            only_first_core = 1 == CPU_COUNT(&cpu_set) && CPU_ISSET(0, &cpu_set);
+                        }
+                    }, settings, "test");
+    thread.join();
+
+    EXPECT_TRUE(only_first_core);
+}
+
+TEST(ThreadingTests, stack_size_is_applied)
+{
+    // Larger than the usual default, as the OS may reuse the stack of a finished thread when it is large enough
+    ThreadSettings settings;
+    settings.stack_size = 32 * 1024 * 1024;
+
+    size_t stack_size = 0;
+    Thread thread = create_thread([&stack_size]()
+                    {
+                        pthread_attr_t attr;
+                        if (0 == pthread_getattr_np(pthread_self(), &attr))
+                        {
+                            pthread_attr_getstacksize(&attr, &stack_size);
+                            pthread_attr_destroy(&attr);
+                        }
+                    }, settings, "test");
+    thread.join();
+
+    EXPECT_LE(settings.stack_size, stack_size);
+}
+
+TEST(ThreadingTests, wrong_stack_size_falls_back_to_default)
+{
+    ThreadSettings settings;
+    settings.stack_size = 1;
+
+    bool ran = false;
+    Thread thread = create_thread([&ran]()
+                    {
+                        ran = true;
+                    }, settings, "test");
+    thread.join();
+
+    EXPECT_TRUE(ran);
+}
+
+TEST(ThreadingTests, realtime_policy_without_priority)
+{
+    // Real time policies need privileges, which are checked with a valid priority
+    bool allowed = false;
+    std::thread probe([&allowed]()
+            {
+                sched_param param;
+                param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+                allowed = 0 == pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+            });
+    probe.join();
+    if (!allowed)
+    {
+        std::cout << "Skipping test, as SCHED_FIFO is not allowed" << std::endl;
+        return;
+    }
+
+    ThreadSettings settings;
+    settings.scheduling_policy = SCHED_FIFO;
+
+    bool applied = false;
+    int policy = -1;
+    sched_param param;
+    param.sched_priority = -1;
+    std::thread thread([&]()
+            {
+                applied = apply_thread_settings_to_current_thread("test", settings);
+                pthread_getschedparam(pthread_self(), &policy, &param);
+            });
+    thread.join();
+
+    EXPECT_TRUE(applied);
+    EXPECT_EQ(SCHED_FIFO, policy);
+    EXPECT_EQ(sched_get_priority_min(SCHED_FIFO), param.sched_priority);
+}
+
+TEST(ThreadingTests, affinity_is_applied)
+{
+    // Pin the thread to the first core the process is allowed to run on
+    cpu_set_t allowed;
+    ASSERT_EQ(0, pthread_getaffinity_np(pthread_self(), sizeof(allowed), &allowed));
+    int cpu = 0;
+    while (cpu < 64 && !CPU_ISSET(cpu, &allowed))
+    {
+        ++cpu;
+    }
+    ASSERT_LT(cpu, 64);
+
+    ThreadSettings settings;
+    settings.affinity = static_cast<uint64_t>(1) << cpu;
+
+    bool applied = false;
+    cpu_set_t result;
+    CPU_ZERO(&result);
+    std::thread thread([&]()
+            {
+                applied = apply_thread_settings_to_current_thread("test", settings);
+                pthread_getaffinity_np(pthread_self(), sizeof(result), &result);
+            });
+    thread.join();
+
+    EXPECT_TRUE(applied);
+    EXPECT_EQ(1, CPU_COUNT(&result));
+    EXPECT_TRUE(CPU_ISSET(cpu, &result));
+}
+#endif // if defined(__linux__) && !defined(__ANDROID__)
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    int ret = RUN_ALL_TESTS();
+    eprosima::fastdds::dds::Log::KillThread();
+    return ret;
+}
@@ -52,8 +52,16 @@ void TestClearConsumersFunc()
     log_mock->ClearConsumers();
 }
 
+void TestSetThreadConfigFunc(
+        const eprosima::fastdds::rtps::ThreadSettings& settings)
+{
+    log_mock->SetThreadConfig(settings);
+}
+
 std::function<void(std::unique_ptr<LogConsumer>&&)> Log::RegisterConsumerFunc = TestRegisterConsumerFunc;
 std::function<void()> Log::ClearConsumersFunc = TestClearConsumersFunc;
+std::function<void(const eprosima::fastdds::rtps::ThreadSettings&)> Log::SetThreadConfigFunc =
+        TestSetThreadConfigFunc;
 
 class XMLProfileParserTests : public ::testing::Test
 {
@@ -144,6 +152,10 @@ TEST_F(XMLProfileParserTests, XMLParserParcipant)
     EXPECT_EQ(rtps_atts.allocation.writers.increment, 2u);
     EXPECT_EQ(rtps_atts.allocation.send_buffers.preallocated_number, 127u);
     EXPECT_EQ(rtps_atts.allocation.send_buffers.dynamic, true);
+    EXPECT_EQ(rtps_atts.allocation.event_threads.count, 4u);
+    EXPECT_EQ(rtps_atts.allocation.event_threads.isolate_builtin_endpoints, true);
+    EXPECT_EQ(rtps_atts.allocation.async_writer_threads.count, 3u);
+    EXPECT_EQ(rtps_atts.allocation.async_writer_threads.isolate_builtin_endpoints, false);
 
     IPLocator::setIPv4(locator, 192, 168, 1, 2);
     locator.port = 2019;
@@ -203,8 +215,25 @@ TEST_F(XMLProfileParserTests, XMLParserParcipant)
     EXPECT_EQ(rtps_atts.participantID, 9898);
     EXPECT_EQ(rtps_atts.throughputController.bytesPerPeriod, 2048u);
     EXPECT_EQ(rtps_atts.throughputController.periodMillisecs, 45u);
+    EXPECT_EQ(rtps_atts.throughputController.scheduler, FlowControllerSchedulerPolicy::HIGH_PRIORITY);
+    EXPECT_EQ(rtps_atts.destination_throughput_controller.bytesPerPeriod, 1024u);
+    EXPECT_EQ(rtps_atts.destination_throughput_controller.periodMillisecs, 10u);
     EXPECT_EQ(rtps_atts.useBuiltinTransports, true);
     EXPECT_EQ(std::string(rtps_atts.getName()), "test_name");
+    EXPECT_EQ(rtps_atts.builtin_transports_reception_threads.scheduling_policy, 1);
+    EXPECT_EQ(rtps_atts.builtin_transports_reception_threads.priority, 50);
+    EXPECT_EQ(rtps_atts.builtin_transports_reception_threads.affinity, 12u);
+    EXPECT_EQ(rtps_atts.timed_events_thread.scheduling_policy, -1);
+    EXPECT_EQ(rtps_atts.timed_events_thread.priority, -5);
+    EXPECT_EQ(rtps_atts.timed_events_thread.affinity, 0u);
+    EXPECT_EQ(rtps_atts.async_writers_thread.scheduling_policy, -1);
+    EXPECT_EQ(rtps_atts.async_writers_thread.priority, eprosima::fastdds::rtps::ThreadSettings().priority);
+    EXPECT_EQ(rtps_atts.async_writers_thread.affinity, 3u);
+    EXPECT_EQ(rtps_atts.async_writers_thread.stack_size, 1048576u);
+    EXPECT_EQ(rtps_atts.timed_events_thread.stack_size, 0u);
+    EXPECT_EQ(rtps_atts.discovery_server_matching_threads.scheduling_policy, 1);
+    EXPECT_EQ(rtps_atts.discovery_server_matching_threads.affinity, 12u);
+    EXPECT_EQ(rtps_atts.discovery_server_matching_threads.stack_size, 0u);
 }
 
 TEST_F(XMLProfileParserTests, XMLParserDefaultParcipantProfile)
@@ -692,6 +721,17 @@ TEST_F(XMLProfileParserTests, log_inactive)
     xmlparser::XMLProfileManager::loadXMLFile("log_inactive.xml");
 }
 
+TEST_F(XMLProfileParserTests, log_thread_settings)
+{
+    eprosima::fastdds::rtps::ThreadSettings thread_settings;
+    thread_settings.scheduling_policy = 0;
+    thread_settings.priority = 0;
+    thread_settings.affinity = 1u;
+
+    EXPECT_CALL(*log_mock, SetThreadConfig(thread_settings)).Times(1);
+    ASSERT_EQ(xmlparser::XMLP_ret::XML_OK, xmlparser::XMLProfileManager::loadXMLFile("log_thread_settings.xml"));
+}
+
 /*
  * This test registers a StdoutErrConsumer using XML and setting the `use_default` flag to FALSE. Furthermore, it sets
  * a `stderr_threshold` to`Log::Kind::Error` using a property `stderr_threshold`. The test checks that:
@@ -850,6 +890,9 @@ TEST_F(XMLProfileParserTests, UDP_transport_descriptors_config)
     EXPECT_EQ(descriptor->interfaceWhiteList[0], "192.168.1.41");
     EXPECT_EQ(descriptor->interfaceWhiteList[1], "127.0.0.1");
     EXPECT_EQ(descriptor->m_output_udp_socket, 5101u);
+    EXPECT_EQ(descriptor->default_reception_threads.scheduling_policy, 2);
+    EXPECT_EQ(descriptor->default_reception_threads.priority, 10);
+    EXPECT_EQ(descriptor->default_reception_threads.affinity, 1u);
 }
 
 TEST_F(XMLProfileParserTests, SHM_transport_descriptors_config)
@@ -0,0 +1,289 @@
+// Copyright 2020 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file scale_benchmark.cpp
+ *
+ * Measures how long a discovery server takes to match the endpoints of many clients.
+ *
+ * Usage: fast-discovery-server-scale-benchmark [clients] [topics] [matching_threads] [timeout_s]
+ *
+ * A server and the given number of clients are created on this process. Each client has a writer and a reader on
+ * one of the topics, and the time until every reader has matched all the writers on its topic is printed.
+ */
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/attributes/ServerAttributes.h>
+#include <fastrtps/utils/IPLocator.h>
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+//! Type of the topics, no sample is ever published
+class CounterType : public TopicDataType
+{
+public:
+
+    CounterType()
+    {
+        setName("ScaleBenchmarkCounter");
+        m_typeSize = 8;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload) override
+    {
+        payload->encapsulation = CDR_LE;
+        payload->data[0] = 0;
+        payload->data[1] = CDR_LE;
+        payload->data[2] = 0;
+        payload->data[3] = 0;
+        std::memcpy(&payload->data[4], data, sizeof(uint32_t));
+        payload->length = 8;
+        return true;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* payload,
+            void* data) override
+    {
+        if (payload->length < 8)
+        {
+            return false;
+        }
+        std::memcpy(data, &payload->data[4], sizeof(uint32_t));
+        return true;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*) override
+    {
+        return []()
+               {
+                   return 8u;
+               };
+    }
+
+    void* createData() override
+    {
+        return new uint32_t(0);
+    }
+
+    void deleteData(
+            void* data) override
+    {
+        delete static_cast<uint32_t*>(data);
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+//! Entities of a client
+struct Client
+{
+    DomainParticipant* participant = nullptr;
+    Topic* topic = nullptr;
+    Publisher* publisher = nullptr;
+    DataWriter* writer = nullptr;
+    Subscriber* subscriber = nullptr;
+    DataReader* reader = nullptr;
+};
+
+//! Counts the matches of all the readers
+class MatchCounter : public DataReaderListener
+{
+public:
+
+    void on_subscription_matched(
+            DataReader*,
+            const SubscriptionMatchedStatus& info) override
+    {
+        if (info.current_count_change > 0)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            ++matches_;
+            cv_.notify_all();
+        }
+    }
+
+    bool wait(
+            uint64_t expected,
+            std::chrono::seconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this, expected]()
+                       {
+                           return matches_ >= expected;
+                       });
+    }
+
+    uint64_t matches()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        return matches_;
+    }
+
+private:
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    uint64_t matches_ = 0;
+};
+
+} // namespace
+
+int main(
+        int argc,
+        char* argv[])
+{
+    uint32_t num_clients = argc > 1 ? static_cast<uint32_t>(std::strtoul(argv[1], nullptr, 10)) : 100;
+    uint32_t num_topics = argc > 2 ? static_cast<uint32_t>(std::strtoul(argv[2], nullptr, 10)) : 10;
+    const char* matching_threads = argc > 3 ? argv[3] : "1";
+    long timeout = argc > 4 ? std::strtol(argv[4], nullptr, 10) : 120;
+
+    if (num_clients == 0 || num_topics == 0)
+    {
+        std::cout << "The number of clients and topics must be positive" << std::endl;
+        return 1;
+    }
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+
+    // Server listening on localhost
+    Locator_t server_locator;
+    IPLocator::setIPv4(server_locator, 127, 0, 0, 1);
+    IPLocator::setPhysicalPort(server_locator, eprosima::fastdds::rtps::DEFAULT_ROS2_SERVER_PORT);
+
+    RemoteServerAttributes server;
+    eprosima::fastdds::rtps::get_server_client_default_guidPrefix(0, server.guidPrefix);
+    server.metatrafficUnicastLocatorList.push_back(server_locator);
+
+    DomainParticipantQos server_qos;
+    server_qos.name("scale benchmark server");
+    server_qos.wire_protocol().prefix = server.guidPrefix;
+    server_qos.wire_protocol().builtin.discovery_config.discoveryProtocol = DiscoveryProtocol_t::SERVER;
+    server_qos.wire_protocol().builtin.metatrafficUnicastLocatorList.push_back(server_locator);
+    server_qos.properties().properties().emplace_back("fastdds.discovery_server.matching_threads", matching_threads);
+
+    DomainParticipant* server_participant = factory->create_participant(0, server_qos);
+    if (server_participant == nullptr)
+    {
+        std::cout << "Error creating the server" << std::endl;
+        return 1;
+    }
+
+    DomainParticipantQos client_qos;
+    client_qos.wire_protocol().builtin.discovery_config.discoveryProtocol = DiscoveryProtocol_t::CLIENT;
+    client_qos.wire_protocol().builtin.discovery_config.m_DiscoveryServers.push_back(server);
+
+    // Every reader matches all the writers on its topic, including the one of its own client
+    std::vector<uint64_t> clients_per_topic(num_topics, 0);
+    for (uint32_t i = 0; i < num_clients; ++i)
+    {
+        ++clients_per_topic[i % num_topics];
+    }
+    uint64_t expected_matches = 0;
+    for (uint64_t count : clients_per_topic)
+    {
+        expected_matches += count * count;
+    }
+
+    MatchCounter counter;
+    std::vector<Client> clients;
+    auto start = std::chrono::steady_clock::now();
+
+    for (uint32_t i = 0; i < num_clients; ++i)
+    {
+        Client client;
+        client.participant = factory->create_participant(0, client_qos);
+        if (client.participant == nullptr)
+        {
+            std::cout << "Error creating client " << i << std::endl;
+            break;
+        }
+
+        TypeSupport type(new CounterType());
+        type.register_type(client.participant);
+        client.topic = client.participant->create_topic("scale_benchmark_" + std::to_string(i % num_topics),
+                        type.get_type_name(), TOPIC_QOS_DEFAULT);
+        client.publisher = client.participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+        client.writer = client.publisher->create_datawriter(client.topic, DATAWRITER_QOS_DEFAULT);
+        client.subscriber = client.participant->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+        client.reader = client.subscriber->create_datareader(client.topic, DATAREADER_QOS_DEFAULT, &counter);
+        clients.push_back(client);
+    }
+
+    auto created = std::chrono::steady_clock::now();
+    bool matched = clients.size() == num_clients && counter.wait(expected_matches, std::chrono::seconds(timeout));
+    auto end = std::chrono::steady_clock::now();
+
+    std::cout << "Clients: " << num_clients << ", topics: " << num_topics << ", matching threads: "
+              << matching_threads << std::endl;
+    std::cout << "Creation: " << std::chrono::duration_cast<std::chrono::milliseconds>(created - start).count()
+              << " ms" << std::endl;
+    if (matched)
+    {
+        std::cout << "Discovery: " << std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count()
+                  << " ms" << std::endl;
+    }
+    else
+    {
+        std::cout << "Discovery timed out with " << counter.matches() << " of " << expected_matches << " matches"
+                  << std::endl;
+    }
+
+    for (Client& client : clients)
+    {
+        client.subscriber->delete_datareader(client.reader);
+        client.participant->delete_subscriber(client.subscriber);
+        client.publisher->delete_datawriter(client.writer);
+        client.participant->delete_publisher(client.publisher);
+        client.participant->delete_topic(client.topic);
+        factory->delete_participant(client.participant);
+    }
+    factory->delete_participant(server_participant);
+
+    return matched ? 0 : 1;
+}